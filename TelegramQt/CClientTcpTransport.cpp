@@ -22,6 +22,7 @@
 #include "RawStream.hpp"
 #include "TelegramNamespace.hpp"
 
+#include <QLocalSocket>
 #include <QNetworkProxy>
 #include <QTcpSocket>
 #include <QTimer>
@@ -36,6 +37,7 @@ Q_LOGGING_CATEGORY(c_loggingTranport, "telegram.client.transport", QtWarningMsg)
 
 static const quint8 c_abridgedVersionByte = 0xef;
 static const quint32 c_intermediateVersionBytes = 0xeeeeeeeeu;
+static const quint32 c_paddedIntermediateVersionBytes = 0xddddddddu;
 static const quint32 c_obfucsatedProcotolIdentifier = 0xefefefefu;
 
 TcpTransport::TcpTransport(QObject *parent) :
@@ -47,6 +49,16 @@ TcpTransport::TcpTransport(QObject *parent) :
     connect(m_timeoutTimer, &QTimer::timeout, this, &TcpTransport::onTimeout);
 }
 
+TcpTransport::TcpTransport(QLocalSocket *socket, QObject *parent) :
+    BaseTcpTransport(parent),
+    m_timeoutTimer(new QTimer(this))
+{
+    socket->setParent(this);
+    setLocalSocket(socket);
+    m_timeoutTimer->setInterval(connectionTimeout());
+    connect(m_timeoutTimer, &QTimer::timeout, this, &TcpTransport::onTimeout);
+}
+
 TcpTransport::~TcpTransport()
 {
     qCDebug(c_loggingTranport) << CALL_INFO;
@@ -54,6 +66,11 @@ TcpTransport::~TcpTransport()
 
 void TcpTransport::connectToHost(const QString &ipAddress, quint16 port)
 {
+    if (m_localSocket) {
+        qCDebug(c_loggingTranport).noquote().nospace() << CALL_INFO << '(' << ipAddress << ')';
+        m_localSocket->connectToServer(getLocalSocketServerName(ipAddress));
+        return;
+    }
     const QNetworkProxy proxy = m_socket->proxy();
     QString proxyStr;
     if (proxy.hostName().isEmpty()) {
@@ -84,6 +101,7 @@ void TcpTransport::startObfuscatedSession()
     // prepare random part
     const QVector<quint32> headerFirstWordBlackList = {
         0x44414548u, 0x54534f50u, 0x20544547u, 0x20544547u, c_intermediateVersionBytes,
+        c_paddedIntermediateVersionBytes,
     };
     const QVector<quint32> headerSecondWordBlackList = {
         0x0,
@@ -115,23 +133,46 @@ void TcpTransport::startObfuscatedSession()
     raw << first4Bytes;
     raw << next4Bytes;
     raw << aesSourceData;
-    m_socket->write(raw.getData());
+    m_device->write(raw.getData());
     raw << c_obfucsatedProcotolIdentifier;
     raw << trailingRandom;
-    QByteArray encrypted = m_writeAesContext->crypt(raw.getData());
-    m_socket->write(encrypted.mid(56, 8));
+    QByteArray encrypted = raw.getData();
+    m_writeAesContext->crypt(encrypted.data(), encrypted.size());
+    m_device->write(encrypted.constData() + 56, 8);
     setSessionType(Obfuscated);
 }
 
 void TcpTransport::startAbridgedSession()
 {
     qCDebug(c_loggingTranport) << "Start the session in Abridged format";
-    m_socket->putChar(c_abridgedVersionByte);
+    m_device->putChar(c_abridgedVersionByte);
     setSessionType(Abridged);
 }
 
+void TcpTransport::startIntermediateSession()
+{
+    qCDebug(c_loggingTranport) << "Start the session in Intermediate format";
+    RawStream raw(RawStream::WriteOnly);
+    raw << c_intermediateVersionBytes;
+    m_device->write(raw.getData());
+    setSessionType(Intermediate);
+}
+
+void TcpTransport::startPaddedIntermediateSession()
+{
+    qCDebug(c_loggingTranport) << "Start the session in Padded Intermediate format";
+    RawStream raw(RawStream::WriteOnly);
+    raw << c_paddedIntermediateVersionBytes;
+    m_device->write(raw.getData());
+    setSessionType(PaddedIntermediate);
+}
+
 bool TcpTransport::setProxy(const QNetworkProxy &proxy)
 {
+    if (!m_socket) {
+        qCWarning(c_loggingTranport) << CALL_INFO << "Unable to set proxy on a local socket";
+        return false;
+    }
     if (m_socket->isOpen()) {
         qCWarning(c_loggingTranport) << CALL_INFO << "Unable to set proxy on open socket";
         return false;
@@ -158,6 +199,15 @@ void TcpTransport::setState(QAbstractSocket::SocketState newState)
 
 void TcpTransport::onTimeout()
 {
+    if (m_localSocket) {
+        qCDebug(c_loggingTranport) << CALL_INFO
+                                   << "socket state:" << m_localSocket->state()
+                                   << "server:" << m_localSocket->serverName();
+        emit timeout();
+        qCDebug(c_loggingTranport) << CALL_INFO << "close local socket" << m_localSocket;
+        m_localSocket->disconnectFromServer();
+        return;
+    }
     qCDebug(c_loggingTranport) << CALL_INFO
                                << "socket state:" << m_socket->state()
                                << "peer:" << m_socket->peerName() << m_socket->peerPort()
@@ -180,6 +230,12 @@ void TcpTransport::writeEvent()
     case Abridged:
         startAbridgedSession();
         break;
+    case Intermediate:
+        startIntermediateSession();
+        break;
+    case PaddedIntermediate:
+        startPaddedIntermediateSession();
+        break;
     default:
         qCCritical(c_loggingTranport) << CALL_INFO
                                       << "The selected session type"
@@ -20,6 +20,7 @@
 
 #include "CTcpTransport.hpp"
 
+QT_FORWARD_DECLARE_CLASS(QLocalSocket)
 QT_FORWARD_DECLARE_CLASS(QTimer)
 
 namespace Telegram {
@@ -31,6 +32,7 @@ class TcpTransport : public BaseTcpTransport
     Q_OBJECT
 public:
     explicit TcpTransport(QObject *parent = nullptr);
+    explicit TcpTransport(QLocalSocket *socket, QObject *parent = nullptr);
     ~TcpTransport() override;
 
     void connectToHost(const QString &ipAddress, quint16 port) override;
@@ -40,6 +42,8 @@ public:
 
     void startObfuscatedSession();
     void startAbridgedSession();
+    void startIntermediateSession();
+    void startPaddedIntermediateSession();
     bool setProxy(const QNetworkProxy &proxy);
 
 protected:
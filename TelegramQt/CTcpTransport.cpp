@@ -17,10 +17,13 @@
 
 #include "Crypto/AesCtr.hpp"
 #include "CTcpTransport.hpp"
+#include "ConnectionError.hpp"
 #include "Debug_p.hpp"
+#include "RandomGenerator.hpp"
 #include "RawStream.hpp"
 
 #include <QHostAddress>
+#include <QtEndian>
 
 #include <QLoggingCategory>
 
@@ -31,6 +34,9 @@
 Q_LOGGING_CATEGORY(c_loggingTcpTransport, "telegram.transport.tcp", QtWarningMsg)
 
 static const quint32 c_defaultConnectionTimeout = 15 * 1000;
+static const int c_readBufferReserve = 64 * 1024;
+static const quint32 c_maximumPacketLength = 0xffffffu * 4; // The limit of the Abridged format
+static const int c_paddedIntermediateMaxPadding = 15;
 
 namespace Telegram {
 
@@ -38,6 +44,7 @@ BaseTcpTransport::BaseTcpTransport(QObject *parent) :
     BaseTransport(parent),
     m_socket(nullptr)
 {
+    m_readBuffer.reserve(c_readBufferReserve);
 }
 
 BaseTcpTransport::~BaseTcpTransport()
@@ -48,6 +55,12 @@ BaseTcpTransport::~BaseTcpTransport()
         qCDebug(c_loggingTcpTransport) << CALL_INFO << "close socket" << m_socket;
         m_socket->disconnectFromHost();
     }
+    if (m_localSocket && m_localSocket->isWritable() && m_localSocket->isOpen()
+            && m_localSocket->state() != QLocalSocket::UnconnectedState) {
+        m_localSocket->waitForBytesWritten(100);
+        qCDebug(c_loggingTcpTransport) << CALL_INFO << "close local socket" << m_localSocket;
+        m_localSocket->disconnectFromServer();
+    }
     delete m_readAesContext;
     delete m_writeAesContext;
 }
@@ -62,8 +75,26 @@ int BaseTcpTransport::connectionTimeout()
     return c_defaultConnectionTimeout;
 }
 
+QString BaseTcpTransport::localSocketAddressScheme()
+{
+    return QStringLiteral("unix:");
+}
+
+bool BaseTcpTransport::isLocalSocketAddress(const QString &address)
+{
+    return address.startsWith(localSocketAddressScheme());
+}
+
+QString BaseTcpTransport::getLocalSocketServerName(const QString &address)
+{
+    return address.mid(localSocketAddressScheme().size());
+}
+
 QString BaseTcpTransport::remoteAddress() const
 {
+    if (m_localSocket) {
+        return localSocketAddressScheme() + m_localSocket->serverName();
+    }
     return m_socket ? m_socket->peerAddress().toString() : QString();
 }
 
@@ -74,7 +105,12 @@ void BaseTcpTransport::disconnectFromHost()
         qCDebug(c_loggingTcpTransport) << CALL_INFO << "close socket" << m_socket;
         m_socket->disconnectFromHost();
     }
+    if (m_localSocket) {
+        qCDebug(c_loggingTcpTransport) << CALL_INFO << "close local socket" << m_localSocket;
+        m_localSocket->disconnectFromServer();
+    }
     m_readBuffer.clear();
+    m_readOffset = 0;
     m_packetNumber = 0;
     m_expectedLength = 0;
     m_sessionType = Unknown;
@@ -89,6 +125,22 @@ void BaseTcpTransport::sendPacketImplementation(const QByteArray &payload)
 {
     qCDebug(c_loggingTcpTransport) << CALL_INFO << payload.size();
 
+    if (payload.length() % 4) {
+        qCCritical(c_loggingTcpTransport) << CALL_INFO
+                                          << "Invalid outgoing packet! "
+                                             "The payload size is not divisible by four!";
+    }
+
+    QByteArray packet = framePacket(payload);
+    if (m_writeAesContext && m_writeAesContext->hasKey()) {
+        m_writeAesContext->crypt(packet.data(), packet.size());
+    }
+
+    m_device->write(packet);
+}
+
+QByteArray BaseTcpTransport::framePacket(const QByteArray &payload) const
+{
     // quint32 length (included length itself + packet number
     //                 + crc32 + payload (MUST be divisible by 4)
     // quint32 packet number
@@ -102,28 +154,76 @@ void BaseTcpTransport::sendPacketImplementation(const QByteArray &payload)
     //      (quint8: 0x7f, quint24: Packet length / 4)
     // Payload
 
-    if (payload.length() % 4) {
-        qCCritical(c_loggingTcpTransport) << CALL_INFO
-                                          << "Invalid outgoing packet! "
-                                             "The payload size is not divisible by four!";
-    }
+    // Intermediate version:
+    // quint32: 0xeeeeeeee
+    // quint32: Packet length (little endian)
+    // Payload
+
+    // Padded intermediate version:
+    // quint32: 0xdddddddd
+    // quint32: Packet length (little endian, including the padding)
+    // Payload
+    // 0-15 random padding bytes
 
     QByteArray packet;
-    packet.reserve(payload.size() + 4);
-    const quint32 length = payload.length() / 4;
-    if (length < 0x7f) {
-        packet.append(char(length));
-    } else {
-        packet.append(char(0x7f));
-        packet.append(reinterpret_cast<const char *>(&length), 3);
+    switch (m_sessionType) {
+    case Intermediate:
+    case PaddedIntermediate: {
+        // The transport error packet is never padded: its size is the only thing
+        // that tells it apart from an MTProto packet.
+        const bool canPad = (m_sessionType == PaddedIntermediate)
+                && (payload.size() != ConnectionError::packetSize());
+        const int padding = canPad
+                ? RandomGenerator::instance()->generate<quint8>() % (c_paddedIntermediateMaxPadding + 1)
+                : 0;
+        const int packetLength = payload.size() + padding;
+        packet.resize(4 + packetLength);
+        char *data = packet.data();
+        qToLittleEndian<quint32>(static_cast<quint32>(packetLength), reinterpret_cast<uchar *>(data));
+        memcpy(data + 4, payload.constData(), static_cast<size_t>(payload.size()));
+        if (padding) {
+            RandomGenerator::instance()->generate(data + 4 + payload.size(), padding);
+        }
+        break;
     }
-    packet.append(payload);
-
-    if (m_writeAesContext && m_writeAesContext->hasKey()) {
-        packet = m_writeAesContext->crypt(packet);
+    default: {
+        packet.reserve(payload.size() + 4);
+        const quint32 length = payload.length() / 4;
+        if (length < 0x7f) {
+            packet.append(char(length));
+        } else {
+            packet.append(char(0x7f));
+            packet.append(reinterpret_cast<const char *>(&length), 3);
+        }
+        packet.append(payload);
+        break;
     }
+    }
+    return packet;
+}
 
-    m_socket->write(packet);
+int BaseTcpTransport::getUnpaddedPacketSize(const char *data, int size)
+{
+    // The padded intermediate packet length includes a random tail.
+    // Restore the actual payload size from the MTProto packet layout.
+    // auth_key_id (8) + message_id (8) + message_data_length (4) + message_data
+    constexpr int c_plainHeaderSize = 20;
+    if (size < c_plainHeaderSize) {
+        // Too short for any MTProto packet. That is a transport error code,
+        // possibly followed by the padding of a peer that pads it anyway.
+        return qMin(size, ConnectionError::packetSize());
+    }
+    const quint64 authKeyId = qFromLittleEndian<quint64>(reinterpret_cast<const uchar *>(data));
+    if (authKeyId) {
+        // auth_key_id (8) + msg_key (16) + encrypted data (divisible by 16)
+        constexpr int c_encryptedHeaderSize = 24;
+        if (size < c_encryptedHeaderSize) {
+            return size;
+        }
+        return size - ((size - c_encryptedHeaderSize) % 16);
+    }
+    const quint32 messageLength = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(data + 16));
+    return static_cast<int>(qMin<quint32>(c_plainHeaderSize + messageLength, static_cast<quint32>(size)));
 }
 
 void BaseTcpTransport::setSessionType(BaseTcpTransport::SessionType sessionType)
@@ -190,51 +290,113 @@ void BaseTcpTransport::setState(QAbstractSocket::SocketState newState)
 
 void BaseTcpTransport::onReadyRead()
 {
-    qCDebug(c_loggingTcpTransport) << CALL_INFO << m_socket->bytesAvailable();
+    qCDebug(c_loggingTcpTransport) << CALL_INFO << m_device->bytesAvailable();
     readEvent();
     if (m_sessionType == Unknown) {
         qCCritical(c_loggingTcpTransport) << this << "Unknown session type!";
         return;
     }
-    if (m_socket->bytesAvailable() > 0) {
-        QByteArray allData = m_socket->readAll();
-        if (m_readAesContext) {
-            allData = m_readAesContext->crypt(allData);
-        }
-        m_readBuffer.append(allData);
+    readSocketData();
+    readPackets();
+}
+
+char *BaseTcpTransport::allocateReadData(int size)
+{
+    if (m_readOffset) {
+        // Drop the processed packets. Only the tail of an incomplete packet is moved
+        // and the reserved capacity is kept for the next read.
+        m_readBuffer.remove(0, m_readOffset);
+        m_readOffset = 0;
+    }
+    const int previousSize = m_readBuffer.size();
+    m_readBuffer.resize(previousSize + size);
+    return m_readBuffer.data() + previousSize;
+}
+
+void BaseTcpTransport::readSocketData()
+{
+    const qint64 bytesAvailable = m_device->bytesAvailable();
+    if (bytesAvailable <= 0) {
+        return;
+    }
+    char *newData = allocateReadData(static_cast<int>(bytesAvailable));
+    const qint64 bytesRead = qMax<qint64>(m_device->read(newData, bytesAvailable), 0);
+    if (bytesRead != bytesAvailable) {
+        m_readBuffer.chop(static_cast<int>(bytesAvailable - bytesRead));
     }
-    while (m_readBuffer.size() >= 4) {
+    if (m_readAesContext) {
+        m_readAesContext->crypt(newData, static_cast<int>(bytesRead));
+    }
+}
+
+void BaseTcpTransport::readPackets()
+{
+    while (m_readBuffer.size() - m_readOffset >= 4) {
         if (m_expectedLength == 0) {
-            const quint8 *data = reinterpret_cast<const quint8*>(m_readBuffer.constData());
-            quint8 length_t1 = data[0];
-            if (length_t1 < 0x7fu) {
-                m_expectedLength = length_t1 * 4;
-                m_readBuffer = m_readBuffer.mid(1);
-            } else if (length_t1 == 0x7fu) {
-                m_expectedLength = data[1] + data[2] * 256 + data[3] * 256 * 256;
-                m_expectedLength *= 4;
-                m_readBuffer = m_readBuffer.mid(4);
-            } else {
-                qCWarning(c_loggingTcpTransport) << CALL_INFO << "Invalid packet size byte"
-                                                 << hex << showbase << length_t1;
+            if (!readPacketLength()) {
                 setError(QAbstractSocket::UnknownSocketError, QLatin1String("Invalid read operation"));
                 disconnectFromHost();
                 return;
             }
         }
-        if (m_readBuffer.size() < static_cast<int>(m_expectedLength)) {
+        const int bytesAvailable = m_readBuffer.size() - m_readOffset;
+        if (bytesAvailable < static_cast<int>(m_expectedLength)) {
             qCDebug(c_loggingTcpTransport) << CALL_INFO << "Ready read, but only "
-                                           << m_readBuffer.size() << "bytes available ("
+                                           << bytesAvailable << "bytes available ("
                                            << m_expectedLength << "bytes expected)";
             return;
         }
-        const QByteArray payload = m_readBuffer.left(static_cast<int>(m_expectedLength));
-        m_readBuffer = m_readBuffer.mid(static_cast<int>(m_expectedLength));
+        const int payloadOffset = m_readOffset;
+        int payloadLength = static_cast<int>(m_expectedLength);
+        m_readOffset += payloadLength;
         m_expectedLength = 0;
+        if (m_sessionType == PaddedIntermediate) {
+            payloadLength = getUnpaddedPacketSize(m_readBuffer.constData() + payloadOffset, payloadLength);
+        }
         qCDebug(c_loggingTcpTransport) << CALL_INFO
-                                       << "Received a packet (" << payload.size() << " bytes)";
-        emit packetReceived(payload);
+                                       << "Received a packet (" << payloadLength << " bytes)";
+
+        // The payload refers to the read buffer without a copy.
+        // Keep a reference to the buffer, so the payload stays valid during the emission
+        // even if a receiver resets the transport (e.g. calls disconnectFromHost()).
+        const QByteArray readBuffer = m_readBuffer;
+        emit packetReceived(QByteArray::fromRawData(readBuffer.constData() + payloadOffset, payloadLength));
+    }
+}
+
+bool BaseTcpTransport::readPacketLength()
+{
+    const quint8 *data = reinterpret_cast<const quint8*>(m_readBuffer.constData() + m_readOffset);
+    switch (m_sessionType) {
+    case Intermediate:
+    case PaddedIntermediate:
+        m_expectedLength = qFromLittleEndian<quint32>(data);
+        m_readOffset += 4;
+        if ((m_expectedLength == 0) || (m_expectedLength > c_maximumPacketLength)) {
+            qCWarning(c_loggingTcpTransport) << CALL_INFO << "Invalid packet length"
+                                             << m_expectedLength;
+            m_expectedLength = 0;
+            return false;
+        }
+        return true;
+    default:
+        break;
+    }
+
+    quint8 length_t1 = data[0];
+    if (length_t1 < 0x7fu) {
+        m_expectedLength = length_t1 * 4;
+        m_readOffset += 1;
+    } else if (length_t1 == 0x7fu) {
+        m_expectedLength = data[1] + data[2] * 256 + data[3] * 256 * 256;
+        m_expectedLength *= 4;
+        m_readOffset += 4;
+    } else {
+        qCWarning(c_loggingTcpTransport) << CALL_INFO << "Invalid packet size byte"
+                                         << hex << showbase << length_t1;
+        return false;
     }
+    return true;
 }
 
 void BaseTcpTransport::onSocketErrorOccurred(QAbstractSocket::SocketError error)
@@ -242,16 +404,42 @@ void BaseTcpTransport::onSocketErrorOccurred(QAbstractSocket::SocketError error)
     setError(error, m_socket->errorString());
 }
 
+void BaseTcpTransport::onLocalSocketStateChanged(QLocalSocket::LocalSocketState state)
+{
+    // QLocalSocket states and errors are defined in terms of the QAbstractSocket ones
+    setState(static_cast<QAbstractSocket::SocketState>(state));
+}
+
+void BaseTcpTransport::onLocalSocketErrorOccurred(QLocalSocket::LocalSocketError error)
+{
+    setError(static_cast<QAbstractSocket::SocketError>(error), m_localSocket->errorString());
+}
+
 void BaseTcpTransport::setSocket(QAbstractSocket *socket)
 {
-    if (m_socket) {
-        qCCritical(c_loggingTcpTransport()) << CALL_INFO << "An attempt to set a socket twice";
-    }
     m_socket = socket;
+    setDevice(socket);
     connect(m_socket, &QAbstractSocket::stateChanged, this, &BaseTcpTransport::setState);
     connect(m_socket, SIGNAL(error(QAbstractSocket::SocketError)),
             SLOT(onSocketErrorOccurred(QAbstractSocket::SocketError)));
-    connect(m_socket, &QIODevice::readyRead, this, &BaseTcpTransport::onReadyRead);
+}
+
+void BaseTcpTransport::setLocalSocket(QLocalSocket *socket)
+{
+    m_localSocket = socket;
+    setDevice(socket);
+    connect(m_localSocket, &QLocalSocket::stateChanged, this, &BaseTcpTransport::onLocalSocketStateChanged);
+    connect(m_localSocket, SIGNAL(error(QLocalSocket::LocalSocketError)),
+            SLOT(onLocalSocketErrorOccurred(QLocalSocket::LocalSocketError)));
+}
+
+void BaseTcpTransport::setDevice(QIODevice *device)
+{
+    if (m_device) {
+        qCCritical(c_loggingTcpTransport()) << CALL_INFO << "An attempt to set a socket twice";
+    }
+    m_device = device;
+    connect(m_device, &QIODevice::readyRead, this, &BaseTcpTransport::onReadyRead);
 }
 
 } // Telegram namespace
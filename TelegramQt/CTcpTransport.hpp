@@ -20,6 +20,8 @@
 
 #include "CTelegramTransport.hpp"
 
+#include <QLocalSocket>
+
 namespace Telegram {
 
 namespace Crypto {
@@ -37,6 +39,8 @@ public:
         Abridged, // char(0xef)
         FullSize,
         Obfuscated,
+        Intermediate, // 0xeeeeeeee
+        PaddedIntermediate, // 0xdddddddd
         Default = Unknown,
     };
     Q_ENUM(SessionType)
@@ -50,6 +54,10 @@ public:
 
     static int connectionTimeout();
 
+    static QString localSocketAddressScheme();
+    static bool isLocalSocketAddress(const QString &address);
+    static QString getLocalSocketServerName(const QString &address);
+
     QString remoteAddress() const override;
 
     void disconnectFromHost() override;
@@ -61,10 +69,21 @@ protected slots:
     void onReadyRead();
 
     void onSocketErrorOccurred(QAbstractSocket::SocketError error);
+    void onLocalSocketStateChanged(QLocalSocket::LocalSocketState state);
+    void onLocalSocketErrorOccurred(QLocalSocket::LocalSocketError error);
 
 protected:
     void setSocket(QAbstractSocket *socket);
+    void setLocalSocket(QLocalSocket *socket);
+    void setDevice(QIODevice *device);
     void sendPacketImplementation(const QByteArray &payload) override;
+    QByteArray framePacket(const QByteArray &payload) const;
+    static int getUnpaddedPacketSize(const char *data, int size);
+
+    char *allocateReadData(int size);
+    void readSocketData();
+    void readPackets();
+    bool readPacketLength();
 
     void setSessionType(SessionType sessionType);
     void resetCryptoKeys();
@@ -74,8 +93,11 @@ protected:
     quint32 m_expectedLength = 0;
     SessionType m_sessionType = Unknown;
 
+    QIODevice *m_device = nullptr; // The framed stream; either m_socket or m_localSocket
     QAbstractSocket *m_socket = nullptr;
+    QLocalSocket *m_localSocket = nullptr;
     QByteArray m_readBuffer;
+    int m_readOffset = 0; // The beginning of unprocessed data in m_readBuffer
     Telegram::Crypto::AesCtrContext *m_readAesContext = nullptr;
     Telegram::Crypto::AesCtrContext *m_writeAesContext = nullptr;
 
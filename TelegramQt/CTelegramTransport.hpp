@@ -47,6 +47,8 @@ signals:
 
     void timeout();
 
+    // The payload can refer to the transport internal buffer and it is valid only
+    // during the signal emission. A receiver must make a deep copy to keep the data.
     void packetReceived(const QByteArray &payload);
     void packetSent(const QByteArray &payload);
 
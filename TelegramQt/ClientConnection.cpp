@@ -124,10 +124,17 @@ void Connection::onClientDhStateChanged()
         rpcLayer()->setServerSalt(m_dhLayer->serverSalt());
         if (!m_queuedOperations.isEmpty()) {
             for (PendingRpcOperation *operation : m_queuedOperations) {
-                quint64 messageId = rpcLayer()->sendRpc(operation);
-                qCDebug(c_clientConnectionCategory) << "Dequeue operation"
-                                                    << TLValue::firstFromArray(operation->requestData())
-                                                    << "with new id" << messageId;
+                const quint64 messageId = rpcLayer()->sendRpc(operation);
+                if (messageId) {
+                    qCDebug(c_clientConnectionCategory) << "Dequeue operation"
+                                                        << TLValue::firstFromArray(operation->requestData())
+                                                        << "with new id" << messageId;
+                } else {
+                    // The in-flight window is full; the message id is assigned on the actual send
+                    qCDebug(c_clientConnectionCategory) << "Dequeue operation"
+                                                        << TLValue::firstFromArray(operation->requestData())
+                                                        << "to the RPC queue";
+                }
             }
             m_queuedOperations.clear();
         }
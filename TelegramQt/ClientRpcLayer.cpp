@@ -24,11 +24,17 @@
 #include "PendingRpcOperation.hpp"
 #include "RandomGenerator.hpp"
 #include "UpdatesLayer.hpp"
+#include "Utils.hpp"
 
 #include "MTProto/MessageHeader.hpp"
+#include "MTProto/SerializedSize.hpp"
 #include "MTProto/Stream.hpp"
 
 #include <QLoggingCategory>
+#include <QTimer>
+
+#include <algorithm>
+#include <cmath>
 
 Q_LOGGING_CATEGORY(c_clientRpcLayerCategory, "telegram.client.rpclayer", QtWarningMsg)
 Q_LOGGING_CATEGORY(c_clientRpcDumpPackageCategory, "telegram.client.rpclayer.dump", QtWarningMsg)
@@ -37,9 +43,63 @@ namespace Telegram {
 
 namespace Client {
 
+// The containers are kept to resend their messages on a bad_msg_notification
+// or a bad_server_salt about the container; the notification comes soon
+static constexpr int c_trackedContainersLimit = 32;
+// A standalone ack is sent after the delay (ms) or as soon as the number of the acks is reached
+static constexpr int c_defaultAckDelay = 100;
+static constexpr int c_defaultAckThreshold = 64;
+// The received message ids kept to answer msgs_state_req
+static constexpr int c_receivedMessagesLimit = 256;
+// The method requests packed to more than 90% of the size in the probes are
+// sent as is and probed again once in c_compressionReprobeInterval requests
+static constexpr quint32 c_compressionProbeRequests = 4;
+static constexpr quint32 c_compressionReprobeInterval = 64;
+// The sampled bytes and the Shannon entropy (bits per byte) of the data
+// considered incompressible (such as the media or the encrypted data)
+static constexpr int c_entropySampleSize = 4096;
+static constexpr double c_incompressibleEntropy = 7.5;
+
+namespace {
+
+// https://core.telegram.org/mtproto/service_messages_about_messages#request-for-message-status-information
+enum MessageStateInfo : char {
+    NothingIsKnown = 1,
+    NotReceivedInRange = 2,
+    NotReceivedYet = 3,
+    Received = 4,
+    AckReceived = 8,
+};
+
+double estimateEntropy(const QByteArray &data)
+{
+    const int step = std::max(1, data.size() / c_entropySampleSize);
+    quint32 counts[256] = { 0 };
+    int samples = 0;
+    for (int i = 0; i < data.size(); i += step) {
+        ++counts[static_cast<uchar>(data.at(i))];
+        ++samples;
+    }
+    double entropy = 0;
+    for (quint32 count : counts) {
+        if (count) {
+            const double probability = static_cast<double>(count) / samples;
+            entropy -= probability * std::log2(probability);
+        }
+    }
+    return entropy;
+}
+
+} // anonymous namespace
+
 RpcLayer::RpcLayer(QObject *parent) :
-    BaseRpcLayer(parent)
+    BaseRpcLayer(parent),
+    m_ackTimer(new QTimer(this)),
+    m_ackDelay(c_defaultAckDelay),
+    m_ackThreshold(c_defaultAckThreshold)
 {
+    m_ackTimer->setSingleShot(true);
+    connect(m_ackTimer, &QTimer::timeout, this, &RpcLayer::acknowledgeMessages);
 }
 
 RpcLayer::~RpcLayer()
@@ -68,6 +128,74 @@ void RpcLayer::setServerSalt(quint64 serverSalt)
     m_serverSalt = serverSalt;
 }
 
+void RpcLayer::setMessageContainersEnabled(bool enabled)
+{
+    m_messageContainersEnabled = enabled;
+}
+
+void RpcLayer::setInFlightWindow(int window)
+{
+    m_inFlightWindow = qMax(0, window);
+    sendQueuedRpcs();
+}
+
+int RpcLayer::queuedRpcCount() const
+{
+    int count = 0;
+    for (const RpcQueue &queue : m_queuedRpcs) {
+        count += static_cast<int>(std::count_if(queue.cbegin(), queue.cend(),
+                                                [](const QPointer<PendingRpcOperation> &operation) {
+            return !operation.isNull();
+        }));
+    }
+    return count;
+}
+
+RpcLayer::Priority RpcLayer::methodPriority(quint32 method) const
+{
+    const QHash<quint32, Priority>::const_iterator it = m_methodPriorities.constFind(method);
+    if (it != m_methodPriorities.cend()) {
+        return it.value();
+    }
+    switch (method) {
+    case TLValue::MessagesSendMessage:
+    case TLValue::MessagesSendMedia:
+    case TLValue::MessagesForwardMessages:
+    case TLValue::MessagesEditMessage:
+    case TLValue::MessagesDeleteMessages:
+    case TLValue::MessagesReadHistory:
+    case TLValue::MessagesSetTyping:
+        return Priority::Interactive;
+    case TLValue::MessagesGetHistory: // The history sync
+    case TLValue::UploadGetFile:
+    case TLValue::UploadSaveFilePart:
+    case TLValue::UploadSaveBigFilePart:
+    case TLValue::ContactsImportContacts:
+        return Priority::Bulk;
+    default:
+        return Priority::Normal;
+    }
+}
+
+void RpcLayer::setMethodPriority(quint32 method, Priority priority)
+{
+    if (priority == Priority::Default) {
+        m_methodPriorities.remove(method);
+    } else {
+        m_methodPriorities.insert(method, priority);
+    }
+}
+
+void RpcLayer::setAckDelay(int msec)
+{
+    m_ackDelay = qMax(0, msec);
+}
+
+void RpcLayer::setAckThreshold(int count)
+{
+    m_ackThreshold = qBound(1, count, static_cast<int>(AckMaxMessages));
+}
+
 void RpcLayer::startNewSession()
 {
     m_sessionId = RandomGenerator::instance()->generate<quint64>();
@@ -76,6 +204,7 @@ void RpcLayer::startNewSession()
 
 bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
 {
+    addReceivedMessage(message.messageId);
     if (message.sequenceNumber & 1) {
         addMessageToAck(message.messageId);
     }
@@ -104,18 +233,25 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
     case TLValue::BadServerSalt:
         result = processIgnoredMessageNotification(message);
         break;
+    case TLValue::MsgsStateReq:
+        result = processMessagesStateRequest(message);
+        break;
+    case TLValue::MsgResendReq:
+        result = processResendRequest(message);
+        break;
     case TLValue::GzipPacked:
         qCWarning(c_clientRpcLayerCategory) << CALL_INFO
                                             << "GzipPacked should be processed in the base class";
         break;
     case TLValue::Pong:
     {
-        MTProto::Stream stream(message.data);
+        MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
         TLPong pong;
         stream >> pong;
         PendingRpcOperation *op = m_operations.take(pong.msgId);
         if (op) {
-            op->setFinishedWithReplyData(message.data);
+            releaseSentMessage(pong.msgId);
+            op->setFinishedWithReplyData(message.data, message.dataOffset, message.dataSize);
             result = true;
         } else {
             qCWarning(c_clientRpcLayerCategory) << "Unexpected pong?!" << pong.msgId << pong.pingId;
@@ -137,17 +273,25 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
 bool RpcLayer::processRpcResult(const MTProto::Message &message)
 {
     qCDebug(c_clientRpcLayerCategory) << "processRpcQuery(stream);";
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     quint64 messageId = 0;
     stream >> messageId;
     PendingRpcOperation *op = m_operations.take(messageId);
+    const bool windowMoved = m_inFlightMessages.remove(messageId);
     if (!op) {
         qCWarning(c_clientRpcLayerCategory) << "processRpcQuery():"
                                             << "Unhandled RPC result for messageId"
                                             << hex << showbase << messageId;
+        releaseSentMessage(messageId);
+        if (windowMoved) {
+            sendQueuedRpcs();
+        }
         return false;
     }
-    op->setFinishedWithReplyData(stream.readAll());
+    releaseSentMessage(messageId);
+    // The reply stays in the packet data, without a copy
+    op->setFinishedWithReplyData(message.data, message.dataOffset + stream.position(),
+                                 message.dataSize - stream.position());
 #define DUMP_CLIENT_RPC_PACKETS
 #ifdef DUMP_CLIENT_RPC_PACKETS
     qCDebug(c_clientRpcLayerCategory) << "Client: Answer for message"
@@ -158,13 +302,16 @@ bool RpcLayer::processRpcResult(const MTProto::Message &message)
     qCDebug(c_clientRpcLayerCategory) << "processRpcQuery():" << "Set finished op" << op
                                       << "messageId:" << hex << showbase << messageId
                                       << "error:" << op->errorDetails();
+    if (windowMoved) {
+        sendQueuedRpcs();
+    }
     return true;
 }
 
 bool RpcLayer::processUpdates(const MTProto::Message &message)
 {
     qCDebug(c_clientRpcLayerCategory) << "processUpdates()" << message.firstValue();
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
 
     TLUpdates updates;
     stream >> updates;
@@ -173,17 +320,82 @@ bool RpcLayer::processUpdates(const MTProto::Message &message)
 
 bool RpcLayer::processMessageAck(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     TLVector<quint64> idsVector;
     stream >> idsVector;
     qCDebug(c_clientRpcLayerCategory) << "processMessageAck():" << idsVector;
 
-    return true;
+    for (quint64 messageId : idsVector) {
+        const QVector<quint64> containerMessages = m_containers.value(messageId);
+        if (containerMessages.isEmpty()) {
+            acknowledgeSentMessage(messageId);
+        } else {
+            for (quint64 containerMessageId : containerMessages) {
+                acknowledgeSentMessage(containerMessageId);
+            }
+        }
+    }
+    return !stream.error();
+}
+
+bool RpcLayer::processMessagesStateRequest(const MTProto::Message &message)
+{
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
+    TLMsgsStateReq request;
+    stream >> request;
+    if (stream.error()) {
+        return false;
+    }
+    qCDebug(c_clientRpcLayerCategory) << CALL_INFO << request.msgIds;
+
+    MTProto::Stream output(MTProto::Stream::WriteOnly);
+    output << TLValue::MsgsStateInfo;
+    output << message.messageId;
+    output << getMessagesState(request.msgIds);
+    return sendPacket(output.getData(), SendMode::Client, NotContentRelatedMessage);
+}
+
+bool RpcLayer::processResendRequest(const MTProto::Message &message)
+{
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
+    TLMsgResendReq request;
+    stream >> request;
+    if (stream.error()) {
+        return false;
+    }
+    qCDebug(c_clientRpcLayerCategory) << CALL_INFO << request.msgIds;
+
+    bool result = true;
+    TLVector<quint64> unknownIds;
+    for (quint64 messageId : request.msgIds) {
+        if (m_messages.contains(messageId)) {
+            // The body is still in the retransmission buffer, so it goes again under the same id
+            qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Resend the message" << hex << showbase << messageId;
+            if (!m_sendQueue.contains(messageId)) {
+                enqueueMessage(messageId);
+            }
+        } else if (m_operations.contains(messageId)) {
+            // The body is released from the retransmission buffer, so the message is made anew
+            result = resendIgnoredMessage(messageId) && result;
+        } else {
+            unknownIds.append(messageId);
+        }
+    }
+    if (!unknownIds.isEmpty()) {
+        // The forgotten (or answered) messages are not resent; the server gets their states instead
+        // https://core.telegram.org/mtproto/service_messages_about_messages#voluntary-communication-of-status-of-messages
+        MTProto::Stream output(MTProto::Stream::WriteOnly);
+        output << TLValue::MsgsAllInfo;
+        output << unknownIds;
+        output << getMessagesState(unknownIds);
+        result = sendPacket(output.getData(), SendMode::Client, NotContentRelatedMessage) && result;
+    }
+    return result;
 }
 
 bool RpcLayer::processSessionCreated(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     // https://core.telegram.org/mtproto/service_messages#new-session-creation-notification
     quint64 firstMsgId;
     quint64 uniqueId;
@@ -203,7 +415,7 @@ bool RpcLayer::processSessionCreated(const MTProto::Message &message)
 
 bool RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     TLBadMsgNotification tlNotification;
     stream >> tlNotification;
     // https://core.telegram.org/mtproto/service_messages_about_messages#notice-of-ignored-error-message
@@ -212,6 +424,33 @@ bool RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message
 
     MTProto::Message *m = m_messages.value(notification.messageId);
     if (!m) {
+        const QVector<quint64> containerMessages = m_containers.take(notification.messageId);
+        if (!containerMessages.isEmpty()) {
+            // The server ignored the whole container, so its RPCs go again (in a new one)
+            qCDebug(c_clientRpcLayerCategory) << CALL_INFO << notification.toString()
+                                              << "for the container of" << containerMessages.count() << "messages";
+            bool result = true;
+            for (quint64 messageId : containerMessages) {
+                if (m_operations.contains(messageId)) {
+                    result = resendIgnoredMessage(messageId) && result;
+                } else {
+                    restoreAcks(messageId);
+                }
+            }
+            return result;
+        }
+        if (restoreAcks(notification.messageId)) {
+            return true;
+        }
+        if (m_operations.contains(notification.messageId)) {
+            if (!canResendIgnoredMessage(notification.errorCode)) {
+                qCWarning(c_clientRpcLayerCategory) << "Unhandled error:" << notification.toString();
+                finishIgnoredMessage(notification);
+                return false;
+            }
+            // The body is released from the retransmission buffer, so the message is made anew
+            return resendIgnoredMessage(notification.messageId);
+        }
         qCWarning(c_clientRpcLayerCategory) << CALL_INFO
                                             << notification.toString() << "for unknown message id"
                                             << hex << showbase << notification.messageId;
@@ -257,9 +496,39 @@ bool RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message
     }
 
     qCWarning(c_clientRpcLayerCategory) << "Unhandled error:" << notification.toString();
+    finishIgnoredMessage(notification);
     return false;
 }
 
+bool RpcLayer::canResendIgnoredMessage(quint32 errorCode)
+{
+    switch (errorCode) {
+    case MTProto::IgnoredMessageNotification::IncorrectServerSalt:
+    case MTProto::IgnoredMessageNotification::MessageIdTooOld:
+    case MTProto::IgnoredMessageNotification::SequenceNumberTooHigh:
+    case MTProto::IgnoredMessageNotification::SequenceNumberTooLow:
+    case MTProto::IgnoredMessageNotification::IncorrectTwoLowerOrderMessageIdBits:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void RpcLayer::finishIgnoredMessage(const MTProto::IgnoredMessageNotification &notification)
+{
+    // The message is not resent, so the operation fails and its window slot goes to the queued RPCs
+    const quint64 messageId = notification.messageId;
+    PendingRpcOperation *operation = m_operations.take(messageId);
+    const bool windowMoved = m_inFlightMessages.remove(messageId);
+    releaseSentMessage(messageId);
+    if (operation) {
+        operation->setFinishedWithError({{PendingOperation::c_text(), notification.toString()}});
+    }
+    if (windowMoved) {
+        sendQueuedRpcs();
+    }
+}
+
 bool RpcLayer::processMessageHeader(const MTProto::FullMessageHeader &header)
 {
     if (serverSalt() != header.serverSalt) {
@@ -278,50 +547,104 @@ bool RpcLayer::processMessageHeader(const MTProto::FullMessageHeader &header)
     return true;
 }
 
-QByteArray RpcLayer::getEncryptionKeyPart() const
+quint64 RpcLayer::sendRpc(PendingRpcOperation *operation)
 {
-    return m_sendHelper->getClientKeyPart();
+    operation->setConnection(m_sendHelper->getConnection());
+    if (!operation->isContentRelated()) {
+        return sendRpcMessage(operation); // The pings are not limited
+    }
+    const Priority priority = getPriority(operation);
+    if (canSendRpc(priority)) {
+        return sendRpcMessage(operation);
+    }
+    qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Queue" << operation
+                                      << "priority:" << static_cast<int>(priority)
+                                      << "in flight:" << m_inFlightMessages.count();
+    m_queuedRpcs[static_cast<int>(priority)].enqueue(operation);
+    return 0;
 }
 
-QByteArray RpcLayer::getVerificationKeyPart() const
+RpcLayer::Priority RpcLayer::getPriority(const PendingRpcOperation *operation) const
 {
-    return m_sendHelper->getServerKeyPart();
+    if (operation->priority() != Priority::Default) {
+        return operation->priority();
+    }
+    return methodPriority(TLValue::firstFromArray(operation->requestData()));
 }
 
-quint64 RpcLayer::sendRpc(PendingRpcOperation *operation)
+int RpcLayer::getWindowLimit(Priority priority) const
 {
-    operation->setConnection(m_sendHelper->getConnection());
+    switch (priority) {
+    case Priority::Interactive:
+        return m_inFlightWindow;
+    case Priority::Normal:
+        return qMax(1, m_inFlightWindow - m_inFlightWindow / 4);
+    default:
+        return qMax(1, m_inFlightWindow / 2);
+    }
+}
 
-    MTProto::Message *message = new MTProto::Message();
-    message->messageId = m_sendHelper->newMessageId(SendMode::Client);
-    if (operation->isContentRelated()) {
-        message->sequenceNumber = m_contentRelatedMessages * 2 + 1;
-        ++m_contentRelatedMessages;
-    } else {
-        if (m_contentRelatedMessages == 0) {
-            qCCritical(c_clientRpcLayerCategory) << CALL_INFO
-                                                 << "First message should be content related!";
+bool RpcLayer::hasWindowRoom(Priority priority) const
+{
+    return (m_inFlightWindow == 0) || (m_inFlightMessages.count() < getWindowLimit(priority));
+}
+
+static void dropDeletedQueuedRpcs(QQueue<QPointer<PendingRpcOperation>> *queue)
+{
+    while (!queue->isEmpty() && queue->head().isNull()) {
+        queue->dequeue();
+    }
+}
+
+bool RpcLayer::canSendRpc(Priority priority)
+{
+    // The RPC can not overtake the queued RPCs of the same or a higher priority
+    for (int i = 0; i <= static_cast<int>(priority); ++i) {
+        dropDeletedQueuedRpcs(&m_queuedRpcs[i]);
+        if (!m_queuedRpcs[i].isEmpty()) {
+            return false;
+        }
+    }
+    return hasWindowRoom(priority);
+}
+
+void RpcLayer::sendQueuedRpcs()
+{
+    for (int i = 0; i < PrioritiesCount; ++i) {
+        RpcQueue &queue = m_queuedRpcs[i];
+        dropDeletedQueuedRpcs(&queue);
+        while (!queue.isEmpty() && hasWindowRoom(static_cast<Priority>(i))) {
+            sendRpcMessage(queue.dequeue());
+            dropDeletedQueuedRpcs(&queue);
+        }
+        if (!queue.isEmpty()) {
+            return; // The RPCs of the lower priorities wait for these ones
         }
-        message->sequenceNumber = m_contentRelatedMessages * 2;
     }
+}
 
-    // We have to add InitConnection here because
-    // sendPackage() implementation is shared with server
-    if (message->sequenceNumber == 1) {
-        message->setData(getInitConnection() + operation->requestData());
-    } else {
-        message->setData(operation->requestData());
+quint64 RpcLayer::sendRpcMessage(PendingRpcOperation *operation)
+{
+    MTProto::Message *message = new MTProto::Message();
+    message->messageId = m_sendHelper->newMessageId(SendMode::Client);
+    message->sequenceNumber = getNextSequenceNumber(operation->isContentRelated());
+
+    const bool withInitConnection = message->sequenceNumber == 1;
+    message->setData(getRequestMessageData(operation, withInitConnection));
+    if (withInitConnection) {
+        m_initConnectionMessageId = message->messageId;
     }
-    m_operations.insert(message->messageId, operation);
-    m_messages.insert(message->messageId, message);
-    sendPacket(*message);
+    addSentMessage(message, operation);
+    enqueueMessage(message->messageId);
     return message->messageId;
 }
 
 bool RpcLayer::resendIgnoredMessage(quint64 messageId)
 {
-    MTProto::Message *message = m_messages.take(messageId);
+    MTProto::Message *message = takeMessageBody(messageId);
     PendingRpcOperation *operation = m_operations.take(messageId);
+    m_messageStates.remove(messageId);
+    m_inFlightMessages.remove(messageId);
     if (!operation) {
         qCCritical(c_clientRpcLayerCategory) << CALL_INFO
                                              << "Unable to find the message to resend"
@@ -329,32 +652,176 @@ bool RpcLayer::resendIgnoredMessage(quint64 messageId)
         delete message;
         return false;
     }
+    if (!message) {
+        // The body is released from the retransmission buffer
+        message = new MTProto::Message();
+        message->sequenceNumber = getNextSequenceNumber(operation->isContentRelated());
+        message->setData(getRequestMessageData(operation, messageId == m_initConnectionMessageId));
+    }
     qCDebug(c_clientRpcLayerCategory) << "Resend message"
                                       << hex << messageId
                                       << message->firstValue();
     message->messageId = m_sendHelper->newMessageId(SendMode::Client);
-    m_operations.insert(message->messageId, operation);
-    m_messages.insert(message->messageId, message);
-    sendPacket(*message);
+    if (messageId == m_initConnectionMessageId) {
+        m_initConnectionMessageId = message->messageId;
+    }
+    addSentMessage(message, operation);
+    enqueueMessage(message->messageId);
     emit operation->resent(messageId, message->messageId);
     return message->messageId;
 }
 
+void RpcLayer::flushSendQueue()
+{
+    m_flushScheduled = false;
+
+    QVector<const MTProto::Message *> messages;
+    messages.reserve(m_sendQueue.count() + 1);
+    for (quint64 messageId : m_sendQueue) {
+        const MTProto::Message *message = m_messages.value(messageId);
+        if (message) {
+            messages.append(message);
+        }
+    }
+    m_sendQueue.clear();
+    if (messages.isEmpty()) {
+        return;
+    }
+
+    // The acks go last, because the ack message id is the newest one
+    MTProto::Message ackMessage;
+    if (!m_messagesToAck.isEmpty()) {
+        ackMessage = takeAckMessage();
+        messages.append(&ackMessage);
+    }
+
+    int begin = 0;
+    while (begin < messages.count()) {
+        int end = begin + 1;
+        int size = MTProto::MessageHeader::headerLength + messages.at(begin)->dataSize;
+        while ((end < messages.count()) && (end - begin < ContainerMaxMessages)) {
+            const int nextSize = size + MTProto::MessageHeader::headerLength + messages.at(end)->dataSize;
+            if (nextSize > ContainerMaxSize) {
+                break;
+            }
+            size = nextSize;
+            ++end;
+        }
+        sendMessages(messages.constData() + begin, end - begin);
+        begin = end;
+    }
+    trimRetransmissionBuffer();
+}
+
 void RpcLayer::acknowledgeMessages()
+{
+    // The acks are not acknowledged, so the messages are not kept
+    while (!m_messagesToAck.isEmpty()) {
+        sendPacket(takeAckMessage());
+    }
+}
+
+MTProto::Message RpcLayer::takeAckMessage()
 {
     MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
-    TLVector<quint64> idsVector = m_messagesToAck;
-    m_messagesToAck.clear();
+    TLVector<quint64> idsVector;
+    if (m_messagesToAck.count() > AckMaxMessages) {
+        idsVector = m_messagesToAck.mid(0, AckMaxMessages);
+        m_messagesToAck.remove(0, AckMaxMessages);
+    } else {
+        idsVector = m_messagesToAck;
+        m_messagesToAck.clear();
+        m_ackTimer->stop();
+    }
     outputStream << TLValue::MsgsAck;
     outputStream << idsVector;
 
-    MTProto::Message *message = new MTProto::Message();
-    message->messageId = m_sendHelper->newMessageId(SendMode::Client);
-    message->sequenceNumber = m_contentRelatedMessages * 2;
-    message->setData(outputStream.getData());
+    MTProto::Message message;
+    message.messageId = m_sendHelper->newMessageId(SendMode::Client);
+    message.sequenceNumber = m_contentRelatedMessages * 2;
+    message.setData(outputStream.getData());
 
-    m_messages.insert(message->messageId, message);
-    sendPacket(*message);
+    // The server can ignore the msgs_ack (or its container), so the ids are kept for a while
+    m_sentAcks.insert(message.messageId, idsVector);
+    if (m_sentAcks.count() > c_trackedContainersLimit) {
+        m_sentAcks.erase(m_sentAcks.begin());
+    }
+    return message;
+}
+
+bool RpcLayer::restoreAcks(quint64 ackMessageId)
+{
+    const QVector<quint64> ids = m_sentAcks.take(ackMessageId);
+    if (ids.isEmpty()) {
+        return false;
+    }
+    qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Restore" << ids.count() << "acks of the ignored message"
+                                      << hex << showbase << ackMessageId;
+    m_messagesToAck = ids + m_messagesToAck;
+    if (m_messagesToAck.count() >= m_ackThreshold) {
+        m_ackTimer->start(0);
+    } else if (!m_ackTimer->isActive()) {
+        m_ackTimer->start(m_ackDelay);
+    }
+    return true;
+}
+
+void RpcLayer::enqueueMessage(quint64 messageId)
+{
+    if (!m_messageContainersEnabled) {
+        sendPacket(*m_messages.value(messageId));
+        trimRetransmissionBuffer();
+        return;
+    }
+    m_sendQueue.append(messageId);
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+        QMetaObject::invokeMethod(this, &RpcLayer::flushSendQueue, Qt::QueuedConnection);
+#else
+        QMetaObject::invokeMethod(this, "flushSendQueue", Qt::QueuedConnection);
+#endif
+    }
+}
+
+bool RpcLayer::sendMessages(const MTProto::Message *const *messages, int count)
+{
+    if (count == 1) {
+        return sendPacket(*messages[0]);
+    }
+
+    // https://core.telegram.org/mtproto/service_messages#simple-container
+    int containerSize = MTProto::serializedSize(TLValue(TLValue::MsgContainer)) + MTProto::serializedSize(quint32(count));
+    for (int i = 0; i < count; ++i) {
+        containerSize += MTProto::MessageHeader::headerLength + messages[i]->dataSize;
+    }
+    MTProto::Stream output(MTProto::Stream::WriteOnly, static_cast<quint32>(containerSize));
+    output << TLValue::MsgContainer;
+    output << quint32(count);
+    QVector<quint64> messageIds;
+    messageIds.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const MTProto::Message *message = messages[i];
+        MTProto::MessageHeader header = *message;
+        header.contentLength = static_cast<quint32>(message->dataSize);
+        output << header;
+        output.writeBytes(message->content());
+        messageIds.append(message->messageId);
+    }
+
+    // The container is not content related and its id is newer than the ids of the messages
+    MTProto::Message container;
+    container.messageId = m_sendHelper->newMessageId(SendMode::Client);
+    container.sequenceNumber = m_contentRelatedMessages * 2;
+    container.setData(output.getData());
+    qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Send" << count << "messages in the container"
+                                      << hex << showbase << container.messageId;
+
+    m_containers.insert(container.messageId, messageIds);
+    if (m_containers.count() > c_trackedContainersLimit) {
+        m_containers.erase(m_containers.begin());
+    }
+    return sendPacket(container);
 }
 
 void RpcLayer::onConnectionLost(const QVariantHash &details)
@@ -365,8 +832,126 @@ void RpcLayer::onConnectionLost(const QVariantHash &details)
         }
     }
     m_operations.clear();
+    for (RpcQueue &queue : m_queuedRpcs) {
+        const RpcQueue operations = queue;
+        queue.clear();
+        for (const QPointer<PendingRpcOperation> &op : operations) {
+            if (op) {
+                op->setFinishedWithError(details);
+            }
+        }
+    }
+    m_inFlightMessages.clear();
     qDeleteAll(m_messages);
     m_messages.clear();
+    m_messageStates.clear();
+    m_messagesBytes = 0;
+    m_initConnectionMessageId = 0;
+    m_sendQueue.clear();
+    m_containers.clear();
+    // The acks belong to the lost connection
+    m_ackTimer->stop();
+    m_messagesToAck.clear();
+    m_sentAcks.clear();
+}
+
+quint32 RpcLayer::getNextSequenceNumber(bool contentRelated)
+{
+    if (contentRelated) {
+        ++m_contentRelatedMessages;
+        return m_contentRelatedMessages * 2 - 1;
+    }
+    if (m_contentRelatedMessages == 0) {
+        qCCritical(c_clientRpcLayerCategory) << CALL_INFO
+                                             << "First message should be content related!";
+    }
+    return m_contentRelatedMessages * 2;
+}
+
+void RpcLayer::addSentMessage(MTProto::Message *message, PendingRpcOperation *operation)
+{
+    m_operations.insert(message->messageId, operation);
+    if (operation->isContentRelated()) {
+        m_inFlightMessages.insert(message->messageId);
+    }
+    m_messages.insert(message->messageId, message);
+    m_messageStates.insert(message->messageId, MessageState::Sent);
+    m_messagesBytes += message->dataSize;
+}
+
+void RpcLayer::acknowledgeSentMessage(quint64 messageId)
+{
+    QHash<quint64, MessageState>::iterator it = m_messageStates.find(messageId);
+    if (it == m_messageStates.end() || it.value() != MessageState::Sent) {
+        return;
+    }
+    it.value() = MessageState::Acked;
+    delete takeMessageBody(messageId);
+}
+
+void RpcLayer::releaseSentMessage(quint64 messageId)
+{
+    m_messageStates.remove(messageId);
+    delete takeMessageBody(messageId);
+}
+
+MTProto::Message *RpcLayer::takeMessageBody(quint64 messageId)
+{
+    MTProto::Message *message = m_messages.take(messageId);
+    if (message) {
+        m_messagesBytes -= message->dataSize;
+    }
+    return message;
+}
+
+void RpcLayer::trimRetransmissionBuffer()
+{
+    // The message ids grow with the time, so the first messages are the oldest ones
+    while ((m_messagesBytes > RetransmissionBufferMaxBytes) && !m_messages.isEmpty()) {
+        qCDebug(c_clientRpcLayerCategory) << CALL_INFO << "Release the body of the message"
+                                          << hex << showbase << m_messages.firstKey();
+        delete takeMessageBody(m_messages.firstKey());
+    }
+}
+
+void RpcLayer::addReceivedMessage(quint64 messageId)
+{
+    // The ids are kept in the receive order; the old half goes away at once
+    if (m_receivedMessages.count() >= c_receivedMessagesLimit * 2) {
+        m_receivedMessages.remove(0, c_receivedMessagesLimit);
+    }
+    m_receivedMessages.append(messageId);
+}
+
+QByteArray RpcLayer::getMessagesState(const QVector<quint64> &messageIds) const
+{
+    quint64 minId = 0;
+    quint64 maxId = 0;
+    if (!m_receivedMessages.isEmpty()) {
+        const auto minMax = std::minmax_element(m_receivedMessages.cbegin(), m_receivedMessages.cend());
+        minId = *minMax.first;
+        maxId = *minMax.second;
+    }
+
+    QByteArray info(messageIds.count(), Qt::Uninitialized);
+    for (int i = 0; i < messageIds.count(); ++i) {
+        const quint64 messageId = messageIds.at(i);
+        char state = NothingIsKnown;
+        if (m_receivedMessages.contains(messageId)) {
+            state = Received;
+            if (!m_messagesToAck.contains(messageId)) {
+                state |= AckReceived;
+            }
+        } else if (m_receivedMessages.isEmpty() || (messageId < minId)) {
+            state = NothingIsKnown;
+        } else if (messageId > maxId) {
+            state = NotReceivedYet;
+        } else {
+            state = NotReceivedInRange;
+        }
+        info[i] = state;
+    }
+    return info;
 }
 
 QByteArray RpcLayer::getInitConnection() const
@@ -390,16 +975,67 @@ QByteArray RpcLayer::getInitConnection() const
     return outputStream.getData();
 }
 
-void RpcLayer::addMessageToAck(quint64 messageId)
+QByteArray RpcLayer::getRequestMessageData(const PendingRpcOperation *operation, bool withInitConnection)
 {
-    if (m_messagesToAck.isEmpty()) {
-#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
-        QMetaObject::invokeMethod(this, &RpcLayer::acknowledgeMessages, Qt::QueuedConnection);
-#else
-        QMetaObject::invokeMethod(this, "acknowledgeMessages", Qt::QueuedConnection);
-#endif
+    // We have to add InitConnection here because
+    // sendPackage() implementation is shared with server
+    if (withInitConnection) {
+        return getInitConnection() + operation->requestData();
+    }
+    return packRequest(operation->requestData());
+}
+
+QByteArray RpcLayer::packRequest(const QByteArray &request)
+{
+    if ((compressionLevel() == 0) || (request.size() < RequestCompressionMinSize)) {
+        return request;
+    }
+    const TLValue method = TLValue::firstFromArray(request);
+    RequestCompressionStatistics &statistics = m_requestCompressionStatistics[method];
+    if ((statistics.packedCount + statistics.rawCount >= c_compressionProbeRequests)
+            && (statistics.packedBytes * 10 > statistics.probedBytes * 9)) {
+        // The method requests do not pay off the compression; probe them again from time to time
+        if (++statistics.skippedSinceProbe < c_compressionReprobeInterval) {
+            ++statistics.rawCount;
+            return request;
+        }
+        statistics.probedBytes = 0;
+        statistics.packedBytes = 0;
+    }
+    statistics.skippedSinceProbe = 0;
+
+    if (estimateEntropy(request) > c_incompressibleEntropy) {
+        ++statistics.rawCount;
+        return request;
     }
+
+    const QByteArray packedRequest = Utils::packGZip(request, compressionLevel());
+    statistics.probedBytes += static_cast<quint64>(request.size());
+    statistics.packedBytes += static_cast<quint64>(packedRequest.size());
+
+    const int packedSize = MTProto::serializedSize(TLValue(TLValue::GzipPacked))
+            + MTProto::serializedSize(packedRequest);
+    if (packedSize >= request.size()) {
+        qCDebug(c_clientRpcDumpPackageCategory) << "It makes no sense to gzip the request" << method.toString();
+        ++statistics.rawCount;
+        return request;
+    }
+    ++statistics.packedCount;
+    MTProto::Stream output(RawStream::WriteOnly, static_cast<quint32>(packedSize));
+    output << TLValue::GzipPacked;
+    output << packedRequest;
+    return output.getData();
+}
+
+void RpcLayer::addMessageToAck(quint64 messageId)
+{
+    // The acks wait for an outgoing packet to go with; the timer sends them alone
     m_messagesToAck.append(messageId);
+    if (m_messagesToAck.count() >= m_ackThreshold) {
+        m_ackTimer->start(0); // After the processing of the current packet
+    } else if (!m_ackTimer->isActive()) {
+        m_ackTimer->start(m_ackDelay);
+    }
 }
 
 } // Client namespace
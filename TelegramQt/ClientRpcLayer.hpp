@@ -19,16 +19,24 @@
 #define TELEGRAM_CLIENT_RPC_HPP
 
 #include "RpcLayer.hpp"
+#include "PendingRpcOperation.hpp"
 
 #include <QHash>
+#include <QMap>
+#include <QPointer>
+#include <QQueue>
+#include <QSet>
 #include <QVector>
 
+QT_FORWARD_DECLARE_CLASS(QTimer)
+
 class CTelegramStream;
 
 namespace Telegram {
 
 namespace MTProto {
 
+struct IgnoredMessageNotification;
 struct Message;
 
 } // MTProto namespace
@@ -37,10 +45,9 @@ namespace Client {
 
 class AppInformation;
 class AuthOperation;
-class PendingRpcOperation;
 class UpdatesInternalApi;
 
-class RpcLayer : public Telegram::BaseRpcLayer
+class TELEGRAMQT_INTERNAL_EXPORT RpcLayer : public Telegram::BaseRpcLayer
 {
     Q_OBJECT
 public:
@@ -66,35 +73,139 @@ public:
     bool processRpcResult(const MTProto::Message &message);
     bool processUpdates(const MTProto::Message &message);
     bool processMessageAck(const MTProto::Message &message);
-
+    bool processMessagesStateRequest(const MTProto::Message &message);
+    bool processResendRequest(const MTProto::Message &message);
+
+    // The sent RPC messages are kept until the answer. The message body is kept
+    // for a resend until the ack (or the answer) and the bodies of the oldest
+    // messages are released if the buffer exceeds the limit.
+    enum class MessageState : quint8 {
+        Unknown, // Not sent or already answered
+        Sent,
+        Acked,
+    };
+    static constexpr int RetransmissionBufferMaxBytes = 1024 * 1024;
+    MessageState messageState(quint64 messageId) const { return m_messageStates.value(messageId, MessageState::Unknown); }
+    int retransmissionBufferCount() const { return m_messages.count(); }
+    int retransmissionBufferBytes() const { return m_messagesBytes; }
+
+    // The RPCs sent during one event loop iteration go in a msg_container
+    // (with the pending acks) on the next iteration or on flushSendQueue()
+    static constexpr int ContainerMaxMessages = 64;
+    static constexpr int ContainerMaxSize = 32 * 1024;
+    bool isMessageContainersEnabled() const { return m_messageContainersEnabled; }
+    void setMessageContainersEnabled(bool enabled);
+
+    // The requests starting from RequestCompressionMinSize bytes are sent in
+    // gzip_packed with the compressionLevel() unless the data looks incompressible
+    // or the compression of the method requests does not pay off
+    struct RequestCompressionStatistics {
+        quint32 packedCount = 0;
+        quint32 rawCount = 0; // the requests above the threshold sent as is
+        quint64 probedBytes = 0; // the requests passed to gzip
+        quint64 packedBytes = 0; // the gzip output
+        quint32 skippedSinceProbe = 0;
+    };
+    static constexpr int RequestCompressionMinSize = 256;
+    RequestCompressionStatistics requestCompressionStatistics(quint32 method) const
+    {
+        return m_requestCompressionStatistics.value(method);
+    }
+
+    // The acks go with the next outgoing RPCs. A packet with the acks alone is sent
+    // after the ackDelay() (in ms) or once ackThreshold() messages wait for the ack.
+    static constexpr int AckMaxMessages = 8192; // The ids limit of a msgs_ack
+    int ackDelay() const { return m_ackDelay; }
+    void setAckDelay(int msec);
+    int ackThreshold() const { return m_ackThreshold; }
+    void setAckThreshold(int count);
+    int pendingAcksCount() const { return m_messagesToAck.count(); }
+
+    // The content related RPCs wait in the queue of their priority once the number of
+    // the unanswered RPCs reaches the window limit (there is no limit for the zero window).
+    // The normal RPCs keep a quarter of the window for the interactive ones and the bulk
+    // RPCs take only the half of the window when no other RPCs wait.
+    using Priority = PendingRpcOperation::Priority;
+    static constexpr int DefaultInFlightWindow = 64;
+    int inFlightWindow() const { return m_inFlightWindow; }
+    void setInFlightWindow(int window);
+    int inFlightCount() const { return m_inFlightMessages.count(); }
+    int queuedRpcCount() const;
+    Priority methodPriority(quint32 method) const;
+    void setMethodPriority(quint32 method, Priority priority); // Priority::Default resets the method priority
+
+    // Returns zero for the queued RPCs; the message id is assigned on the actual send
     quint64 sendRpc(PendingRpcOperation *operation);
     bool resendIgnoredMessage(quint64 messageId);
 
     void onConnectionLost(const QVariantHash &details) override;
 
-protected Q_SLOTS:
+public Q_SLOTS:
+    void flushSendQueue();
     void acknowledgeMessages();
 
 protected:
     bool processMessageHeader(const MTProto::FullMessageHeader &header) override;
-    Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const final { return generateServerToClientAesKey(messageKey); }
-    Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const final { return generateClientToServerAesKey(messageKey); }
-
-    QByteArray getEncryptionKeyPart() const final;
-    QByteArray getVerificationKeyPart() const final;
+    MessageDirection outgoingDirection() const final { return ClientToServer; }
 
     QByteArray getInitConnection() const;
+    QByteArray packRequest(const QByteArray &request);
+    QByteArray getRequestMessageData(const PendingRpcOperation *operation, bool withInitConnection);
 
     void addMessageToAck(quint64 messageId);
+    MTProto::Message takeAckMessage();
+    bool restoreAcks(quint64 ackMessageId);
+
+    static bool canResendIgnoredMessage(quint32 errorCode);
+    void finishIgnoredMessage(const MTProto::IgnoredMessageNotification &notification);
+
+    static constexpr int PrioritiesCount = static_cast<int>(Priority::Default);
+    Priority getPriority(const PendingRpcOperation *operation) const;
+    int getWindowLimit(Priority priority) const;
+    bool hasWindowRoom(Priority priority) const;
+    bool canSendRpc(Priority priority);
+    quint64 sendRpcMessage(PendingRpcOperation *operation);
+    void sendQueuedRpcs();
+
+    void enqueueMessage(quint64 messageId);
+    bool sendMessages(const MTProto::Message *const *messages, int count);
+
+    quint32 getNextSequenceNumber(bool contentRelated);
+    void addSentMessage(MTProto::Message *message, PendingRpcOperation *operation);
+    void acknowledgeSentMessage(quint64 messageId);
+    void releaseSentMessage(quint64 messageId);
+    MTProto::Message *takeMessageBody(quint64 messageId);
+    void trimRetransmissionBuffer();
+
+    void addReceivedMessage(quint64 messageId);
+    QByteArray getMessagesState(const QVector<quint64> &messageIds) const;
 
     AppInformation *m_appInfo = nullptr;
     UpdatesInternalApi *m_UpdatesInternalApi = nullptr;
     AuthOperation *m_pendingAuthOperation = nullptr;
     QHash<quint64, PendingRpcOperation*> m_operations; // request message id, operation
-    QHash<quint64, MTProto::Message*> m_messages; // request message id to MTProto::Message
+    QSet<quint64> m_inFlightMessages; // the unanswered content related RPCs
+    using RpcQueue = QQueue<QPointer<PendingRpcOperation>>; // the deleted operations become null
+    RpcQueue m_queuedRpcs[PrioritiesCount];
+    QHash<quint32, Priority> m_methodPriorities; // method to the priority set by the user
+    int m_inFlightWindow = DefaultInFlightWindow;
+    QMap<quint64, MTProto::Message*> m_messages; // request message id to the body (the retransmission buffer)
+    QHash<quint64, MessageState> m_messageStates;
+    int m_messagesBytes = 0;
+    quint64 m_initConnectionMessageId = 0; // the message that carries initConnection
+    QVector<quint64> m_receivedMessages; // the last received message ids
+    QHash<quint32, RequestCompressionStatistics> m_requestCompressionStatistics; // method to statistics
     quint64 m_sessionId = 0;
     quint64 m_serverSalt = 0;
     QVector<quint64> m_messagesToAck;
+    QMap<quint64, QVector<quint64>> m_sentAcks; // the last msgs_ack ids to the acknowledged ids
+    QTimer *m_ackTimer = nullptr;
+    int m_ackDelay;
+    int m_ackThreshold;
+    QVector<quint64> m_sendQueue; // message ids
+    QMap<quint64, QVector<quint64>> m_containers; // the last containers ids to the message ids
+    bool m_messageContainersEnabled = true;
+    bool m_flushScheduled = false;
 };
 
 } // Client namespace
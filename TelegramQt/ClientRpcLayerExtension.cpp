@@ -45,22 +45,28 @@ void BaseRpcLayerExtension::prepareReplyStream(MTProto::Stream *stream,
     // replace it with a processReply() reimpl with type-specific code
     // (check for TLType::isValid() and call this method)
 
-    QByteArray data = operation->replyData();
-
-    if (data.size() > 4) {
-        if (TLValue::firstFromArray(data) == TLValue::GzipPacked) {
-            MTProto::Stream packedStream(data);
-            TLValue gzipValue;
-            packedStream >> gzipValue;
-            packedStream >> data;
-            data = Utils::unpackGZip(data);
-        }
+    // The reply is a span of the packet data, so the stream reads it without a copy
+    const QByteArray &buffer = operation->replyBuffer();
+    const int offset = operation->replyOffset();
+    const int size = operation->replySize();
+
+    const QByteArray reply = QByteArray::fromRawData(buffer.constData() + offset, size);
+    if ((size > 4) && (TLValue::firstFromArray(reply) == TLValue::GzipPacked)) {
+        MTProto::Stream packedStream(buffer, offset, size);
+        TLValue gzipValue;
+        QByteArray data;
+        packedStream >> gzipValue;
+        packedStream >> data;
+        // The unpacked data lives only as long as the stream
+        stream->setBytesSharingEnabled(false);
+        stream->setData(Utils::unpackGZip(data));
+    } else {
+        stream->setData(buffer, offset, size);
     }
 #ifdef DUMP_CLIENT_RPC_PACKETS
     qCDebug(c_clientRpcLayerExtensionCategory).noquote() << "BaseRpcLayerExtension: RPC Reply bytes:"
-                                                         << data.size() << data.toHex();
+                                                         << stream->getData().size() << stream->getData().toHex();
 #endif
-    stream->setData(data);
 }
 
 void BaseRpcLayerExtension::setRpcProcessingMethod(RpcProcessingMethod sendMethod)
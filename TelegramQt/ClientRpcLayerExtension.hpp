@@ -50,6 +50,10 @@ public:
 
     template <typename TLType>
     bool processReply(PendingRpcOperation *operation, TLType *output);
+    // The bytes members of the output reference the reply data of the operation,
+    // so the output must not outlive the operation result
+    template <typename TLType>
+    bool processReplySharingBytes(PendingRpcOperation *operation, TLType *output);
 
     void prepareReplyStream(MTProto::Stream *stream, PendingRpcOperation *operation);
 
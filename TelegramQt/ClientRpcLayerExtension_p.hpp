@@ -54,6 +54,16 @@ bool BaseRpcLayerExtension::processReply(PendingRpcOperation *operation, TLType
     return output->isValid() && !stream.error();
 }
 
+template <typename TLType>
+bool BaseRpcLayerExtension::processReplySharingBytes(PendingRpcOperation *operation, TLType *output)
+{
+    MTProto::Stream stream;
+    stream.setBytesSharingEnabled(true);
+    prepareReplyStream(&stream, operation);
+    stream >> *output;
+    return output->isValid() && !stream.error();
+}
+
 } // Client namespace
 
 } // Telegram namespace
@@ -21,6 +21,8 @@ public:
         None,
         Abridged,
         Obfuscated,
+        Intermediate,
+        PaddedIntermediate,
     };
     Q_ENUM(SessionType)
 
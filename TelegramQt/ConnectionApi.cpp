@@ -9,12 +9,14 @@
 #include "ConnectionError.hpp"
 #include "DataStorage.hpp"
 #include "Debug_p.hpp"
+#include "LoopbackTransport.hpp"
 
 #include "Operations/ClientAuthOperation_p.hpp"
 #include "Operations/ClientPingOperation.hpp"
 #include "Operations/ConnectionOperation.hpp"
 #include "RpcLayers/ClientRpcAuthLayer.hpp"
 
+#include <QLocalSocket>
 #include <QLoggingCategory>
 #include <QTimer>
 
@@ -421,21 +423,16 @@ ConnectOperation *ConnectionApiPrivate::connectToExtraDc(const ConnectionSpec &c
     return m_connectionOperations.value(connectionSpec);
 }
 
-/*!
-  The method constructs new Connection ready to connect to the passed server address.
-*/
-Connection *ConnectionApiPrivate::createConnection(const DcOption &dcOption)
+TcpTransport *ConnectionApiPrivate::createTcpTransport(Connection *connection)
 {
-    Connection *connection = new Connection(this);
-    connection->setDcOption(dcOption);
-    connection->rpcLayer()->setAppInformation(backend()->m_appInformation);
-    connection->rpcLayer()->installUpdatesHandler(backend()->updatesApi());
-    connection->setDeltaTime(backend()->accountStorage()->deltaTime());
-
     Settings *settings = backend()->m_settings;
-    connection->setServerRsaKey(settings->serverRsaKey());
-    TcpTransport *transport = new TcpTransport(connection);
-    transport->setProxy(settings->proxy());
+    TcpTransport *transport = nullptr;
+    if (TcpTransport::isLocalSocketAddress(connection->dcOption().address)) {
+        transport = new TcpTransport(new QLocalSocket(), connection);
+    } else {
+        transport = new TcpTransport(connection);
+        transport->setProxy(settings->proxy());
+    }
 
     switch (settings->preferedSessionType()) {
     case Settings::SessionType::None:
@@ -449,8 +446,34 @@ Connection *ConnectionApiPrivate::createConnection(const DcOption &dcOption)
     case Settings::SessionType::Obfuscated:
         transport->setPreferedSessionType(TcpTransport::Obfuscated);
         break;
+    case Settings::SessionType::Intermediate:
+        transport->setPreferedSessionType(TcpTransport::Intermediate);
+        break;
+    case Settings::SessionType::PaddedIntermediate:
+        transport->setPreferedSessionType(TcpTransport::PaddedIntermediate);
+        break;
+    }
+    return transport;
+}
+
+/*!
+  The method constructs new Connection ready to connect to the passed server address.
+*/
+Connection *ConnectionApiPrivate::createConnection(const DcOption &dcOption)
+{
+    Connection *connection = new Connection(this);
+    connection->setDcOption(dcOption);
+    connection->rpcLayer()->setAppInformation(backend()->m_appInformation);
+    connection->rpcLayer()->installUpdatesHandler(backend()->updatesApi());
+    connection->setDeltaTime(backend()->accountStorage()->deltaTime());
+
+    Settings *settings = backend()->m_settings;
+    connection->setServerRsaKey(settings->serverRsaKey());
+    if (LoopbackTransport::isLoopbackAddress(dcOption.address)) {
+        connection->setTransport(new LoopbackTransport(connection));
+    } else {
+        connection->setTransport(createTcpTransport(connection));
     }
-    connection->setTransport(transport);
 
     connect(connection, &BaseConnection::statusChanged,
             this, [this, connection] (BaseConnection::Status status, BaseConnection::StatusReason reason) {
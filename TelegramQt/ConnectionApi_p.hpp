@@ -34,6 +34,7 @@ namespace Client {
 
 class Connection;
 class ConnectOperation;
+class TcpTransport;
 class PingOperation;
 class BasePendingRpcResult;
 
@@ -68,6 +69,7 @@ public:
     ConnectOperation *connectToExtraDc(const ConnectionSpec &connectionSpec);
 
     Connection *createConnection(const DcOption &dcOption);
+    TcpTransport *createTcpTransport(Connection *connection);
     Connection *ensureConnection(const ConnectionSpec &connectionSpec);
 //    Connection *ensureConnection2(const ConnectionSpec &connectionSpec);
     void ensureConnected(Connection *connection);
@@ -4,38 +4,391 @@
 
 #include <QLoggingCategory>
 
+#if defined(Q_PROCESSOR_X86) && defined(Q_CC_GNU)
+#define TELEGRAMQT_AES_NI
+#include <wmmintrin.h>
+#endif
+
 namespace Telegram {
 
 namespace Crypto {
 
+static_assert(AesKey::IvSize == AES_BLOCK_SIZE * 2, "IGE needs two IV blocks");
+
+AesKey::AesKey(const QByteArray &initialKey, const QByteArray &initialIV)
+{
+    if ((initialKey.size() != KeySize) || (initialIV.size() != IvSize)) {
+        qCritical() << __func__ << "Invalid key or iv size" << initialKey.size() << initialIV.size();
+    }
+    memcpy(key, initialKey.constData(), static_cast<size_t>(qMin<int>(initialKey.size(), KeySize)));
+    memcpy(iv, initialIV.constData(), static_cast<size_t>(qMin<int>(initialIV.size(), IvSize)));
+}
+
+static inline void xorBlock(uchar *out, const uchar *a, const uchar *b)
+{
+    for (int i = 0; i < AES_BLOCK_SIZE; ++i) {
+        out[i] = a[i] ^ b[i];
+    }
+}
+
+// IGE: c[i] = E(p[i] ^ c[i-1]) ^ p[i-1]; p[i] = D(c[i] ^ p[i-1]) ^ c[i-1]
+// The iv is c[-1] followed by p[-1] (the same layout as in OpenSSL AES_ige_encrypt()).
+static void aesIgeEncryptPortable(uchar *data, int size, const AesKey &key)
+{
+    AES_KEY encKey;
+    AES_set_encrypt_key(reinterpret_cast<const uchar *>(key.key), AesKey::KeySize * 8, &encKey);
+    uchar prevCipher[AES_BLOCK_SIZE];
+    uchar prevPlain[AES_BLOCK_SIZE];
+    uchar plain[AES_BLOCK_SIZE];
+    memcpy(prevCipher, key.iv, AES_BLOCK_SIZE);
+    memcpy(prevPlain, key.iv + AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+    for (uchar *block = data; block < data + size; block += AES_BLOCK_SIZE) {
+        memcpy(plain, block, AES_BLOCK_SIZE);
+        xorBlock(block, plain, prevCipher);
+        AES_encrypt(block, block, &encKey);
+        xorBlock(block, block, prevPlain);
+        memcpy(prevCipher, block, AES_BLOCK_SIZE);
+        memcpy(prevPlain, plain, AES_BLOCK_SIZE);
+    }
+}
+
+static void aesIgeDecryptPortable(uchar *data, int size, const AesKey &key)
+{
+    AES_KEY decKey;
+    AES_set_decrypt_key(reinterpret_cast<const uchar *>(key.key), AesKey::KeySize * 8, &decKey);
+    uchar prevCipher[AES_BLOCK_SIZE];
+    uchar prevPlain[AES_BLOCK_SIZE];
+    uchar cipher[AES_BLOCK_SIZE];
+    memcpy(prevCipher, key.iv, AES_BLOCK_SIZE);
+    memcpy(prevPlain, key.iv + AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+    for (uchar *block = data; block < data + size; block += AES_BLOCK_SIZE) {
+        memcpy(cipher, block, AES_BLOCK_SIZE);
+        xorBlock(block, cipher, prevPlain);
+        AES_decrypt(block, block, &decKey);
+        xorBlock(block, block, prevCipher);
+        memcpy(prevPlain, block, AES_BLOCK_SIZE);
+        memcpy(prevCipher, cipher, AES_BLOCK_SIZE);
+    }
+}
+
+#ifdef TELEGRAMQT_AES_NI
+
+#define TELEGRAMQT_AES_NI_TARGET __attribute__((target("aes,sse2")))
+
+TELEGRAMQT_AES_NI_TARGET
+static inline __m128i aes256ExpandEven(__m128i previous, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    previous = _mm_xor_si128(previous, _mm_slli_si128(previous, 4));
+    previous = _mm_xor_si128(previous, _mm_slli_si128(previous, 8));
+    return _mm_xor_si128(previous, assist);
+}
+
+TELEGRAMQT_AES_NI_TARGET
+static inline __m128i aes256ExpandOdd(__m128i even, __m128i previous)
+{
+    const __m128i assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(even, 0x00), 0xaa);
+    previous = _mm_xor_si128(previous, _mm_slli_si128(previous, 4));
+    previous = _mm_xor_si128(previous, _mm_slli_si128(previous, 8));
+    return _mm_xor_si128(previous, assist);
+}
+
+#define TELEGRAMQT_AES256_EXPAND_ROUND(index, rcon) \
+    schedule[index] = aes256ExpandEven(schedule[index - 2], _mm_aeskeygenassist_si128(schedule[index - 1], rcon)); \
+    schedule[index + 1] = aes256ExpandOdd(schedule[index], schedule[index - 1]);
+
+TELEGRAMQT_AES_NI_TARGET
+static void aes256ExpandEncryptionKey(const char *key, __m128i *schedule)
+{
+    schedule[0] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key));
+    schedule[1] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key + 16));
+    TELEGRAMQT_AES256_EXPAND_ROUND(2, 0x01)
+    TELEGRAMQT_AES256_EXPAND_ROUND(4, 0x02)
+    TELEGRAMQT_AES256_EXPAND_ROUND(6, 0x04)
+    TELEGRAMQT_AES256_EXPAND_ROUND(8, 0x08)
+    TELEGRAMQT_AES256_EXPAND_ROUND(10, 0x10)
+    TELEGRAMQT_AES256_EXPAND_ROUND(12, 0x20)
+    schedule[14] = aes256ExpandEven(schedule[12], _mm_aeskeygenassist_si128(schedule[13], 0x40));
+}
+
+#undef TELEGRAMQT_AES256_EXPAND_ROUND
+
+TELEGRAMQT_AES_NI_TARGET
+static void aesIgeEncryptAesNi(uchar *data, int size, const AesKey &key)
+{
+    __m128i schedule[15];
+    aes256ExpandEncryptionKey(key.key, schedule);
+    __m128i prevCipher = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key.iv));
+    __m128i prevPlain = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key.iv + AES_BLOCK_SIZE));
+    for (uchar *block = data; block < data + size; block += AES_BLOCK_SIZE) {
+        const __m128i plain = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+        __m128i state = _mm_xor_si128(_mm_xor_si128(plain, prevCipher), schedule[0]);
+        for (int round = 1; round < 14; ++round) {
+            state = _mm_aesenc_si128(state, schedule[round]);
+        }
+        state = _mm_aesenclast_si128(state, schedule[14]);
+        prevCipher = _mm_xor_si128(state, prevPlain);
+        prevPlain = plain;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(block), prevCipher);
+    }
+}
+
+TELEGRAMQT_AES_NI_TARGET
+static void aesIgeDecryptAesNi(uchar *data, int size, const AesKey &key)
+{
+    __m128i encSchedule[15];
+    aes256ExpandEncryptionKey(key.key, encSchedule);
+    // The Equivalent Inverse Cipher key schedule
+    __m128i schedule[15];
+    schedule[0] = encSchedule[14];
+    for (int round = 1; round < 14; ++round) {
+        schedule[round] = _mm_aesimc_si128(encSchedule[14 - round]);
+    }
+    schedule[14] = encSchedule[0];
+
+    __m128i prevCipher = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key.iv));
+    __m128i prevPlain = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key.iv + AES_BLOCK_SIZE));
+    for (uchar *block = data; block < data + size; block += AES_BLOCK_SIZE) {
+        const __m128i cipher = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+        __m128i state = _mm_xor_si128(_mm_xor_si128(cipher, prevPlain), schedule[0]);
+        for (int round = 1; round < 14; ++round) {
+            state = _mm_aesdec_si128(state, schedule[round]);
+        }
+        state = _mm_aesdeclast_si128(state, schedule[14]);
+        prevPlain = _mm_xor_si128(state, prevCipher);
+        prevCipher = cipher;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(block), prevPlain);
+    }
+}
+
+namespace {
+
+struct AesIgeLane {
+    __m128i schedule[15];
+    __m128i prevCipher;
+    __m128i prevPlain;
+    uchar *block;
+    uchar *end;
+};
+
+} // anonymous namespace
+
+#if defined(Q_CC_CLANG)
+#define TELEGRAMQT_UNROLL_LANES _Pragma("unroll")
+#elif Q_CC_GNU >= 800
+#define TELEGRAMQT_UNROLL_LANES _Pragma("GCC unroll 4")
+#else
+#define TELEGRAMQT_UNROLL_LANES
+#endif
+
+TELEGRAMQT_AES_NI_TARGET
+static void initAesIgeLane(AesIgeLane *lane, const AesIgeBuffer &buffer)
+{
+    aes256ExpandEncryptionKey(buffer.key->key, lane->schedule);
+    lane->prevCipher = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer.key->iv));
+    lane->prevPlain = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer.key->iv + AES_BLOCK_SIZE));
+    lane->block = reinterpret_cast<uchar *>(buffer.data);
+    lane->end = lane->block + buffer.size;
+}
+
+// Encrypts the next block of each lane. The lanes are independent,
+// so the CPU pipelines their rounds instead of waiting for the previous one.
+template <int LaneCount>
+TELEGRAMQT_AES_NI_TARGET
+static void encryptAesIgeLanes(AesIgeLane *lanes)
+{
+    __m128i plain[LaneCount];
+    __m128i state[LaneCount];
+    TELEGRAMQT_UNROLL_LANES
+    for (int i = 0; i < LaneCount; ++i) {
+        plain[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes[i].block));
+        state[i] = _mm_xor_si128(_mm_xor_si128(plain[i], lanes[i].prevCipher), lanes[i].schedule[0]);
+    }
+    for (int round = 1; round < 14; ++round) {
+        TELEGRAMQT_UNROLL_LANES
+        for (int i = 0; i < LaneCount; ++i) {
+            state[i] = _mm_aesenc_si128(state[i], lanes[i].schedule[round]);
+        }
+    }
+    TELEGRAMQT_UNROLL_LANES
+    for (int i = 0; i < LaneCount; ++i) {
+        state[i] = _mm_aesenclast_si128(state[i], lanes[i].schedule[14]);
+        lanes[i].prevCipher = _mm_xor_si128(state[i], lanes[i].prevPlain);
+        lanes[i].prevPlain = plain[i];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes[i].block), lanes[i].prevCipher);
+        lanes[i].block += AES_BLOCK_SIZE;
+    }
+}
+
+#undef TELEGRAMQT_UNROLL_LANES
+
+TELEGRAMQT_AES_NI_TARGET
+static void aesIgeEncryptBatchAesNi(const AesIgeBuffer *buffers, int count)
+{
+    constexpr int c_maxLanes = 4;
+    AesIgeLane lanes[c_maxLanes];
+    int laneCount = 0;
+    int nextBuffer = 0;
+    while (true) {
+        while ((laneCount < c_maxLanes) && (nextBuffer < count)) {
+            const AesIgeBuffer &buffer = buffers[nextBuffer++];
+            if (buffer.size > 0) {
+                initAesIgeLane(&lanes[laneCount++], buffer);
+            }
+        }
+        switch (laneCount) {
+        case 4:
+            encryptAesIgeLanes<4>(lanes);
+            break;
+        case 3:
+            encryptAesIgeLanes<3>(lanes);
+            break;
+        case 2:
+            encryptAesIgeLanes<2>(lanes);
+            break;
+        case 1:
+            encryptAesIgeLanes<1>(lanes);
+            break;
+        default:
+            return;
+        }
+        // Replace the finished lanes with the last ones
+        for (int i = 0; i < laneCount;) {
+            if (lanes[i].block == lanes[i].end) {
+                lanes[i] = lanes[--laneCount];
+            } else {
+                ++i;
+            }
+        }
+    }
+}
+
+#undef TELEGRAMQT_AES_NI_TARGET
+
+static bool hasAesNi()
+{
+    static const bool supported = __builtin_cpu_supports("aes") && __builtin_cpu_supports("sse2");
+    return supported;
+}
+#endif // TELEGRAMQT_AES_NI
+
+bool isAesIgeEngineSupported(AesIgeEngine engine)
+{
+    switch (engine) {
+    case AesIgeEngine::Auto:
+    case AesIgeEngine::Portable:
+        return true;
+    case AesIgeEngine::AesNi:
+#ifdef TELEGRAMQT_AES_NI
+        return hasAesNi();
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+static AesIgeEngine getAesIgeEngine(AesIgeEngine engine)
+{
+    if (engine == AesIgeEngine::Auto) {
+        return isAesIgeEngineSupported(AesIgeEngine::AesNi) ? AesIgeEngine::AesNi : AesIgeEngine::Portable;
+    }
+    return engine;
+}
+
+static bool checkAesIgeInput(const char *function, int size, AesIgeEngine engine)
+{
+    if (size % AES_BLOCK_SIZE) {
+        qCritical() << function << "Data is not padded (size %" << AES_BLOCK_SIZE << "!= 0)";
+        return false;
+    }
+    if (!isAesIgeEngineSupported(engine)) {
+        qCritical() << function << "The requested AES engine is not supported";
+        return false;
+    }
+    return true;
+}
+
+bool isAesIgeInputValid(int size, AesIgeEngine engine)
+{
+    return checkAesIgeInput(__func__, size, engine);
+}
+
+bool aesIgeDecrypt(char *data, int size, const AesKey &key, AesIgeEngine engine)
+{
+    if (!checkAesIgeInput(__func__, size, engine)) {
+        return false;
+    }
+    uchar *udata = reinterpret_cast<uchar *>(data);
+    switch (getAesIgeEngine(engine)) {
+#ifdef TELEGRAMQT_AES_NI
+    case AesIgeEngine::AesNi:
+        aesIgeDecryptAesNi(udata, size, key);
+        break;
+#endif
+    default:
+        aesIgeDecryptPortable(udata, size, key);
+        break;
+    }
+    return true;
+}
+
+bool aesIgeEncrypt(char *data, int size, const AesKey &key, AesIgeEngine engine)
+{
+    if (!checkAesIgeInput(__func__, size, engine)) {
+        return false;
+    }
+    uchar *udata = reinterpret_cast<uchar *>(data);
+    switch (getAesIgeEngine(engine)) {
+#ifdef TELEGRAMQT_AES_NI
+    case AesIgeEngine::AesNi:
+        aesIgeEncryptAesNi(udata, size, key);
+        break;
+#endif
+    default:
+        aesIgeEncryptPortable(udata, size, key);
+        break;
+    }
+    return true;
+}
+
+bool aesIgeEncryptBatch(const AesIgeBuffer *buffers, int count, AesIgeEngine engine)
+{
+    for (int i = 0; i < count; ++i) {
+        if (!checkAesIgeInput(__func__, buffers[i].size, engine)) {
+            return false;
+        }
+    }
+    switch (getAesIgeEngine(engine)) {
+#ifdef TELEGRAMQT_AES_NI
+    case AesIgeEngine::AesNi:
+        aesIgeEncryptBatchAesNi(buffers, count);
+        break;
+#endif
+    default:
+        for (int i = 0; i < count; ++i) {
+            aesIgeEncryptPortable(reinterpret_cast<uchar *>(buffers[i].data), buffers[i].size, *buffers[i].key);
+        }
+        break;
+    }
+    return true;
+}
+
 QByteArray aesDecrypt(const QByteArray &data, const AesKey &key)
 {
-    if (data.length() % AES_BLOCK_SIZE) {
-        qCritical() << __func__ << "Data is not padded (size %" << AES_BLOCK_SIZE << "!= 0)";
+    QByteArray result = data;
+    if (!aesIgeDecrypt(result.data(), result.size(), key)) {
         return QByteArray();
     }
-    QByteArray result = data;
-    QByteArray initVector = key.iv;
-    AES_KEY dec_key;
-    AES_set_decrypt_key((const uchar *) key.key.constData(), key.key.length() * 8, &dec_key);
-    AES_ige_encrypt((const uchar *) data.constData(), (uchar *) result.data(), data.length(),
-                    &dec_key, (uchar *) initVector.data(), AES_DECRYPT);
     return result;
 }
 
 QByteArray aesEncrypt(const QByteArray &data, const AesKey &key)
 {
-    if (data.length() % AES_BLOCK_SIZE) {
-        qCritical() << __func__ << "Data is not padded "
-                                   "(the size %" << AES_BLOCK_SIZE << " is not zero)";
+    QByteArray result = data;
+    if (!aesIgeEncrypt(result.data(), result.size(), key)) {
         return QByteArray();
     }
-    QByteArray result = data;
-    QByteArray initVector = key.iv;
-    AES_KEY enc_key;
-    AES_set_encrypt_key((const uchar *) key.key.constData(), key.key.length() * 8, &enc_key);
-    AES_ige_encrypt((const uchar *) data.constData(), (uchar *) result.data(), data.length(),
-                    &enc_key, (uchar *) initVector.data(), AES_ENCRYPT);
     return result;
 }
 
@@ -27,22 +27,50 @@ namespace Telegram {
 namespace Crypto {
 
 // Internal class
+// AES-256-IGE key and the two IGE vectors, stored without heap allocations.
 struct TELEGRAMQT_INTERNAL_EXPORT AesKey {
-    QByteArray key;
-    QByteArray iv;
+    static constexpr int KeySize = 32;
+    static constexpr int IvSize = 32;
+
+    char key[KeySize] = {};
+    char iv[IvSize] = {};
 
     AesKey() = default;
-    AesKey(const QByteArray &initialKey, const QByteArray &initialIV) :
-        key(initialKey), iv(initialIV) { }
-
-    AesKey &operator=(const AesKey &anotherKey)
-    {
-        key = anotherKey.key;
-        iv  = anotherKey.iv;
-        return *this;
-    }
+    AesKey(const QByteArray &initialKey, const QByteArray &initialIV);
+};
+
+enum class AesIgeEngine {
+    Auto, // The fastest engine supported by the CPU
+    Portable,
+    AesNi,
 };
 
+TELEGRAMQT_INTERNAL_EXPORT bool isAesIgeEngineSupported(AesIgeEngine engine);
+
+// In-place AES-256-IGE. The size must be divisible by the AES block size (16)
+// and the key.iv must contain the two 16 bytes IGE vectors.
+TELEGRAMQT_INTERNAL_EXPORT bool aesIgeDecrypt(char *data, int size, const AesKey &key,
+                                              AesIgeEngine engine = AesIgeEngine::Auto);
+TELEGRAMQT_INTERNAL_EXPORT bool aesIgeEncrypt(char *data, int size, const AesKey &key,
+                                              AesIgeEngine engine = AesIgeEngine::Auto);
+
+// Checks the AES-256-IGE input as the functions above and below do, without processing
+TELEGRAMQT_INTERNAL_EXPORT bool isAesIgeInputValid(int size, AesIgeEngine engine = AesIgeEngine::Auto);
+
+// A buffer of the batch encryption; each buffer has its own key
+struct AesIgeBuffer {
+    char *data = nullptr;
+    int size = 0;
+    const AesKey *key = nullptr;
+};
+
+// In-place AES-256-IGE of independent buffers. IGE is sequential within a buffer,
+// so the AES-NI engine interleaves the blocks of several buffers to pipeline the rounds.
+// A single invalid buffer fails the whole batch, so check the buffers of independent
+// packets with isAesIgeInputValid() first.
+TELEGRAMQT_INTERNAL_EXPORT bool aesIgeEncryptBatch(const AesIgeBuffer *buffers, int count,
+                                                   AesIgeEngine engine = AesIgeEngine::Auto);
+
 TELEGRAMQT_INTERNAL_EXPORT QByteArray aesDecrypt(const QByteArray &data, const AesKey &key);
 TELEGRAMQT_INTERNAL_EXPORT QByteArray aesEncrypt(const QByteArray &data, const AesKey &key);
 
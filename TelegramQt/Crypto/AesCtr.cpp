@@ -42,6 +42,9 @@ bool AesCtrContext::setKey(const QByteArray &key)
         return false;
     }
     m_key = key;
+    m_keySchedule.resize(sizeof(AES_KEY));
+    AES_KEY *aesKey = reinterpret_cast<AES_KEY *>(m_keySchedule.data());
+    AES_set_encrypt_key(reinterpret_cast<const unsigned char*>(m_key.constData()), KeySize * 8, aesKey);
     return true;
 }
 
@@ -67,27 +70,35 @@ QByteArray AesCtrContext::crypt(const QByteArray &in)
 bool AesCtrContext::crypt(const QByteArray &in, QByteArray *out)
 {
     out->resize(in.size());
-    union {
-        char *ivecData;
-        unsigned char *ivecSsl[16];
-    };
-    ivecData = m_ivec.data();
-    union {
-        char *ecountData;
-        unsigned char *ecountSsl[16];
-    };
-    ecountData = m_ecount.data();
+    return crypt(in.constData(), out->data(), in.size());
+}
+
+bool AesCtrContext::crypt(char *data, int size)
+{
+    return crypt(data, data, size);
+}
+
+bool AesCtrContext::crypt(const char *in, char *out, int size)
+{
+    if (!hasKey()) {
+        qCCritical(c_categoryCryptoAesCtr) << "AesCtrContext::crypt(): The key is not set!";
+        return false;
+    }
+    unsigned char *ivecData = reinterpret_cast<unsigned char *>(m_ivec.data());
+    unsigned char *ecountData = reinterpret_cast<unsigned char *>(m_ecount.data());
+    const AES_KEY *aesKey = reinterpret_cast<const AES_KEY *>(m_keySchedule.constData());
 
 #ifdef TELEGRAM_DEBUG_CRYPTO
-    qCDebug(c_categoryCryptoAesCtr).noquote() << QStringLiteral("Crypt 0x%1 (%2) bytes on ").arg(in.size(), 4, 16, QLatin1Char('0')).arg(in.size()) << m_description << "context" << this;
+    qCDebug(c_categoryCryptoAesCtr).noquote() << QStringLiteral("Crypt 0x%1 (%2) bytes on ").arg(size, 4, 16, QLatin1Char('0')).arg(size) << m_description << "context" << this;
     qCDebug(c_categoryCryptoAesCtr) << "Key:" << m_key.toHex() << "Ivec:" << m_ivec.toHex() << "Ecount:" << m_ecount.toHex();
+    qCDebug(c_categoryCryptoAesCtr) << "in:" << QByteArray::fromRawData(in, size).toHex();
 #endif // TELEGRAM_DEBUG_CRYPTO
-    AES_KEY aes;
-    AES_set_encrypt_key(reinterpret_cast<const unsigned char*>(m_key.constData()), 256, &aes);
-    CRYPTO_ctr128_encrypt(reinterpret_cast<const uchar*>(in.constData()), reinterpret_cast<uchar*>(out->data()), in.size(), &aes, *ivecSsl, *ecountSsl, &m_num, (block128_f) AES_encrypt);
+    // The CTR mode allows in == out, so the same code serves the in-place variant
+    CRYPTO_ctr128_encrypt(reinterpret_cast<const uchar*>(in), reinterpret_cast<uchar*>(out),
+                          static_cast<size_t>(size), aesKey, ivecData, ecountData, &m_num,
+                          reinterpret_cast<block128_f>(AES_encrypt));
 #ifdef TELEGRAM_DEBUG_CRYPTO
-    qCDebug(c_categoryCryptoAesCtr) << "in:" << in.toHex();
-    qCDebug(c_categoryCryptoAesCtr) << "out:" << out->toHex();
+    qCDebug(c_categoryCryptoAesCtr) << "out:" << QByteArray::fromRawData(out, size).toHex();
 #endif
     return true;
 }
@@ -47,11 +47,15 @@ public:
 
     QByteArray crypt(const QByteArray &in);
     bool crypt(const QByteArray &in, QByteArray *out);
+    bool crypt(char *data, int size);
 
     // The context description is needed only for debug
     void setDescription(const QByteArray &desc) { m_description = desc; }
 protected:
+    bool crypt(const char *in, char *out, int size);
+
     QByteArray m_key;
+    QByteArray m_keySchedule; // Expanded AES_KEY, computed once per setKey()
     QByteArray m_ivec;
     QByteArray m_ecount;
     quint32 m_num = 0;
@@ -177,7 +177,7 @@ bool DataStorage::getMessage(Message *message, const Peer &peer, quint32 message
         qDebug() << Q_FUNC_INFO << "Unknown message" << peer << messageId;
         return false;
     }
-    const TLMessageMedia &media = m->media;
+    const TLMessageMedia &media = *m->media;
 
     Message::Private *privateData = Message::Private::get(message);
     privateData->reset();
@@ -214,7 +214,7 @@ bool DataStorage::getMessageMediaInfo(MessageMediaInfo *info, const Peer &peer,
         qDebug() << Q_FUNC_INFO << "Unknown message" << peer << messageId;
         return false;
     }
-    const TLMessageMedia &media = m->media;
+    const TLMessageMedia &media = *m->media;
 
     MessageMediaInfo::Private *privateInfo = MessageMediaInfo::Private::get(info);
     *privateInfo = media;
@@ -229,7 +229,8 @@ void FilesApiPrivate::onGetFileResult(FileOperation *operation, UploadRpcLayer::
         operation->setFinishedWithError(rpcOperation->errorDetails());
         return;
     }
-    rpcOperation->getResult(&result);
+    // The chunk bytes reference the reply data; the result is used only in this method
+    uploadLayer()->processReplySharingBytes(rpcOperation, &result);
 
     FileOperationPrivate *privOperation = FileOperationPrivate::get(operation);
     static const QVector<TLValue> badTypes = {
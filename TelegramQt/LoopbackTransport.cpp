@@ -0,0 +1,230 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "LoopbackTransport.hpp"
+
+#include "Debug_p.hpp"
+
+#include <QHash>
+#include <QLoggingCategory>
+
+Q_LOGGING_CATEGORY(c_loggingLoopbackTransport, "telegram.transport.loopback", QtWarningMsg)
+
+namespace Telegram {
+
+using LoopbackServerHash = QHash<QString, LoopbackServer *>;
+Q_GLOBAL_STATIC(LoopbackServerHash, s_loopbackServers)
+
+static QString getServerKey(const QString &address, quint16 port)
+{
+    return address + QLatin1Char('/') + QString::number(port);
+}
+
+LoopbackTransport::LoopbackTransport(QObject *parent) :
+    BaseTransport(parent)
+{
+}
+
+LoopbackTransport::~LoopbackTransport()
+{
+    if (m_peer) {
+        m_peer->m_peer.clear();
+        QMetaObject::invokeMethod(m_peer, "onPeerDisconnected", Qt::QueuedConnection);
+    }
+}
+
+QString LoopbackTransport::addressScheme()
+{
+    return QStringLiteral("loopback:");
+}
+
+bool LoopbackTransport::isLoopbackAddress(const QString &address)
+{
+    return address.startsWith(addressScheme());
+}
+
+void LoopbackTransport::connectToHost(const QString &address, quint16 port)
+{
+    qCDebug(c_loggingLoopbackTransport) << CALL_INFO << address << port;
+    if (m_peer) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "The transport is already connected";
+        return;
+    }
+    m_address = address;
+    m_port = port;
+    setState(QAbstractSocket::ConnectingState);
+    // Keep the connection asynchronous, as it is for a real socket
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    QMetaObject::invokeMethod(this, &LoopbackTransport::establishConnection, Qt::QueuedConnection);
+#else
+    QMetaObject::invokeMethod(this, "establishConnection", Qt::QueuedConnection);
+#endif
+}
+
+void LoopbackTransport::disconnectFromHost()
+{
+    qCDebug(c_loggingLoopbackTransport) << CALL_INFO << m_address;
+    m_incomingPackets.clear();
+    if (m_peer) {
+        LoopbackTransport *peer = m_peer;
+        m_peer.clear();
+        peer->m_peer.clear();
+        // Let the peer process the disconnection after return
+        QMetaObject::invokeMethod(peer, "onPeerDisconnected", Qt::QueuedConnection);
+    }
+    if (state() != QAbstractSocket::UnconnectedState) {
+        setState(QAbstractSocket::UnconnectedState);
+    }
+}
+
+QString LoopbackTransport::remoteAddress() const
+{
+    return m_address;
+}
+
+void LoopbackTransport::establishConnection()
+{
+    if (state() != QAbstractSocket::ConnectingState) {
+        // The connection was aborted
+        return;
+    }
+    LoopbackServer *server = LoopbackServer::find(m_address, m_port);
+    if (!server) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "There is no server listening"
+                                              << m_address << m_port;
+        setError(QAbstractSocket::ConnectionRefusedError, QLatin1String("Connection refused"));
+        setState(QAbstractSocket::UnconnectedState);
+        return;
+    }
+    LoopbackTransport *serverTransport = server->addConnection(this);
+    setPeer(serverTransport, m_address);
+    setState(QAbstractSocket::ConnectedState);
+}
+
+void LoopbackTransport::deliverPackets()
+{
+    QVector<QByteArray> packets;
+    packets.swap(m_incomingPackets);
+    for (const QByteArray &packet : packets) {
+        if (state() != QAbstractSocket::ConnectedState) {
+            break;
+        }
+        emit packetReceived(packet);
+    }
+}
+
+void LoopbackTransport::onPeerDisconnected()
+{
+    m_peer.clear();
+    disconnectFromHost();
+}
+
+void LoopbackTransport::sendPacketImplementation(const QByteArray &payload)
+{
+    if (!m_peer) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "Unable to send a packet: not connected";
+        return;
+    }
+    m_peer->enqueuePacket(payload);
+}
+
+void LoopbackTransport::enqueuePacket(const QByteArray &payload)
+{
+    if (m_incomingPackets.isEmpty()) {
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+        QMetaObject::invokeMethod(this, &LoopbackTransport::deliverPackets, Qt::QueuedConnection);
+#else
+        QMetaObject::invokeMethod(this, "deliverPackets", Qt::QueuedConnection);
+#endif
+    }
+    m_incomingPackets.append(payload);
+}
+
+void LoopbackTransport::setPeer(LoopbackTransport *peer, const QString &address)
+{
+    m_peer = peer;
+    m_address = address;
+}
+
+LoopbackServer::LoopbackServer(QObject *parent) :
+    QObject(parent)
+{
+}
+
+LoopbackServer::~LoopbackServer()
+{
+    close();
+}
+
+bool LoopbackServer::listen(const QString &address, quint16 port)
+{
+    if (isListening()) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "The server is already listening";
+        return false;
+    }
+    if (!port) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "Invalid (null) port";
+        return false;
+    }
+    const QString key = getServerKey(address, port);
+    if (s_loopbackServers->contains(key)) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "The address is already in use:"
+                                              << address << port;
+        return false;
+    }
+    s_loopbackServers->insert(key, this);
+    m_address = address;
+    m_port = port;
+    return true;
+}
+
+void LoopbackServer::close()
+{
+    if (!isListening()) {
+        return;
+    }
+    s_loopbackServers->remove(getServerKey(m_address, m_port));
+    m_port = 0;
+    qDeleteAll(m_pendingConnections);
+    m_pendingConnections.clear();
+}
+
+LoopbackTransport *LoopbackServer::nextPendingConnection()
+{
+    if (m_pendingConnections.isEmpty()) {
+        return nullptr;
+    }
+    return m_pendingConnections.takeFirst();
+}
+
+LoopbackServer *LoopbackServer::find(const QString &address, quint16 port)
+{
+    return s_loopbackServers->value(getServerKey(address, port));
+}
+
+LoopbackTransport *LoopbackServer::addConnection(LoopbackTransport *clientTransport)
+{
+    LoopbackTransport *transport = new LoopbackTransport(this);
+    transport->m_port = m_port;
+    transport->setPeer(clientTransport, m_address);
+    transport->setState(QAbstractSocket::ConnectedState);
+    m_pendingConnections.append(transport);
+    emit newConnection();
+    return transport;
+}
+
+} // Telegram namespace
@@ -0,0 +1,99 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_LOOPBACK_TRANSPORT_HPP
+#define TELEGRAM_LOOPBACK_TRANSPORT_HPP
+
+#include "CTelegramTransport.hpp"
+
+#include <QPointer>
+#include <QVector>
+
+namespace Telegram {
+
+class LoopbackServer;
+
+// In-process transport. The packets are passed to the peer transport
+// as is (without framing or copying) on the next event loop iteration.
+class TELEGRAMQT_INTERNAL_EXPORT LoopbackTransport : public BaseTransport
+{
+    Q_OBJECT
+public:
+    explicit LoopbackTransport(QObject *parent = nullptr);
+    ~LoopbackTransport() override;
+
+    static QString addressScheme();
+    static bool isLoopbackAddress(const QString &address);
+
+    void connectToHost(const QString &address, quint16 port) override;
+    void disconnectFromHost() override;
+
+    QString remoteAddress() const override;
+
+protected slots:
+    void establishConnection();
+    void deliverPackets();
+    void onPeerDisconnected();
+
+protected:
+    void sendPacketImplementation(const QByteArray &payload) override;
+    void enqueuePacket(const QByteArray &payload);
+
+    void setPeer(LoopbackTransport *peer, const QString &address);
+
+    QPointer<LoopbackTransport> m_peer;
+    QVector<QByteArray> m_incomingPackets;
+    QString m_address;
+    quint16 m_port = 0;
+
+    friend class LoopbackServer;
+};
+
+// The QTcpServer-like listener for LoopbackTransport connections.
+// The servers are registered per address and port within the process.
+class TELEGRAMQT_INTERNAL_EXPORT LoopbackServer : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LoopbackServer(QObject *parent = nullptr);
+    ~LoopbackServer() override;
+
+    bool listen(const QString &address, quint16 port);
+    void close();
+    bool isListening() const { return m_port != 0; }
+
+    bool hasPendingConnections() const { return !m_pendingConnections.isEmpty(); }
+    LoopbackTransport *nextPendingConnection();
+
+    static LoopbackServer *find(const QString &address, quint16 port);
+
+signals:
+    void newConnection();
+
+protected:
+    LoopbackTransport *addConnection(LoopbackTransport *clientTransport);
+
+    QVector<LoopbackTransport *> m_pendingConnections;
+    QString m_address;
+    quint16 m_port = 0;
+
+    friend class LoopbackTransport;
+};
+
+} // Telegram namespace
+
+#endif // TELEGRAM_LOOPBACK_TRANSPORT_HPP
@@ -0,0 +1,92 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "DecodeArena.hpp"
+
+namespace Telegram {
+
+namespace MTProto {
+
+DecodeArena::DecodeArena(int blockSize) :
+    m_blockSize(blockSize)
+{
+}
+
+DecodeArena::~DecodeArena()
+{
+    clear();
+    for (const Block &block : m_blocks) {
+        ::operator delete(block.data);
+    }
+}
+
+bool DecodeArena::contains(const void *pointer) const
+{
+    const char *p = static_cast<const char *>(pointer);
+    for (const Block &block : m_blocks) {
+        if ((p >= block.data) && (p < block.data + block.size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int DecodeArena::allocatedSize() const
+{
+    int result = 0;
+    for (const Block &block : m_blocks) {
+        result += block.size;
+    }
+    return result;
+}
+
+void DecodeArena::clear()
+{
+    // Destroy in the reverse order of the creation
+    for (int i = m_destructors.count() - 1; i >= 0; --i) {
+        const Destructor &destructor = m_destructors.at(i);
+        destructor.destroy(destructor.object);
+    }
+    m_destructors.clear();
+
+    while (m_blocks.count() > 1) {
+        ::operator delete(m_blocks.takeLast().data);
+    }
+    m_offset = 0;
+}
+
+void *DecodeArena::allocate(int size, int alignment)
+{
+    if (!m_blocks.isEmpty()) {
+        const Block &block = m_blocks.last();
+        const int offset = (m_offset + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= block.size) {
+            m_offset = offset + size;
+            return block.data + offset;
+        }
+    }
+
+    // The memory of operator new is aligned for any fundamental type
+    const int blockSize = qMax(m_blockSize, size);
+    m_blocks.append({ static_cast<char *>(::operator new(blockSize)), blockSize });
+    m_offset = size;
+    return m_blocks.last().data;
+}
+
+} // MTProto namespace
+
+} // Telegram namespace
@@ -0,0 +1,89 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_QT_MTPROTO_DECODE_ARENA_HPP
+#define TELEGRAM_QT_MTPROTO_DECODE_ARENA_HPP
+
+#include "telegramqt_global.h"
+
+#include <QVector>
+
+#include <new>
+#include <type_traits>
+
+namespace Telegram {
+
+namespace MTProto {
+
+// Monotonic storage for the values decoded from one packet.
+// Set it to a Stream to allocate the items of TLVector<T*> members in the arena
+// instead of one heap block per item. The whole graph is destroyed at once by
+// clear() or by the arena destructor, so the arena must outlive the decoded values.
+class TELEGRAMQT_INTERNAL_EXPORT DecodeArena
+{
+public:
+    explicit DecodeArena(int blockSize = 16 * 1024);
+    ~DecodeArena();
+
+    template <typename T>
+    T *create()
+    {
+        T *object = new (allocate(sizeof(T), alignof(T))) T();
+        if (!std::is_trivially_destructible<T>::value) {
+            m_destructors.append({ object, &destroy<T> });
+        }
+        return object;
+    }
+
+    bool contains(const void *pointer) const;
+    int allocatedSize() const;
+
+    // Destroys all created objects and keeps the first block for the reuse
+    void clear();
+
+protected:
+    void *allocate(int size, int alignment);
+
+    template <typename T>
+    static void destroy(void *object)
+    {
+        static_cast<T *>(object)->~T();
+    }
+
+    struct Block {
+        char *data;
+        int size;
+    };
+    struct Destructor {
+        void *object;
+        void (*destroy)(void *object);
+    };
+
+    QVector<Block> m_blocks;
+    QVector<Destructor> m_destructors;
+    int m_blockSize = 0;
+    int m_offset = 0; // The used size of the last block
+
+private:
+    Q_DISABLE_COPY(DecodeArena)
+};
+
+} // MTProto namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_QT_MTPROTO_DECODE_ARENA_HPP
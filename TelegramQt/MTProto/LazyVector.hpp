@@ -0,0 +1,134 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_QT_MTPROTO_LAZY_VECTOR_HPP
+#define TELEGRAM_QT_MTPROTO_LAZY_VECTOR_HPP
+
+#include "Stream.hpp"
+
+namespace Telegram {
+
+namespace MTProto {
+
+// A view of an encoded TLVector<T>. read() only skips over the items and
+// records their offsets, so a large reply can be inspected and decoded item by item.
+// The view shares the (implicitly shared) data of the in-memory Stream, even if the
+// stream reads a span of it; a device Stream is not supported.
+template <typename T>
+class LazyVector
+{
+public:
+    bool isValid() const { return tlType == TLValue::Vector; }
+    int count() const { return m_offsets.isEmpty() ? 0 : m_offsets.count() - 1; }
+    bool isEmpty() const { return count() == 0; }
+
+    // The constructor of the item, read without the item decoding
+    TLValue typeAt(int index) const;
+    T at(int index) const;
+    TLVector<T> toVector() const;
+
+    // Returns the encoded item without a copy; valid for the view lifetime
+    QByteArray itemData(int index) const;
+
+    TLValue tlType = TLValue::Vector;
+
+protected:
+    friend Stream &operator>>(Stream &stream, LazyVector<T> &v)
+    {
+        v.read(stream);
+        return stream;
+    }
+
+    void read(Stream &stream);
+
+    QByteArray m_data;
+    QVector<int> m_offsets; // The item offsets in the data and the end of the last item
+};
+
+template <typename T>
+void LazyVector<T>::read(Stream &stream)
+{
+    m_data.clear();
+    m_offsets.clear();
+
+    stream >> tlType;
+    if (tlType != TLValue::Vector) {
+        return;
+    }
+    quint32 length = 0;
+    stream >> length;
+    // The offsets make sense only for the in-memory stream
+    if (Q_UNLIKELY(!stream.isAcceptableVectorLength(length) || stream.device())) {
+        stream.setError(true);
+        return;
+    }
+    // The offsets are kept in the whole data, so a reply span is shared without a copy
+    const int spanOffset = stream.spanOffset();
+    m_offsets.reserve(Stream::getVectorReserve(length) + 1);
+    for (quint32 i = 0; i < length; ++i) {
+        m_offsets.append(spanOffset + stream.position());
+        stream.skip<T>();
+        if (stream.error()) {
+            m_offsets.clear();
+            return;
+        }
+    }
+    m_offsets.append(spanOffset + stream.position());
+    m_data = stream.spanData();
+}
+
+template <typename T>
+TLValue LazyVector<T>::typeAt(int index) const
+{
+    quint32 value = 0;
+    memcpy(&value, m_data.constData() + m_offsets.at(index), sizeof(value));
+    return TLValue(value);
+}
+
+template <typename T>
+T LazyVector<T>::at(int index) const
+{
+    Stream stream(itemData(index));
+    T result;
+    stream >> result;
+    return result;
+}
+
+template <typename T>
+TLVector<T> LazyVector<T>::toVector() const
+{
+    TLVector<T> result;
+    result.tlType = tlType;
+    result.reserve(count());
+    for (int i = 0; i < count(); ++i) {
+        result.append(at(i));
+    }
+    return result;
+}
+
+template <typename T>
+QByteArray LazyVector<T>::itemData(int index) const
+{
+    return QByteArray::fromRawData(m_data.constData() + m_offsets.at(index),
+                                   m_offsets.at(index + 1) - m_offsets.at(index));
+}
+
+} // MTProto namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_QT_MTPROTO_LAZY_VECTOR_HPP
@@ -59,10 +59,20 @@ RawStream &operator<<(RawStream &stream, const FullMessageHeader &header)
     return stream;
 }
 
+QByteArray Message::content() const
+{
+    if ((dataOffset == 0) && (dataSize == data.size())) {
+        return data;
+    }
+    return data.mid(dataOffset, dataSize);
+}
+
 Message Message::skipBytes(int bytes) const
 {
+    const int skipped = qBound(0, bytes, dataSize);
     Message m = *this;
-    m.data = data.mid(bytes);
+    m.dataOffset += skipped;
+    m.dataSize -= skipped;
     return m;
 }
 
@@ -25,6 +25,8 @@
 
 #include <QByteArray>
 
+#include <cstring>
+
 namespace Telegram {
 
 namespace MTProto {
@@ -54,11 +56,22 @@ struct TELEGRAMQT_INTERNAL_EXPORT FullMessageHeader : public MessageHeader
             + sizeof(messageId) + sizeof(sequenceNumber) + sizeof(contentLength);
 };
 
+// The message content is the dataSize bytes at the dataOffset of the data.
+// The incoming messages reference the decrypted packet this way, so the nested
+// messages (e.g. of a container) and the unwrapped queries are not copied.
 struct TELEGRAMQT_INTERNAL_EXPORT Message : public MessageHeader {
     Message() = default;
     Message(const MessageHeader &header, const QByteArray &data) :
         MessageHeader(header),
-        data(data)
+        data(data),
+        dataSize(data.size())
+    {
+    }
+    Message(const MessageHeader &header, const QByteArray &buffer, int offset, int size) :
+        MessageHeader(header),
+        data(buffer),
+        dataOffset(offset),
+        dataSize(size)
     {
     }
 
@@ -66,19 +79,37 @@ struct TELEGRAMQT_INTERNAL_EXPORT Message : public MessageHeader {
 
     void setData(const QByteArray &data);
 
-    Q_REQUIRED_RESULT TLValue firstValue() const { return TLValue::firstFromArray(data); }
+    // A copy of the content, unless the message takes the whole data
+    Q_REQUIRED_RESULT QByteArray content() const;
+    Q_REQUIRED_RESULT const char *contentData() const { return data.constData() + dataOffset; }
+
+    Q_REQUIRED_RESULT TLValue firstValue() const;
     Q_REQUIRED_RESULT Message skipTLValue() const { return skipBytes(4); }
     Q_REQUIRED_RESULT Message skipBytes(int bytes) const;
 
     QByteArray data;
+    int dataOffset = 0;
+    int dataSize = 0;
 };
 
 inline void Message::setData(const QByteArray &newData)
 {
     data = newData;
+    dataOffset = 0;
+    dataSize = newData.size();
     contentLength = static_cast<quint32>(newData.size());
 }
 
+inline TLValue Message::firstValue() const
+{
+    if (dataSize < 4) {
+        return TLValue();
+    }
+    quint32 value;
+    memcpy(&value, contentData(), sizeof(value));
+    return TLValue(value);
+}
+
 RawStream &operator>>(RawStream &stream, MessageHeader &message);
 RawStream &operator<<(RawStream &stream, const MessageHeader &message);
 
@@ -0,0 +1,5472 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "SerializedSize.hpp"
+
+namespace Telegram {
+
+namespace MTProto {
+
+int serializedSize(const QString &str)
+{
+    // Matches QString::toUtf8(): an unpaired surrogate is replaced by a single '?'
+    const ushort *data = str.utf16();
+    const int length = str.size();
+    int utf8Length = 0;
+    for (int i = 0; i < length; ++i) {
+        const ushort u = data[i];
+        if (u < 0x80) {
+            utf8Length += 1;
+        } else if (u < 0x800) {
+            utf8Length += 2;
+        } else if (QChar::isHighSurrogate(u) && (i + 1 < length) && QChar::isLowSurrogate(data[i + 1])) {
+            utf8Length += 4;
+            ++i;
+        } else if (QChar::isSurrogate(u)) {
+            utf8Length += 1;
+        } else {
+            utf8Length += 3;
+        }
+    }
+    const AbridgedLength packedLength(static_cast<quint32>(utf8Length));
+    return packedLength.packedSize() + utf8Length + packedLength.paddingForAlignment(4);
+}
+
+// Generated serialized size functions implementation
+int serializedSize(const TLAccountDaysTTL &accountDaysTTLValue)
+{
+    int size = serializedSize(accountDaysTTLValue.tlType);
+    switch (accountDaysTTLValue.tlType) {
+    case TLValue::AccountDaysTTL:
+        size += serializedSize(accountDaysTTLValue.days);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAccountPassword &accountPasswordValue)
+{
+    int size = serializedSize(accountPasswordValue.tlType);
+    switch (accountPasswordValue.tlType) {
+    case TLValue::AccountNoPassword:
+        size += serializedSize(accountPasswordValue.newSalt);
+        size += serializedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    case TLValue::AccountPassword:
+        size += serializedSize(accountPasswordValue.currentSalt);
+        size += serializedSize(accountPasswordValue.newSalt);
+        size += serializedSize(accountPasswordValue.hint);
+        size += serializedSize(accountPasswordValue.hasRecovery);
+        size += serializedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
+{
+    int size = serializedSize(accountPasswordInputSettingsValue.tlType);
+    switch (accountPasswordInputSettingsValue.tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        size += serializedSize(accountPasswordInputSettingsValue.flags);
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::NewSalt) {
+            size += serializedSize(accountPasswordInputSettingsValue.newSalt);
+        }
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::NewPasswordHash) {
+            size += serializedSize(accountPasswordInputSettingsValue.newPasswordHash);
+        }
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::Hint) {
+            size += serializedSize(accountPasswordInputSettingsValue.hint);
+        }
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::Email) {
+            size += serializedSize(accountPasswordInputSettingsValue.email);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue)
+{
+    int size = serializedSize(accountPasswordSettingsValue.tlType);
+    switch (accountPasswordSettingsValue.tlType) {
+    case TLValue::AccountPasswordSettings:
+        size += serializedSize(accountPasswordSettingsValue.email);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAccountTmpPassword &accountTmpPasswordValue)
+{
+    int size = serializedSize(accountTmpPasswordValue.tlType);
+    switch (accountTmpPasswordValue.tlType) {
+    case TLValue::AccountTmpPassword:
+        size += serializedSize(accountTmpPasswordValue.tmpPassword);
+        size += serializedSize(accountTmpPasswordValue.validUntil);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthCheckedPhone &authCheckedPhoneValue)
+{
+    int size = serializedSize(authCheckedPhoneValue.tlType);
+    switch (authCheckedPhoneValue.tlType) {
+    case TLValue::AuthCheckedPhone:
+        size += serializedSize(authCheckedPhoneValue.phoneRegistered);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthCodeType &authCodeTypeValue)
+{
+    int size = serializedSize(authCodeTypeValue.tlType);
+    switch (authCodeTypeValue.tlType) {
+    case TLValue::AuthCodeTypeSms:
+    case TLValue::AuthCodeTypeCall:
+    case TLValue::AuthCodeTypeFlashCall:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue)
+{
+    int size = serializedSize(authExportedAuthorizationValue.tlType);
+    switch (authExportedAuthorizationValue.tlType) {
+    case TLValue::AuthExportedAuthorization:
+        size += serializedSize(authExportedAuthorizationValue.id);
+        size += serializedSize(authExportedAuthorizationValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue)
+{
+    int size = serializedSize(authPasswordRecoveryValue.tlType);
+    switch (authPasswordRecoveryValue.tlType) {
+    case TLValue::AuthPasswordRecovery:
+        size += serializedSize(authPasswordRecoveryValue.emailPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthSentCodeType &authSentCodeTypeValue)
+{
+    int size = serializedSize(authSentCodeTypeValue.tlType);
+    switch (authSentCodeTypeValue.tlType) {
+    case TLValue::AuthSentCodeTypeApp:
+    case TLValue::AuthSentCodeTypeSms:
+    case TLValue::AuthSentCodeTypeCall:
+        size += serializedSize(authSentCodeTypeValue.length);
+        break;
+    case TLValue::AuthSentCodeTypeFlashCall:
+        size += serializedSize(authSentCodeTypeValue.pattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthorization &authorizationValue)
+{
+    int size = serializedSize(authorizationValue.tlType);
+    switch (authorizationValue.tlType) {
+    case TLValue::Authorization:
+        size += serializedSize(authorizationValue.hash);
+        size += serializedSize(authorizationValue.flags);
+        size += serializedSize(authorizationValue.deviceModel);
+        size += serializedSize(authorizationValue.platform);
+        size += serializedSize(authorizationValue.systemVersion);
+        size += serializedSize(authorizationValue.apiId);
+        size += serializedSize(authorizationValue.appName);
+        size += serializedSize(authorizationValue.appVersion);
+        size += serializedSize(authorizationValue.dateCreated);
+        size += serializedSize(authorizationValue.dateActive);
+        size += serializedSize(authorizationValue.ip);
+        size += serializedSize(authorizationValue.country);
+        size += serializedSize(authorizationValue.region);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLBadMsgNotification &badMsgNotificationValue)
+{
+    int size = serializedSize(badMsgNotificationValue.tlType);
+    switch (badMsgNotificationValue.tlType) {
+    case TLValue::BadMsgNotification:
+        size += serializedSize(badMsgNotificationValue.badMsgId);
+        size += serializedSize(badMsgNotificationValue.badMsgSeqno);
+        size += serializedSize(badMsgNotificationValue.errorCode);
+        break;
+    case TLValue::BadServerSalt:
+        size += serializedSize(badMsgNotificationValue.badMsgId);
+        size += serializedSize(badMsgNotificationValue.badMsgSeqno);
+        size += serializedSize(badMsgNotificationValue.errorCode);
+        size += serializedSize(badMsgNotificationValue.newServerSalt);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLBotCommand &botCommandValue)
+{
+    int size = serializedSize(botCommandValue.tlType);
+    switch (botCommandValue.tlType) {
+    case TLValue::BotCommand:
+        size += serializedSize(botCommandValue.command);
+        size += serializedSize(botCommandValue.description);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLBotInfo &botInfoValue)
+{
+    int size = serializedSize(botInfoValue.tlType);
+    switch (botInfoValue.tlType) {
+    case TLValue::BotInfo:
+        size += serializedSize(botInfoValue.userId);
+        size += serializedSize(botInfoValue.description);
+        size += serializedSize(botInfoValue.commands);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLCdnFileHash &cdnFileHashValue)
+{
+    int size = serializedSize(cdnFileHashValue.tlType);
+    switch (cdnFileHashValue.tlType) {
+    case TLValue::CdnFileHash:
+        size += serializedSize(cdnFileHashValue.offset);
+        size += serializedSize(cdnFileHashValue.limit);
+        size += serializedSize(cdnFileHashValue.hash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLCdnPublicKey &cdnPublicKeyValue)
+{
+    int size = serializedSize(cdnPublicKeyValue.tlType);
+    switch (cdnPublicKeyValue.tlType) {
+    case TLValue::CdnPublicKey:
+        size += serializedSize(cdnPublicKeyValue.dcId);
+        size += serializedSize(cdnPublicKeyValue.publicKey);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelParticipantsFilter &channelParticipantsFilterValue)
+{
+    int size = serializedSize(channelParticipantsFilterValue.tlType);
+    switch (channelParticipantsFilterValue.tlType) {
+    case TLValue::ChannelParticipantsRecent:
+    case TLValue::ChannelParticipantsAdmins:
+    case TLValue::ChannelParticipantsBots:
+        break;
+    case TLValue::ChannelParticipantsKicked:
+    case TLValue::ChannelParticipantsBanned:
+    case TLValue::ChannelParticipantsSearch:
+        size += serializedSize(channelParticipantsFilterValue.q);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChatParticipant &chatParticipantValue)
+{
+    int size = serializedSize(chatParticipantValue.tlType);
+    switch (chatParticipantValue.tlType) {
+    case TLValue::ChatParticipant:
+    case TLValue::ChatParticipantAdmin:
+        size += serializedSize(chatParticipantValue.userId);
+        size += serializedSize(chatParticipantValue.inviterId);
+        size += serializedSize(chatParticipantValue.date);
+        break;
+    case TLValue::ChatParticipantCreator:
+        size += serializedSize(chatParticipantValue.userId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChatParticipants &chatParticipantsValue)
+{
+    int size = serializedSize(chatParticipantsValue.tlType);
+    switch (chatParticipantsValue.tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        size += serializedSize(chatParticipantsValue.flags);
+        size += serializedSize(chatParticipantsValue.chatId);
+        if (chatParticipantsValue.flags & TLChatParticipants::SelfParticipant) {
+            size += serializedSize(chatParticipantsValue.selfParticipant);
+        }
+        break;
+    case TLValue::ChatParticipants:
+        size += serializedSize(chatParticipantsValue.chatId);
+        size += serializedSize(chatParticipantsValue.participants);
+        size += serializedSize(chatParticipantsValue.version);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLClientDHInnerData &clientDHInnerDataValue)
+{
+    int size = serializedSize(clientDHInnerDataValue.tlType);
+    switch (clientDHInnerDataValue.tlType) {
+    case TLValue::ClientDHInnerData:
+        size += serializedSize(clientDHInnerDataValue.nonce);
+        size += serializedSize(clientDHInnerDataValue.serverNonce);
+        size += serializedSize(clientDHInnerDataValue.retryId);
+        size += serializedSize(clientDHInnerDataValue.gB);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContact &contactValue)
+{
+    int size = serializedSize(contactValue.tlType);
+    switch (contactValue.tlType) {
+    case TLValue::Contact:
+        size += serializedSize(contactValue.userId);
+        size += serializedSize(contactValue.mutual);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactBlocked &contactBlockedValue)
+{
+    int size = serializedSize(contactBlockedValue.tlType);
+    switch (contactBlockedValue.tlType) {
+    case TLValue::ContactBlocked:
+        size += serializedSize(contactBlockedValue.userId);
+        size += serializedSize(contactBlockedValue.date);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactLink &contactLinkValue)
+{
+    int size = serializedSize(contactLinkValue.tlType);
+    switch (contactLinkValue.tlType) {
+    case TLValue::ContactLinkUnknown:
+    case TLValue::ContactLinkNone:
+    case TLValue::ContactLinkHasPhone:
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDataJSON &dataJSONValue)
+{
+    int size = serializedSize(dataJSONValue.tlType);
+    switch (dataJSONValue.tlType) {
+    case TLValue::DataJSON:
+        size += serializedSize(dataJSONValue.data);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDestroyAuthKeyRes &destroyAuthKeyResValue)
+{
+    int size = serializedSize(destroyAuthKeyResValue.tlType);
+    switch (destroyAuthKeyResValue.tlType) {
+    case TLValue::DestroyAuthKeyOk:
+    case TLValue::DestroyAuthKeyNone:
+    case TLValue::DestroyAuthKeyFail:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDestroySessionRes &destroySessionResValue)
+{
+    int size = serializedSize(destroySessionResValue.tlType);
+    switch (destroySessionResValue.tlType) {
+    case TLValue::DestroySessionOk:
+    case TLValue::DestroySessionNone:
+        size += serializedSize(destroySessionResValue.sessionId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDisabledFeature &disabledFeatureValue)
+{
+    int size = serializedSize(disabledFeatureValue.tlType);
+    switch (disabledFeatureValue.tlType) {
+    case TLValue::DisabledFeature:
+        size += serializedSize(disabledFeatureValue.feature);
+        size += serializedSize(disabledFeatureValue.description);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLEncryptedChat &encryptedChatValue)
+{
+    int size = serializedSize(encryptedChatValue.tlType);
+    switch (encryptedChatValue.tlType) {
+    case TLValue::EncryptedChatEmpty:
+    case TLValue::EncryptedChatDiscarded:
+        size += serializedSize(encryptedChatValue.id);
+        break;
+    case TLValue::EncryptedChatWaiting:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        break;
+    case TLValue::EncryptedChatRequested:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        size += serializedSize(encryptedChatValue.gA);
+        break;
+    case TLValue::EncryptedChat:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        size += serializedSize(encryptedChatValue.gAOrB);
+        size += serializedSize(encryptedChatValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLEncryptedFile &encryptedFileValue)
+{
+    int size = serializedSize(encryptedFileValue.tlType);
+    switch (encryptedFileValue.tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        size += serializedSize(encryptedFileValue.id);
+        size += serializedSize(encryptedFileValue.accessHash);
+        size += serializedSize(encryptedFileValue.size);
+        size += serializedSize(encryptedFileValue.dcId);
+        size += serializedSize(encryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLEncryptedMessage &encryptedMessageValue)
+{
+    int size = serializedSize(encryptedMessageValue.tlType);
+    switch (encryptedMessageValue.tlType) {
+    case TLValue::EncryptedMessage:
+        size += serializedSize(encryptedMessageValue.randomId);
+        size += serializedSize(encryptedMessageValue.chatId);
+        size += serializedSize(encryptedMessageValue.date);
+        size += serializedSize(encryptedMessageValue.bytes);
+        size += serializedSize(encryptedMessageValue.file);
+        break;
+    case TLValue::EncryptedMessageService:
+        size += serializedSize(encryptedMessageValue.randomId);
+        size += serializedSize(encryptedMessageValue.chatId);
+        size += serializedSize(encryptedMessageValue.date);
+        size += serializedSize(encryptedMessageValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLError &errorValue)
+{
+    int size = serializedSize(errorValue.tlType);
+    switch (errorValue.tlType) {
+    case TLValue::Error:
+        size += serializedSize(errorValue.code);
+        size += serializedSize(errorValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLExportedChatInvite &exportedChatInviteValue)
+{
+    int size = serializedSize(exportedChatInviteValue.tlType);
+    switch (exportedChatInviteValue.tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        size += serializedSize(exportedChatInviteValue.link);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLExportedMessageLink &exportedMessageLinkValue)
+{
+    int size = serializedSize(exportedMessageLinkValue.tlType);
+    switch (exportedMessageLinkValue.tlType) {
+    case TLValue::ExportedMessageLink:
+        size += serializedSize(exportedMessageLinkValue.link);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLFileLocation &fileLocationValue)
+{
+    int size = serializedSize(fileLocationValue.tlType);
+    switch (fileLocationValue.tlType) {
+    case TLValue::FileLocationUnavailable:
+        size += serializedSize(fileLocationValue.volumeId);
+        size += serializedSize(fileLocationValue.localId);
+        size += serializedSize(fileLocationValue.secret);
+        break;
+    case TLValue::FileLocation:
+        size += serializedSize(fileLocationValue.dcId);
+        size += serializedSize(fileLocationValue.volumeId);
+        size += serializedSize(fileLocationValue.localId);
+        size += serializedSize(fileLocationValue.secret);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLFutureSalt &futureSaltValue)
+{
+    int size = serializedSize(futureSaltValue.tlType);
+    switch (futureSaltValue.tlType) {
+    case TLValue::FutureSalt:
+        size += serializedSize(futureSaltValue.validSince);
+        size += serializedSize(futureSaltValue.validUntil);
+        size += serializedSize(futureSaltValue.salt);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLFutureSalts &futureSaltsValue)
+{
+    int size = serializedSize(futureSaltsValue.tlType);
+    switch (futureSaltsValue.tlType) {
+    case TLValue::FutureSalts:
+        size += serializedSize(futureSaltsValue.reqMsgId);
+        size += serializedSize(futureSaltsValue.now);
+        size += serializedSize(futureSaltsValue.salts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLGeoPoint &geoPointValue)
+{
+    int size = serializedSize(geoPointValue.tlType);
+    switch (geoPointValue.tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        size += serializedSize(geoPointValue.longitude);
+        size += serializedSize(geoPointValue.latitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHelpAppUpdate &helpAppUpdateValue)
+{
+    int size = serializedSize(helpAppUpdateValue.tlType);
+    switch (helpAppUpdateValue.tlType) {
+    case TLValue::HelpAppUpdate:
+        size += serializedSize(helpAppUpdateValue.id);
+        size += serializedSize(helpAppUpdateValue.critical);
+        size += serializedSize(helpAppUpdateValue.url);
+        size += serializedSize(helpAppUpdateValue.text);
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHelpInviteText &helpInviteTextValue)
+{
+    int size = serializedSize(helpInviteTextValue.tlType);
+    switch (helpInviteTextValue.tlType) {
+    case TLValue::HelpInviteText:
+        size += serializedSize(helpInviteTextValue.message);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHelpTermsOfService &helpTermsOfServiceValue)
+{
+    int size = serializedSize(helpTermsOfServiceValue.tlType);
+    switch (helpTermsOfServiceValue.tlType) {
+    case TLValue::HelpTermsOfService:
+        size += serializedSize(helpTermsOfServiceValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHighScore &highScoreValue)
+{
+    int size = serializedSize(highScoreValue.tlType);
+    switch (highScoreValue.tlType) {
+    case TLValue::HighScore:
+        size += serializedSize(highScoreValue.pos);
+        size += serializedSize(highScoreValue.userId);
+        size += serializedSize(highScoreValue.score);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHttpWait &httpWaitValue)
+{
+    int size = serializedSize(httpWaitValue.tlType);
+    switch (httpWaitValue.tlType) {
+    case TLValue::HttpWait:
+        size += serializedSize(httpWaitValue.maxDelay);
+        size += serializedSize(httpWaitValue.waitAfter);
+        size += serializedSize(httpWaitValue.maxWait);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLImportedContact &importedContactValue)
+{
+    int size = serializedSize(importedContactValue.tlType);
+    switch (importedContactValue.tlType) {
+    case TLValue::ImportedContact:
+        size += serializedSize(importedContactValue.userId);
+        size += serializedSize(importedContactValue.clientId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInlineBotSwitchPM &inlineBotSwitchPMValue)
+{
+    int size = serializedSize(inlineBotSwitchPMValue.tlType);
+    switch (inlineBotSwitchPMValue.tlType) {
+    case TLValue::InlineBotSwitchPM:
+        size += serializedSize(inlineBotSwitchPMValue.text);
+        size += serializedSize(inlineBotSwitchPMValue.startParam);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputAppEvent &inputAppEventValue)
+{
+    int size = serializedSize(inputAppEventValue.tlType);
+    switch (inputAppEventValue.tlType) {
+    case TLValue::InputAppEvent:
+        size += serializedSize(inputAppEventValue.time);
+        size += serializedSize(inputAppEventValue.type);
+        size += serializedSize(inputAppEventValue.peer);
+        size += serializedSize(inputAppEventValue.data);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputBotInlineMessageID &inputBotInlineMessageIDValue)
+{
+    int size = serializedSize(inputBotInlineMessageIDValue.tlType);
+    switch (inputBotInlineMessageIDValue.tlType) {
+    case TLValue::InputBotInlineMessageID:
+        size += serializedSize(inputBotInlineMessageIDValue.dcId);
+        size += serializedSize(inputBotInlineMessageIDValue.id);
+        size += serializedSize(inputBotInlineMessageIDValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputChannel &inputChannelValue)
+{
+    int size = serializedSize(inputChannelValue.tlType);
+    switch (inputChannelValue.tlType) {
+    case TLValue::InputChannelEmpty:
+        break;
+    case TLValue::InputChannel:
+        size += serializedSize(inputChannelValue.channelId);
+        size += serializedSize(inputChannelValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputContact &inputContactValue)
+{
+    int size = serializedSize(inputContactValue.tlType);
+    switch (inputContactValue.tlType) {
+    case TLValue::InputPhoneContact:
+        size += serializedSize(inputContactValue.clientId);
+        size += serializedSize(inputContactValue.phone);
+        size += serializedSize(inputContactValue.firstName);
+        size += serializedSize(inputContactValue.lastName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputDocument &inputDocumentValue)
+{
+    int size = serializedSize(inputDocumentValue.tlType);
+    switch (inputDocumentValue.tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        size += serializedSize(inputDocumentValue.id);
+        size += serializedSize(inputDocumentValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputEncryptedChat &inputEncryptedChatValue)
+{
+    int size = serializedSize(inputEncryptedChatValue.tlType);
+    switch (inputEncryptedChatValue.tlType) {
+    case TLValue::InputEncryptedChat:
+        size += serializedSize(inputEncryptedChatValue.chatId);
+        size += serializedSize(inputEncryptedChatValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputEncryptedFile &inputEncryptedFileValue)
+{
+    int size = serializedSize(inputEncryptedFileValue.tlType);
+    switch (inputEncryptedFileValue.tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.parts);
+        size += serializedSize(inputEncryptedFileValue.md5Checksum);
+        size += serializedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    case TLValue::InputEncryptedFile:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.accessHash);
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.parts);
+        size += serializedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputFile &inputFileValue)
+{
+    int size = serializedSize(inputFileValue.tlType);
+    switch (inputFileValue.tlType) {
+    case TLValue::InputFile:
+        size += serializedSize(inputFileValue.id);
+        size += serializedSize(inputFileValue.parts);
+        size += serializedSize(inputFileValue.name);
+        size += serializedSize(inputFileValue.md5Checksum);
+        break;
+    case TLValue::InputFileBig:
+        size += serializedSize(inputFileValue.id);
+        size += serializedSize(inputFileValue.parts);
+        size += serializedSize(inputFileValue.name);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputFileLocation &inputFileLocationValue)
+{
+    int size = serializedSize(inputFileLocationValue.tlType);
+    switch (inputFileLocationValue.tlType) {
+    case TLValue::InputFileLocation:
+        size += serializedSize(inputFileLocationValue.volumeId);
+        size += serializedSize(inputFileLocationValue.localId);
+        size += serializedSize(inputFileLocationValue.secret);
+        break;
+    case TLValue::InputEncryptedFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        break;
+    case TLValue::InputDocumentFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        size += serializedSize(inputFileLocationValue.version);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputGeoPoint &inputGeoPointValue)
+{
+    int size = serializedSize(inputGeoPointValue.tlType);
+    switch (inputGeoPointValue.tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        size += serializedSize(inputGeoPointValue.latitude);
+        size += serializedSize(inputGeoPointValue.longitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPeer &inputPeerValue)
+{
+    int size = serializedSize(inputPeerValue.tlType);
+    switch (inputPeerValue.tlType) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerChat:
+        size += serializedSize(inputPeerValue.chatId);
+        break;
+    case TLValue::InputPeerUser:
+        size += serializedSize(inputPeerValue.userId);
+        size += serializedSize(inputPeerValue.accessHash);
+        break;
+    case TLValue::InputPeerChannel:
+        size += serializedSize(inputPeerValue.channelId);
+        size += serializedSize(inputPeerValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
+{
+    int size = serializedSize(inputPeerNotifyEventsValue.tlType);
+    switch (inputPeerNotifyEventsValue.tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPhoneCall &inputPhoneCallValue)
+{
+    int size = serializedSize(inputPhoneCallValue.tlType);
+    switch (inputPhoneCallValue.tlType) {
+    case TLValue::InputPhoneCall:
+        size += serializedSize(inputPhoneCallValue.id);
+        size += serializedSize(inputPhoneCallValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPhoto &inputPhotoValue)
+{
+    int size = serializedSize(inputPhotoValue.tlType);
+    switch (inputPhotoValue.tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        size += serializedSize(inputPhotoValue.id);
+        size += serializedSize(inputPhotoValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPrivacyKey &inputPrivacyKeyValue)
+{
+    int size = serializedSize(inputPrivacyKeyValue.tlType);
+    switch (inputPrivacyKeyValue.tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+    case TLValue::InputPrivacyKeyChatInvite:
+    case TLValue::InputPrivacyKeyPhoneCall:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputStickerSet &inputStickerSetValue)
+{
+    int size = serializedSize(inputStickerSetValue.tlType);
+    switch (inputStickerSetValue.tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        size += serializedSize(inputStickerSetValue.id);
+        size += serializedSize(inputStickerSetValue.accessHash);
+        break;
+    case TLValue::InputStickerSetShortName:
+        size += serializedSize(inputStickerSetValue.shortName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputStickeredMedia &inputStickeredMediaValue)
+{
+    int size = serializedSize(inputStickeredMediaValue.tlType);
+    switch (inputStickeredMediaValue.tlType) {
+    case TLValue::InputStickeredMediaPhoto:
+        size += serializedSize(inputStickeredMediaValue.inputPhotoId);
+        break;
+    case TLValue::InputStickeredMediaDocument:
+        size += serializedSize(inputStickeredMediaValue.inputDocumentId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputUser &inputUserValue)
+{
+    int size = serializedSize(inputUserValue.tlType);
+    switch (inputUserValue.tlType) {
+    case TLValue::InputUserEmpty:
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUser:
+        size += serializedSize(inputUserValue.userId);
+        size += serializedSize(inputUserValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputWebFileLocation &inputWebFileLocationValue)
+{
+    int size = serializedSize(inputWebFileLocationValue.tlType);
+    switch (inputWebFileLocationValue.tlType) {
+    case TLValue::InputWebFileLocation:
+        size += serializedSize(inputWebFileLocationValue.url);
+        size += serializedSize(inputWebFileLocationValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLIpPort &ipPortValue)
+{
+    int size = serializedSize(ipPortValue.tlType);
+    switch (ipPortValue.tlType) {
+    case TLValue::IpPort:
+        size += serializedSize(ipPortValue.ipv4);
+        size += serializedSize(ipPortValue.port);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLLabeledPrice &labeledPriceValue)
+{
+    int size = serializedSize(labeledPriceValue.tlType);
+    switch (labeledPriceValue.tlType) {
+    case TLValue::LabeledPrice:
+        size += serializedSize(labeledPriceValue.label);
+        size += serializedSize(labeledPriceValue.amount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLLangPackLanguage &langPackLanguageValue)
+{
+    int size = serializedSize(langPackLanguageValue.tlType);
+    switch (langPackLanguageValue.tlType) {
+    case TLValue::LangPackLanguage:
+        size += serializedSize(langPackLanguageValue.name);
+        size += serializedSize(langPackLanguageValue.nativeName);
+        size += serializedSize(langPackLanguageValue.langCode);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLLangPackString &langPackStringValue)
+{
+    int size = serializedSize(langPackStringValue.tlType);
+    switch (langPackStringValue.tlType) {
+    case TLValue::LangPackString:
+        size += serializedSize(langPackStringValue.key);
+        size += serializedSize(langPackStringValue.value);
+        break;
+    case TLValue::LangPackStringPluralized:
+        size += serializedSize(langPackStringValue.flags);
+        size += serializedSize(langPackStringValue.key);
+        if (langPackStringValue.flags & TLLangPackString::ZeroValue) {
+            size += serializedSize(langPackStringValue.zeroValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::OneValue) {
+            size += serializedSize(langPackStringValue.oneValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::TwoValue) {
+            size += serializedSize(langPackStringValue.twoValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::FewValue) {
+            size += serializedSize(langPackStringValue.fewValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::ManyValue) {
+            size += serializedSize(langPackStringValue.manyValue);
+        }
+        size += serializedSize(langPackStringValue.otherValue);
+        break;
+    case TLValue::LangPackStringDeleted:
+        size += serializedSize(langPackStringValue.key);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMaskCoords &maskCoordsValue)
+{
+    int size = serializedSize(maskCoordsValue.tlType);
+    switch (maskCoordsValue.tlType) {
+    case TLValue::MaskCoords:
+        size += serializedSize(maskCoordsValue.n);
+        size += serializedSize(maskCoordsValue.x);
+        size += serializedSize(maskCoordsValue.y);
+        size += serializedSize(maskCoordsValue.zoom);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessageEntity &messageEntityValue)
+{
+    int size = serializedSize(messageEntityValue.tlType);
+    switch (messageEntityValue.tlType) {
+    case TLValue::MessageEntityUnknown:
+    case TLValue::MessageEntityMention:
+    case TLValue::MessageEntityHashtag:
+    case TLValue::MessageEntityBotCommand:
+    case TLValue::MessageEntityUrl:
+    case TLValue::MessageEntityEmail:
+    case TLValue::MessageEntityBold:
+    case TLValue::MessageEntityItalic:
+    case TLValue::MessageEntityCode:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        break;
+    case TLValue::MessageEntityPre:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.language);
+        break;
+    case TLValue::MessageEntityTextUrl:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.url);
+        break;
+    case TLValue::MessageEntityMentionName:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.userId);
+        break;
+    case TLValue::InputMessageEntityMentionName:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.inputUserUserId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessageFwdHeader &messageFwdHeaderValue)
+{
+    int size = serializedSize(messageFwdHeaderValue.tlType);
+    switch (messageFwdHeaderValue.tlType) {
+    case TLValue::MessageFwdHeader:
+        size += serializedSize(messageFwdHeaderValue.flags);
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::FromId) {
+            size += serializedSize(messageFwdHeaderValue.fromId);
+        }
+        size += serializedSize(messageFwdHeaderValue.date);
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::ChannelId) {
+            size += serializedSize(messageFwdHeaderValue.channelId);
+        }
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::ChannelPost) {
+            size += serializedSize(messageFwdHeaderValue.channelPost);
+        }
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::PostAuthor) {
+            size += serializedSize(messageFwdHeaderValue.postAuthor);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessageRange &messageRangeValue)
+{
+    int size = serializedSize(messageRangeValue.tlType);
+    switch (messageRangeValue.tlType) {
+    case TLValue::MessageRange:
+        size += serializedSize(messageRangeValue.minId);
+        size += serializedSize(messageRangeValue.maxId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesAffectedHistory &messagesAffectedHistoryValue)
+{
+    int size = serializedSize(messagesAffectedHistoryValue.tlType);
+    switch (messagesAffectedHistoryValue.tlType) {
+    case TLValue::MessagesAffectedHistory:
+        size += serializedSize(messagesAffectedHistoryValue.pts);
+        size += serializedSize(messagesAffectedHistoryValue.ptsCount);
+        size += serializedSize(messagesAffectedHistoryValue.offset);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesAffectedMessages &messagesAffectedMessagesValue)
+{
+    int size = serializedSize(messagesAffectedMessagesValue.tlType);
+    switch (messagesAffectedMessagesValue.tlType) {
+    case TLValue::MessagesAffectedMessages:
+        size += serializedSize(messagesAffectedMessagesValue.pts);
+        size += serializedSize(messagesAffectedMessagesValue.ptsCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesDhConfig &messagesDhConfigValue)
+{
+    int size = serializedSize(messagesDhConfigValue.tlType);
+    switch (messagesDhConfigValue.tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        size += serializedSize(messagesDhConfigValue.random);
+        break;
+    case TLValue::MessagesDhConfig:
+        size += serializedSize(messagesDhConfigValue.g);
+        size += serializedSize(messagesDhConfigValue.p);
+        size += serializedSize(messagesDhConfigValue.version);
+        size += serializedSize(messagesDhConfigValue.random);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue)
+{
+    int size = serializedSize(messagesSentEncryptedMessageValue.tlType);
+    switch (messagesSentEncryptedMessageValue.tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        size += serializedSize(messagesSentEncryptedMessageValue.date);
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        size += serializedSize(messagesSentEncryptedMessageValue.date);
+        size += serializedSize(messagesSentEncryptedMessageValue.file);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMsgDetailedInfo &msgDetailedInfoValue)
+{
+    int size = serializedSize(msgDetailedInfoValue.tlType);
+    switch (msgDetailedInfoValue.tlType) {
+    case TLValue::MsgDetailedInfo:
+        size += serializedSize(msgDetailedInfoValue.msgId);
+        size += serializedSize(msgDetailedInfoValue.answerMsgId);
+        size += serializedSize(msgDetailedInfoValue.bytes);
+        size += serializedSize(msgDetailedInfoValue.status);
+        break;
+    case TLValue::MsgNewDetailedInfo:
+        size += serializedSize(msgDetailedInfoValue.answerMsgId);
+        size += serializedSize(msgDetailedInfoValue.bytes);
+        size += serializedSize(msgDetailedInfoValue.status);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMsgResendReq &msgResendReqValue)
+{
+    int size = serializedSize(msgResendReqValue.tlType);
+    switch (msgResendReqValue.tlType) {
+    case TLValue::MsgResendReq:
+        size += serializedSize(msgResendReqValue.msgIds);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMsgsAck &msgsAckValue)
+{
+    int size = serializedSize(msgsAckValue.tlType);
+    switch (msgsAckValue.tlType) {
+    case TLValue::MsgsAck:
+        size += serializedSize(msgsAckValue.msgIds);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMsgsAllInfo &msgsAllInfoValue)
+{
+    int size = serializedSize(msgsAllInfoValue.tlType);
+    switch (msgsAllInfoValue.tlType) {
+    case TLValue::MsgsAllInfo:
+        size += serializedSize(msgsAllInfoValue.msgIds);
+        size += serializedSize(msgsAllInfoValue.info);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMsgsStateInfo &msgsStateInfoValue)
+{
+    int size = serializedSize(msgsStateInfoValue.tlType);
+    switch (msgsStateInfoValue.tlType) {
+    case TLValue::MsgsStateInfo:
+        size += serializedSize(msgsStateInfoValue.reqMsgId);
+        size += serializedSize(msgsStateInfoValue.info);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMsgsStateReq &msgsStateReqValue)
+{
+    int size = serializedSize(msgsStateReqValue.tlType);
+    switch (msgsStateReqValue.tlType) {
+    case TLValue::MsgsStateReq:
+        size += serializedSize(msgsStateReqValue.msgIds);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLNearestDc &nearestDcValue)
+{
+    int size = serializedSize(nearestDcValue.tlType);
+    switch (nearestDcValue.tlType) {
+    case TLValue::NearestDc:
+        size += serializedSize(nearestDcValue.country);
+        size += serializedSize(nearestDcValue.thisDc);
+        size += serializedSize(nearestDcValue.nearestDc);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLNewSession &newSessionValue)
+{
+    int size = serializedSize(newSessionValue.tlType);
+    switch (newSessionValue.tlType) {
+    case TLValue::NewSessionCreated:
+        size += serializedSize(newSessionValue.firstMsgId);
+        size += serializedSize(newSessionValue.uniqueId);
+        size += serializedSize(newSessionValue.serverSalt);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPQInnerData &pQInnerDataValue)
+{
+    int size = serializedSize(pQInnerDataValue.tlType);
+    switch (pQInnerDataValue.tlType) {
+    case TLValue::PQInnerData:
+        size += serializedSize(pQInnerDataValue.pq);
+        size += serializedSize(pQInnerDataValue.p);
+        size += serializedSize(pQInnerDataValue.q);
+        size += serializedSize(pQInnerDataValue.nonce);
+        size += serializedSize(pQInnerDataValue.serverNonce);
+        size += serializedSize(pQInnerDataValue.newNonce);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentCharge &paymentChargeValue)
+{
+    int size = serializedSize(paymentChargeValue.tlType);
+    switch (paymentChargeValue.tlType) {
+    case TLValue::PaymentCharge:
+        size += serializedSize(paymentChargeValue.id);
+        size += serializedSize(paymentChargeValue.providerChargeId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentSavedCredentials &paymentSavedCredentialsValue)
+{
+    int size = serializedSize(paymentSavedCredentialsValue.tlType);
+    switch (paymentSavedCredentialsValue.tlType) {
+    case TLValue::PaymentSavedCredentialsCard:
+        size += serializedSize(paymentSavedCredentialsValue.id);
+        size += serializedSize(paymentSavedCredentialsValue.title);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPeer &peerValue)
+{
+    int size = serializedSize(peerValue.tlType);
+    switch (peerValue.tlType) {
+    case TLValue::PeerUser:
+        size += serializedSize(peerValue.userId);
+        break;
+    case TLValue::PeerChat:
+        size += serializedSize(peerValue.chatId);
+        break;
+    case TLValue::PeerChannel:
+        size += serializedSize(peerValue.channelId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPeerNotifyEvents &peerNotifyEventsValue)
+{
+    int size = serializedSize(peerNotifyEventsValue.tlType);
+    switch (peerNotifyEventsValue.tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhoneCallDiscardReason &phoneCallDiscardReasonValue)
+{
+    int size = serializedSize(phoneCallDiscardReasonValue.tlType);
+    switch (phoneCallDiscardReasonValue.tlType) {
+    case TLValue::PhoneCallDiscardReasonMissed:
+    case TLValue::PhoneCallDiscardReasonDisconnect:
+    case TLValue::PhoneCallDiscardReasonHangup:
+    case TLValue::PhoneCallDiscardReasonBusy:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhoneConnection &phoneConnectionValue)
+{
+    int size = serializedSize(phoneConnectionValue.tlType);
+    switch (phoneConnectionValue.tlType) {
+    case TLValue::PhoneConnection:
+        size += serializedSize(phoneConnectionValue.id);
+        size += serializedSize(phoneConnectionValue.ip);
+        size += serializedSize(phoneConnectionValue.ipv6);
+        size += serializedSize(phoneConnectionValue.port);
+        size += serializedSize(phoneConnectionValue.peerTag);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhotoSize &photoSizeValue)
+{
+    int size = serializedSize(photoSizeValue.tlType);
+    switch (photoSizeValue.tlType) {
+    case TLValue::PhotoSizeEmpty:
+        size += serializedSize(photoSizeValue.type);
+        break;
+    case TLValue::PhotoSize:
+        size += serializedSize(photoSizeValue.type);
+        size += serializedSize(photoSizeValue.location);
+        size += serializedSize(photoSizeValue.w);
+        size += serializedSize(photoSizeValue.h);
+        size += serializedSize(photoSizeValue.size);
+        break;
+    case TLValue::PhotoCachedSize:
+        size += serializedSize(photoSizeValue.type);
+        size += serializedSize(photoSizeValue.location);
+        size += serializedSize(photoSizeValue.w);
+        size += serializedSize(photoSizeValue.h);
+        size += serializedSize(photoSizeValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPong &pongValue)
+{
+    int size = serializedSize(pongValue.tlType);
+    switch (pongValue.tlType) {
+    case TLValue::Pong:
+        size += serializedSize(pongValue.msgId);
+        size += serializedSize(pongValue.pingId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPopularContact &popularContactValue)
+{
+    int size = serializedSize(popularContactValue.tlType);
+    switch (popularContactValue.tlType) {
+    case TLValue::PopularContact:
+        size += serializedSize(popularContactValue.clientId);
+        size += serializedSize(popularContactValue.importers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPostAddress &postAddressValue)
+{
+    int size = serializedSize(postAddressValue.tlType);
+    switch (postAddressValue.tlType) {
+    case TLValue::PostAddress:
+        size += serializedSize(postAddressValue.streetLine1);
+        size += serializedSize(postAddressValue.streetLine2);
+        size += serializedSize(postAddressValue.city);
+        size += serializedSize(postAddressValue.state);
+        size += serializedSize(postAddressValue.countryIso2);
+        size += serializedSize(postAddressValue.postCode);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPrivacyKey &privacyKeyValue)
+{
+    int size = serializedSize(privacyKeyValue.tlType);
+    switch (privacyKeyValue.tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+    case TLValue::PrivacyKeyChatInvite:
+    case TLValue::PrivacyKeyPhoneCall:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPrivacyRule &privacyRuleValue)
+{
+    int size = serializedSize(privacyRuleValue.tlType);
+    switch (privacyRuleValue.tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+    case TLValue::PrivacyValueAllowAll:
+    case TLValue::PrivacyValueDisallowContacts:
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+    case TLValue::PrivacyValueDisallowUsers:
+        size += serializedSize(privacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLReceivedNotifyMessage &receivedNotifyMessageValue)
+{
+    int size = serializedSize(receivedNotifyMessageValue.tlType);
+    switch (receivedNotifyMessageValue.tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        size += serializedSize(receivedNotifyMessageValue.id);
+        size += serializedSize(receivedNotifyMessageValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLReportReason &reportReasonValue)
+{
+    int size = serializedSize(reportReasonValue.tlType);
+    switch (reportReasonValue.tlType) {
+    case TLValue::InputReportReasonSpam:
+    case TLValue::InputReportReasonViolence:
+    case TLValue::InputReportReasonPornography:
+        break;
+    case TLValue::InputReportReasonOther:
+        size += serializedSize(reportReasonValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLResPQ &resPQValue)
+{
+    int size = serializedSize(resPQValue.tlType);
+    switch (resPQValue.tlType) {
+    case TLValue::ResPQ:
+        size += serializedSize(resPQValue.nonce);
+        size += serializedSize(resPQValue.serverNonce);
+        size += serializedSize(resPQValue.pq);
+        size += serializedSize(resPQValue.serverPublicKeyFingerprints);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLRichText &richTextValue)
+{
+    int size = serializedSize(richTextValue.tlType);
+    switch (richTextValue.tlType) {
+    case TLValue::TextEmpty:
+        break;
+    case TLValue::TextPlain:
+        size += serializedSize(richTextValue.stringText);
+        break;
+    case TLValue::TextBold:
+    case TLValue::TextItalic:
+    case TLValue::TextUnderline:
+    case TLValue::TextStrike:
+    case TLValue::TextFixed:
+        size += serializedSize(*richTextValue.richText);
+        break;
+    case TLValue::TextUrl:
+        size += serializedSize(*richTextValue.richText);
+        size += serializedSize(richTextValue.url);
+        size += serializedSize(richTextValue.webpageId);
+        break;
+    case TLValue::TextEmail:
+        size += serializedSize(*richTextValue.richText);
+        size += serializedSize(richTextValue.email);
+        break;
+    case TLValue::TextConcat:
+        size += serializedSize(richTextValue.texts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLRpcDropAnswer &rpcDropAnswerValue)
+{
+    int size = serializedSize(rpcDropAnswerValue.tlType);
+    switch (rpcDropAnswerValue.tlType) {
+    case TLValue::RpcAnswerUnknown:
+    case TLValue::RpcAnswerDroppedRunning:
+        break;
+    case TLValue::RpcAnswerDropped:
+        size += serializedSize(rpcDropAnswerValue.msgId);
+        size += serializedSize(rpcDropAnswerValue.seqNo);
+        size += serializedSize(rpcDropAnswerValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLRpcError &rpcErrorValue)
+{
+    int size = serializedSize(rpcErrorValue.tlType);
+    switch (rpcErrorValue.tlType) {
+    case TLValue::RpcError:
+        size += serializedSize(rpcErrorValue.errorCode);
+        size += serializedSize(rpcErrorValue.errorMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLSendMessageAction &sendMessageActionValue)
+{
+    int size = serializedSize(sendMessageActionValue.tlType);
+    switch (sendMessageActionValue.tlType) {
+    case TLValue::SendMessageTypingAction:
+    case TLValue::SendMessageCancelAction:
+    case TLValue::SendMessageRecordVideoAction:
+    case TLValue::SendMessageRecordAudioAction:
+    case TLValue::SendMessageGeoLocationAction:
+    case TLValue::SendMessageChooseContactAction:
+    case TLValue::SendMessageGamePlayAction:
+    case TLValue::SendMessageRecordRoundAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+    case TLValue::SendMessageUploadAudioAction:
+    case TLValue::SendMessageUploadPhotoAction:
+    case TLValue::SendMessageUploadDocumentAction:
+    case TLValue::SendMessageUploadRoundAction:
+        size += serializedSize(sendMessageActionValue.progress);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLServerDHInnerData &serverDHInnerDataValue)
+{
+    int size = serializedSize(serverDHInnerDataValue.tlType);
+    switch (serverDHInnerDataValue.tlType) {
+    case TLValue::ServerDHInnerData:
+        size += serializedSize(serverDHInnerDataValue.nonce);
+        size += serializedSize(serverDHInnerDataValue.serverNonce);
+        size += serializedSize(serverDHInnerDataValue.g);
+        size += serializedSize(serverDHInnerDataValue.dhPrime);
+        size += serializedSize(serverDHInnerDataValue.gA);
+        size += serializedSize(serverDHInnerDataValue.serverTime);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLServerDHParams &serverDHParamsValue)
+{
+    int size = serializedSize(serverDHParamsValue.tlType);
+    switch (serverDHParamsValue.tlType) {
+    case TLValue::ServerDHParamsFail:
+        size += serializedSize(serverDHParamsValue.nonce);
+        size += serializedSize(serverDHParamsValue.serverNonce);
+        size += serializedSize(serverDHParamsValue.newNonceHash);
+        break;
+    case TLValue::ServerDHParamsOk:
+        size += serializedSize(serverDHParamsValue.nonce);
+        size += serializedSize(serverDHParamsValue.serverNonce);
+        size += serializedSize(serverDHParamsValue.encryptedAnswer);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLSetClientDHParamsAnswer &setClientDHParamsAnswerValue)
+{
+    int size = serializedSize(setClientDHParamsAnswerValue.tlType);
+    switch (setClientDHParamsAnswerValue.tlType) {
+    case TLValue::DhGenOk:
+        size += serializedSize(setClientDHParamsAnswerValue.nonce);
+        size += serializedSize(setClientDHParamsAnswerValue.serverNonce);
+        size += serializedSize(setClientDHParamsAnswerValue.newNonceHash1);
+        break;
+    case TLValue::DhGenRetry:
+        size += serializedSize(setClientDHParamsAnswerValue.nonce);
+        size += serializedSize(setClientDHParamsAnswerValue.serverNonce);
+        size += serializedSize(setClientDHParamsAnswerValue.newNonceHash2);
+        break;
+    case TLValue::DhGenFail:
+        size += serializedSize(setClientDHParamsAnswerValue.nonce);
+        size += serializedSize(setClientDHParamsAnswerValue.serverNonce);
+        size += serializedSize(setClientDHParamsAnswerValue.newNonceHash3);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLShippingOption &shippingOptionValue)
+{
+    int size = serializedSize(shippingOptionValue.tlType);
+    switch (shippingOptionValue.tlType) {
+    case TLValue::ShippingOption:
+        size += serializedSize(shippingOptionValue.id);
+        size += serializedSize(shippingOptionValue.title);
+        size += serializedSize(shippingOptionValue.prices);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLStickerPack &stickerPackValue)
+{
+    int size = serializedSize(stickerPackValue.tlType);
+    switch (stickerPackValue.tlType) {
+    case TLValue::StickerPack:
+        size += serializedSize(stickerPackValue.emoticon);
+        size += serializedSize(stickerPackValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLStorageFileType &storageFileTypeValue)
+{
+    int size = serializedSize(storageFileTypeValue.tlType);
+    switch (storageFileTypeValue.tlType) {
+    case TLValue::StorageFileUnknown:
+    case TLValue::StorageFilePartial:
+    case TLValue::StorageFileJpeg:
+    case TLValue::StorageFileGif:
+    case TLValue::StorageFilePng:
+    case TLValue::StorageFilePdf:
+    case TLValue::StorageFileMp3:
+    case TLValue::StorageFileMov:
+    case TLValue::StorageFileMp4:
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLTopPeer &topPeerValue)
+{
+    int size = serializedSize(topPeerValue.tlType);
+    switch (topPeerValue.tlType) {
+    case TLValue::TopPeer:
+        size += serializedSize(topPeerValue.peer);
+        size += serializedSize(topPeerValue.rating);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLTopPeerCategory &topPeerCategoryValue)
+{
+    int size = serializedSize(topPeerCategoryValue.tlType);
+    switch (topPeerCategoryValue.tlType) {
+    case TLValue::TopPeerCategoryBotsPM:
+    case TLValue::TopPeerCategoryBotsInline:
+    case TLValue::TopPeerCategoryCorrespondents:
+    case TLValue::TopPeerCategoryGroups:
+    case TLValue::TopPeerCategoryChannels:
+    case TLValue::TopPeerCategoryPhoneCalls:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLTopPeerCategoryPeers &topPeerCategoryPeersValue)
+{
+    int size = serializedSize(topPeerCategoryPeersValue.tlType);
+    switch (topPeerCategoryPeersValue.tlType) {
+    case TLValue::TopPeerCategoryPeers:
+        size += serializedSize(topPeerCategoryPeersValue.category);
+        size += serializedSize(topPeerCategoryPeersValue.count);
+        size += serializedSize(topPeerCategoryPeersValue.peers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUpdatesState &updatesStateValue)
+{
+    int size = serializedSize(updatesStateValue.tlType);
+    switch (updatesStateValue.tlType) {
+    case TLValue::UpdatesState:
+        size += serializedSize(updatesStateValue.pts);
+        size += serializedSize(updatesStateValue.qts);
+        size += serializedSize(updatesStateValue.date);
+        size += serializedSize(updatesStateValue.seq);
+        size += serializedSize(updatesStateValue.unreadCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUploadCdnFile &uploadCdnFileValue)
+{
+    int size = serializedSize(uploadCdnFileValue.tlType);
+    switch (uploadCdnFileValue.tlType) {
+    case TLValue::UploadCdnFileReuploadNeeded:
+        size += serializedSize(uploadCdnFileValue.requestToken);
+        break;
+    case TLValue::UploadCdnFile:
+        size += serializedSize(uploadCdnFileValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUploadFile &uploadFileValue)
+{
+    int size = serializedSize(uploadFileValue.tlType);
+    switch (uploadFileValue.tlType) {
+    case TLValue::UploadFile:
+        size += serializedSize(uploadFileValue.type);
+        size += serializedSize(uploadFileValue.mtime);
+        size += serializedSize(uploadFileValue.bytes);
+        break;
+    case TLValue::UploadFileCdnRedirect:
+        size += serializedSize(uploadFileValue.dcId);
+        size += serializedSize(uploadFileValue.fileToken);
+        size += serializedSize(uploadFileValue.encryptionKey);
+        size += serializedSize(uploadFileValue.encryptionIv);
+        size += serializedSize(uploadFileValue.cdnFileHashes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUploadWebFile &uploadWebFileValue)
+{
+    int size = serializedSize(uploadWebFileValue.tlType);
+    switch (uploadWebFileValue.tlType) {
+    case TLValue::UploadWebFile:
+        size += serializedSize(uploadWebFileValue.size);
+        size += serializedSize(uploadWebFileValue.mimeType);
+        size += serializedSize(uploadWebFileValue.fileType);
+        size += serializedSize(uploadWebFileValue.mtime);
+        size += serializedSize(uploadWebFileValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUserProfilePhoto &userProfilePhotoValue)
+{
+    int size = serializedSize(userProfilePhotoValue.tlType);
+    switch (userProfilePhotoValue.tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        size += serializedSize(userProfilePhotoValue.photoId);
+        size += serializedSize(userProfilePhotoValue.photoSmall);
+        size += serializedSize(userProfilePhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUserStatus &userStatusValue)
+{
+    int size = serializedSize(userStatusValue.tlType);
+    switch (userStatusValue.tlType) {
+    case TLValue::UserStatusEmpty:
+    case TLValue::UserStatusRecently:
+    case TLValue::UserStatusLastWeek:
+    case TLValue::UserStatusLastMonth:
+        break;
+    case TLValue::UserStatusOnline:
+        size += serializedSize(userStatusValue.expires);
+        break;
+    case TLValue::UserStatusOffline:
+        size += serializedSize(userStatusValue.wasOnline);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLWallPaper &wallPaperValue)
+{
+    int size = serializedSize(wallPaperValue.tlType);
+    switch (wallPaperValue.tlType) {
+    case TLValue::WallPaper:
+        size += serializedSize(wallPaperValue.id);
+        size += serializedSize(wallPaperValue.title);
+        size += serializedSize(wallPaperValue.sizes);
+        size += serializedSize(wallPaperValue.color);
+        break;
+    case TLValue::WallPaperSolid:
+        size += serializedSize(wallPaperValue.id);
+        size += serializedSize(wallPaperValue.title);
+        size += serializedSize(wallPaperValue.bgColor);
+        size += serializedSize(wallPaperValue.color);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAccountAuthorizations &accountAuthorizationsValue)
+{
+    int size = serializedSize(accountAuthorizationsValue.tlType);
+    switch (accountAuthorizationsValue.tlType) {
+    case TLValue::AccountAuthorizations:
+        size += serializedSize(accountAuthorizationsValue.authorizations);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthSentCode &authSentCodeValue)
+{
+    int size = serializedSize(authSentCodeValue.tlType);
+    switch (authSentCodeValue.tlType) {
+    case TLValue::AuthSentCode:
+        size += serializedSize(authSentCodeValue.flags);
+        size += serializedSize(authSentCodeValue.type);
+        size += serializedSize(authSentCodeValue.phoneCodeHash);
+        if (authSentCodeValue.flags & TLAuthSentCode::NextType) {
+            size += serializedSize(authSentCodeValue.nextType);
+        }
+        if (authSentCodeValue.flags & TLAuthSentCode::Timeout) {
+            size += serializedSize(authSentCodeValue.timeout);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLCdnConfig &cdnConfigValue)
+{
+    int size = serializedSize(cdnConfigValue.tlType);
+    switch (cdnConfigValue.tlType) {
+    case TLValue::CdnConfig:
+        size += serializedSize(cdnConfigValue.publicKeys);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelAdminLogEventsFilter &channelAdminLogEventsFilterValue)
+{
+    int size = serializedSize(channelAdminLogEventsFilterValue.tlType);
+    switch (channelAdminLogEventsFilterValue.tlType) {
+    case TLValue::ChannelAdminLogEventsFilter:
+        size += serializedSize(channelAdminLogEventsFilterValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelAdminRights &channelAdminRightsValue)
+{
+    int size = serializedSize(channelAdminRightsValue.tlType);
+    switch (channelAdminRightsValue.tlType) {
+    case TLValue::ChannelAdminRights:
+        size += serializedSize(channelAdminRightsValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelBannedRights &channelBannedRightsValue)
+{
+    int size = serializedSize(channelBannedRightsValue.tlType);
+    switch (channelBannedRightsValue.tlType) {
+    case TLValue::ChannelBannedRights:
+        size += serializedSize(channelBannedRightsValue.flags);
+        size += serializedSize(channelBannedRightsValue.untilDate);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelMessagesFilter &channelMessagesFilterValue)
+{
+    int size = serializedSize(channelMessagesFilterValue.tlType);
+    switch (channelMessagesFilterValue.tlType) {
+    case TLValue::ChannelMessagesFilterEmpty:
+        break;
+    case TLValue::ChannelMessagesFilter:
+        size += serializedSize(channelMessagesFilterValue.flags);
+        size += serializedSize(channelMessagesFilterValue.ranges);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelParticipant &channelParticipantValue)
+{
+    int size = serializedSize(channelParticipantValue.tlType);
+    switch (channelParticipantValue.tlType) {
+    case TLValue::ChannelParticipant:
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.date);
+        break;
+    case TLValue::ChannelParticipantSelf:
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.inviterId);
+        size += serializedSize(channelParticipantValue.date);
+        break;
+    case TLValue::ChannelParticipantCreator:
+        size += serializedSize(channelParticipantValue.userId);
+        break;
+    case TLValue::ChannelParticipantAdmin:
+        size += serializedSize(channelParticipantValue.flags);
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.inviterId);
+        size += serializedSize(channelParticipantValue.promotedBy);
+        size += serializedSize(channelParticipantValue.date);
+        size += serializedSize(channelParticipantValue.adminRights);
+        break;
+    case TLValue::ChannelParticipantBanned:
+        size += serializedSize(channelParticipantValue.flags);
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.kickedBy);
+        size += serializedSize(channelParticipantValue.date);
+        size += serializedSize(channelParticipantValue.bannedRights);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChatPhoto &chatPhotoValue)
+{
+    int size = serializedSize(chatPhotoValue.tlType);
+    switch (chatPhotoValue.tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        size += serializedSize(chatPhotoValue.photoSmall);
+        size += serializedSize(chatPhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactStatus &contactStatusValue)
+{
+    int size = serializedSize(contactStatusValue.tlType);
+    switch (contactStatusValue.tlType) {
+    case TLValue::ContactStatus:
+        size += serializedSize(contactStatusValue.userId);
+        size += serializedSize(contactStatusValue.status);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDcOption &dcOptionValue)
+{
+    int size = serializedSize(dcOptionValue.tlType);
+    switch (dcOptionValue.tlType) {
+    case TLValue::DcOption:
+        size += serializedSize(dcOptionValue.flags);
+        size += serializedSize(dcOptionValue.id);
+        size += serializedSize(dcOptionValue.ipAddress);
+        size += serializedSize(dcOptionValue.port);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDocumentAttribute &documentAttributeValue)
+{
+    int size = serializedSize(documentAttributeValue.tlType);
+    switch (documentAttributeValue.tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        size += serializedSize(documentAttributeValue.w);
+        size += serializedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAnimated:
+    case TLValue::DocumentAttributeHasStickers:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        size += serializedSize(documentAttributeValue.flags);
+        size += serializedSize(documentAttributeValue.alt);
+        size += serializedSize(documentAttributeValue.stickerset);
+        if (documentAttributeValue.flags & TLDocumentAttribute::MaskCoords) {
+            size += serializedSize(documentAttributeValue.maskCoords);
+        }
+        break;
+    case TLValue::DocumentAttributeVideo:
+        size += serializedSize(documentAttributeValue.flags);
+        size += serializedSize(documentAttributeValue.duration);
+        size += serializedSize(documentAttributeValue.w);
+        size += serializedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAudio:
+        size += serializedSize(documentAttributeValue.flags);
+        size += serializedSize(documentAttributeValue.duration);
+        if (documentAttributeValue.flags & TLDocumentAttribute::Title) {
+            size += serializedSize(documentAttributeValue.title);
+        }
+        if (documentAttributeValue.flags & TLDocumentAttribute::Performer) {
+            size += serializedSize(documentAttributeValue.performer);
+        }
+        if (documentAttributeValue.flags & TLDocumentAttribute::Waveform) {
+            size += serializedSize(documentAttributeValue.waveform);
+        }
+        break;
+    case TLValue::DocumentAttributeFilename:
+        size += serializedSize(documentAttributeValue.fileName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDraftMessage &draftMessageValue)
+{
+    int size = serializedSize(draftMessageValue.tlType);
+    switch (draftMessageValue.tlType) {
+    case TLValue::DraftMessageEmpty:
+        break;
+    case TLValue::DraftMessage:
+        size += serializedSize(draftMessageValue.flags);
+        if (draftMessageValue.flags & TLDraftMessage::ReplyToMsgId) {
+            size += serializedSize(draftMessageValue.replyToMsgId);
+        }
+        size += serializedSize(draftMessageValue.message);
+        if (draftMessageValue.flags & TLDraftMessage::Entities) {
+            size += serializedSize(draftMessageValue.entities);
+        }
+        size += serializedSize(draftMessageValue.date);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHelpConfigSimple &helpConfigSimpleValue)
+{
+    int size = serializedSize(helpConfigSimpleValue.tlType);
+    switch (helpConfigSimpleValue.tlType) {
+    case TLValue::HelpConfigSimple:
+        size += serializedSize(helpConfigSimpleValue.date);
+        size += serializedSize(helpConfigSimpleValue.expires);
+        size += serializedSize(helpConfigSimpleValue.dcId);
+        size += serializedSize(helpConfigSimpleValue.ipPortList);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputChatPhoto &inputChatPhotoValue)
+{
+    int size = serializedSize(inputChatPhotoValue.tlType);
+    switch (inputChatPhotoValue.tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        size += serializedSize(inputChatPhotoValue.file);
+        break;
+    case TLValue::InputChatPhoto:
+        size += serializedSize(inputChatPhotoValue.id);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputGame &inputGameValue)
+{
+    int size = serializedSize(inputGameValue.tlType);
+    switch (inputGameValue.tlType) {
+    case TLValue::InputGameID:
+        size += serializedSize(inputGameValue.id);
+        size += serializedSize(inputGameValue.accessHash);
+        break;
+    case TLValue::InputGameShortName:
+        size += serializedSize(inputGameValue.botId);
+        size += serializedSize(inputGameValue.shortName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputNotifyPeer &inputNotifyPeerValue)
+{
+    int size = serializedSize(inputNotifyPeerValue.tlType);
+    switch (inputNotifyPeerValue.tlType) {
+    case TLValue::InputNotifyPeer:
+        size += serializedSize(inputNotifyPeerValue.peer);
+        break;
+    case TLValue::InputNotifyUsers:
+    case TLValue::InputNotifyChats:
+    case TLValue::InputNotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPaymentCredentials &inputPaymentCredentialsValue)
+{
+    int size = serializedSize(inputPaymentCredentialsValue.tlType);
+    switch (inputPaymentCredentialsValue.tlType) {
+    case TLValue::InputPaymentCredentialsSaved:
+        size += serializedSize(inputPaymentCredentialsValue.id);
+        size += serializedSize(inputPaymentCredentialsValue.tmpPassword);
+        break;
+    case TLValue::InputPaymentCredentials:
+        size += serializedSize(inputPaymentCredentialsValue.flags);
+        size += serializedSize(inputPaymentCredentialsValue.data);
+        break;
+    case TLValue::InputPaymentCredentialsApplePay:
+        size += serializedSize(inputPaymentCredentialsValue.paymentData);
+        break;
+    case TLValue::InputPaymentCredentialsAndroidPay:
+        size += serializedSize(inputPaymentCredentialsValue.paymentToken);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
+{
+    int size = serializedSize(inputPeerNotifySettingsValue.tlType);
+    switch (inputPeerNotifySettingsValue.tlType) {
+    case TLValue::InputPeerNotifySettings:
+        size += serializedSize(inputPeerNotifySettingsValue.flags);
+        size += serializedSize(inputPeerNotifySettingsValue.muteUntil);
+        size += serializedSize(inputPeerNotifySettingsValue.sound);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputPrivacyRule &inputPrivacyRuleValue)
+{
+    int size = serializedSize(inputPrivacyRuleValue.tlType);
+    switch (inputPrivacyRuleValue.tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+    case TLValue::InputPrivacyValueAllowAll:
+    case TLValue::InputPrivacyValueDisallowContacts:
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+    case TLValue::InputPrivacyValueDisallowUsers:
+        size += serializedSize(inputPrivacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputStickerSetItem &inputStickerSetItemValue)
+{
+    int size = serializedSize(inputStickerSetItemValue.tlType);
+    switch (inputStickerSetItemValue.tlType) {
+    case TLValue::InputStickerSetItem:
+        size += serializedSize(inputStickerSetItemValue.flags);
+        size += serializedSize(inputStickerSetItemValue.document);
+        size += serializedSize(inputStickerSetItemValue.emoji);
+        if (inputStickerSetItemValue.flags & TLInputStickerSetItem::MaskCoords) {
+            size += serializedSize(inputStickerSetItemValue.maskCoords);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputWebDocument &inputWebDocumentValue)
+{
+    int size = serializedSize(inputWebDocumentValue.tlType);
+    switch (inputWebDocumentValue.tlType) {
+    case TLValue::InputWebDocument:
+        size += serializedSize(inputWebDocumentValue.url);
+        size += serializedSize(inputWebDocumentValue.size);
+        size += serializedSize(inputWebDocumentValue.mimeType);
+        size += serializedSize(inputWebDocumentValue.attributes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInvoice &invoiceValue)
+{
+    int size = serializedSize(invoiceValue.tlType);
+    switch (invoiceValue.tlType) {
+    case TLValue::Invoice:
+        size += serializedSize(invoiceValue.flags);
+        size += serializedSize(invoiceValue.currency);
+        size += serializedSize(invoiceValue.prices);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLKeyboardButton &keyboardButtonValue)
+{
+    int size = serializedSize(keyboardButtonValue.tlType);
+    switch (keyboardButtonValue.tlType) {
+    case TLValue::KeyboardButton:
+    case TLValue::KeyboardButtonRequestPhone:
+    case TLValue::KeyboardButtonRequestGeoLocation:
+    case TLValue::KeyboardButtonGame:
+    case TLValue::KeyboardButtonBuy:
+        size += serializedSize(keyboardButtonValue.text);
+        break;
+    case TLValue::KeyboardButtonUrl:
+        size += serializedSize(keyboardButtonValue.text);
+        size += serializedSize(keyboardButtonValue.url);
+        break;
+    case TLValue::KeyboardButtonCallback:
+        size += serializedSize(keyboardButtonValue.text);
+        size += serializedSize(keyboardButtonValue.data);
+        break;
+    case TLValue::KeyboardButtonSwitchInline:
+        size += serializedSize(keyboardButtonValue.flags);
+        size += serializedSize(keyboardButtonValue.text);
+        size += serializedSize(keyboardButtonValue.query);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLKeyboardButtonRow &keyboardButtonRowValue)
+{
+    int size = serializedSize(keyboardButtonRowValue.tlType);
+    switch (keyboardButtonRowValue.tlType) {
+    case TLValue::KeyboardButtonRow:
+        size += serializedSize(keyboardButtonRowValue.buttons);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLLangPackDifference &langPackDifferenceValue)
+{
+    int size = serializedSize(langPackDifferenceValue.tlType);
+    switch (langPackDifferenceValue.tlType) {
+    case TLValue::LangPackDifference:
+        size += serializedSize(langPackDifferenceValue.langCode);
+        size += serializedSize(langPackDifferenceValue.fromVersion);
+        size += serializedSize(langPackDifferenceValue.version);
+        size += serializedSize(langPackDifferenceValue.strings);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesBotCallbackAnswer &messagesBotCallbackAnswerValue)
+{
+    int size = serializedSize(messagesBotCallbackAnswerValue.tlType);
+    switch (messagesBotCallbackAnswerValue.tlType) {
+    case TLValue::MessagesBotCallbackAnswer:
+        size += serializedSize(messagesBotCallbackAnswerValue.flags);
+        if (messagesBotCallbackAnswerValue.flags & TLMessagesBotCallbackAnswer::Message) {
+            size += serializedSize(messagesBotCallbackAnswerValue.message);
+        }
+        if (messagesBotCallbackAnswerValue.flags & TLMessagesBotCallbackAnswer::Url) {
+            size += serializedSize(messagesBotCallbackAnswerValue.url);
+        }
+        size += serializedSize(messagesBotCallbackAnswerValue.cacheTime);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesFilter &messagesFilterValue)
+{
+    int size = serializedSize(messagesFilterValue.tlType);
+    switch (messagesFilterValue.tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+    case TLValue::InputMessagesFilterPhotos:
+    case TLValue::InputMessagesFilterVideo:
+    case TLValue::InputMessagesFilterPhotoVideo:
+    case TLValue::InputMessagesFilterDocument:
+    case TLValue::InputMessagesFilterUrl:
+    case TLValue::InputMessagesFilterGif:
+    case TLValue::InputMessagesFilterVoice:
+    case TLValue::InputMessagesFilterMusic:
+    case TLValue::InputMessagesFilterChatPhotos:
+    case TLValue::InputMessagesFilterRoundVoice:
+    case TLValue::InputMessagesFilterRoundVideo:
+    case TLValue::InputMessagesFilterMyMentions:
+    case TLValue::InputMessagesFilterGeo:
+    case TLValue::InputMessagesFilterContacts:
+        break;
+    case TLValue::InputMessagesFilterPhoneCalls:
+        size += serializedSize(messagesFilterValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesMessageEditData &messagesMessageEditDataValue)
+{
+    int size = serializedSize(messagesMessageEditDataValue.tlType);
+    switch (messagesMessageEditDataValue.tlType) {
+    case TLValue::MessagesMessageEditData:
+        size += serializedSize(messagesMessageEditDataValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLNotifyPeer &notifyPeerValue)
+{
+    int size = serializedSize(notifyPeerValue.tlType);
+    switch (notifyPeerValue.tlType) {
+    case TLValue::NotifyPeer:
+        size += serializedSize(notifyPeerValue.peer);
+        break;
+    case TLValue::NotifyUsers:
+    case TLValue::NotifyChats:
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue)
+{
+    int size = serializedSize(paymentRequestedInfoValue.tlType);
+    switch (paymentRequestedInfoValue.tlType) {
+    case TLValue::PaymentRequestedInfo:
+        size += serializedSize(paymentRequestedInfoValue.flags);
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Name) {
+            size += serializedSize(paymentRequestedInfoValue.name);
+        }
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Phone) {
+            size += serializedSize(paymentRequestedInfoValue.phone);
+        }
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Email) {
+            size += serializedSize(paymentRequestedInfoValue.email);
+        }
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::ShippingAddress) {
+            size += serializedSize(paymentRequestedInfoValue.shippingAddress);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentsSavedInfo &paymentsSavedInfoValue)
+{
+    int size = serializedSize(paymentsSavedInfoValue.tlType);
+    switch (paymentsSavedInfoValue.tlType) {
+    case TLValue::PaymentsSavedInfo:
+        size += serializedSize(paymentsSavedInfoValue.flags);
+        if (paymentsSavedInfoValue.flags & TLPaymentsSavedInfo::SavedInfo) {
+            size += serializedSize(paymentsSavedInfoValue.savedInfo);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentsValidatedRequestedInfo &paymentsValidatedRequestedInfoValue)
+{
+    int size = serializedSize(paymentsValidatedRequestedInfoValue.tlType);
+    switch (paymentsValidatedRequestedInfoValue.tlType) {
+    case TLValue::PaymentsValidatedRequestedInfo:
+        size += serializedSize(paymentsValidatedRequestedInfoValue.flags);
+        if (paymentsValidatedRequestedInfoValue.flags & TLPaymentsValidatedRequestedInfo::Id) {
+            size += serializedSize(paymentsValidatedRequestedInfoValue.id);
+        }
+        if (paymentsValidatedRequestedInfoValue.flags & TLPaymentsValidatedRequestedInfo::ShippingOptions) {
+            size += serializedSize(paymentsValidatedRequestedInfoValue.shippingOptions);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPeerNotifySettings &peerNotifySettingsValue)
+{
+    int size = serializedSize(peerNotifySettingsValue.tlType);
+    switch (peerNotifySettingsValue.tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        size += serializedSize(peerNotifySettingsValue.flags);
+        size += serializedSize(peerNotifySettingsValue.muteUntil);
+        size += serializedSize(peerNotifySettingsValue.sound);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPeerSettings &peerSettingsValue)
+{
+    int size = serializedSize(peerSettingsValue.tlType);
+    switch (peerSettingsValue.tlType) {
+    case TLValue::PeerSettings:
+        size += serializedSize(peerSettingsValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhoneCallProtocol &phoneCallProtocolValue)
+{
+    int size = serializedSize(phoneCallProtocolValue.tlType);
+    switch (phoneCallProtocolValue.tlType) {
+    case TLValue::PhoneCallProtocol:
+        size += serializedSize(phoneCallProtocolValue.flags);
+        size += serializedSize(phoneCallProtocolValue.minLayer);
+        size += serializedSize(phoneCallProtocolValue.maxLayer);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhoto &photoValue)
+{
+    int size = serializedSize(photoValue.tlType);
+    switch (photoValue.tlType) {
+    case TLValue::PhotoEmpty:
+        size += serializedSize(photoValue.id);
+        break;
+    case TLValue::Photo:
+        size += serializedSize(photoValue.flags);
+        size += serializedSize(photoValue.id);
+        size += serializedSize(photoValue.accessHash);
+        size += serializedSize(photoValue.date);
+        size += serializedSize(photoValue.sizes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLReplyMarkup &replyMarkupValue)
+{
+    int size = serializedSize(replyMarkupValue.tlType);
+    switch (replyMarkupValue.tlType) {
+    case TLValue::ReplyKeyboardHide:
+    case TLValue::ReplyKeyboardForceReply:
+        size += serializedSize(replyMarkupValue.flags);
+        break;
+    case TLValue::ReplyKeyboardMarkup:
+        size += serializedSize(replyMarkupValue.flags);
+        size += serializedSize(replyMarkupValue.rows);
+        break;
+    case TLValue::ReplyInlineMarkup:
+        size += serializedSize(replyMarkupValue.rows);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLStickerSet &stickerSetValue)
+{
+    int size = serializedSize(stickerSetValue.tlType);
+    switch (stickerSetValue.tlType) {
+    case TLValue::StickerSet:
+        size += serializedSize(stickerSetValue.flags);
+        size += serializedSize(stickerSetValue.id);
+        size += serializedSize(stickerSetValue.accessHash);
+        size += serializedSize(stickerSetValue.title);
+        size += serializedSize(stickerSetValue.shortName);
+        size += serializedSize(stickerSetValue.count);
+        size += serializedSize(stickerSetValue.hash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUser &userValue)
+{
+    int size = serializedSize(userValue.tlType);
+    switch (userValue.tlType) {
+    case TLValue::UserEmpty:
+        size += serializedSize(userValue.id);
+        break;
+    case TLValue::User:
+        size += serializedSize(userValue.flags);
+        size += serializedSize(userValue.id);
+        if (userValue.flags & TLUser::AccessHash) {
+            size += serializedSize(userValue.accessHash);
+        }
+        if (userValue.flags & TLUser::FirstName) {
+            size += serializedSize(userValue.firstName);
+        }
+        if (userValue.flags & TLUser::LastName) {
+            size += serializedSize(userValue.lastName);
+        }
+        if (userValue.flags & TLUser::Username) {
+            size += serializedSize(userValue.username);
+        }
+        if (userValue.flags & TLUser::Phone) {
+            size += serializedSize(userValue.phone);
+        }
+        if (userValue.flags & TLUser::Photo) {
+            size += serializedSize(userValue.photo);
+        }
+        if (userValue.flags & TLUser::Status) {
+            size += serializedSize(userValue.status);
+        }
+        if (userValue.flags & TLUser::BotInfoVersion) {
+            size += serializedSize(userValue.botInfoVersion);
+        }
+        if (userValue.flags & TLUser::RestrictionReason) {
+            size += serializedSize(userValue.restrictionReason);
+        }
+        if (userValue.flags & TLUser::BotInlinePlaceholder) {
+            size += serializedSize(userValue.botInlinePlaceholder);
+        }
+        if (userValue.flags & TLUser::LangCode) {
+            size += serializedSize(userValue.langCode);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLWebDocument &webDocumentValue)
+{
+    int size = serializedSize(webDocumentValue.tlType);
+    switch (webDocumentValue.tlType) {
+    case TLValue::WebDocument:
+        size += serializedSize(webDocumentValue.url);
+        size += serializedSize(webDocumentValue.accessHash);
+        size += serializedSize(webDocumentValue.size);
+        size += serializedSize(webDocumentValue.mimeType);
+        size += serializedSize(webDocumentValue.attributes);
+        size += serializedSize(webDocumentValue.dcId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue)
+{
+    int size = serializedSize(accountPrivacyRulesValue.tlType);
+    switch (accountPrivacyRulesValue.tlType) {
+    case TLValue::AccountPrivacyRules:
+        size += serializedSize(accountPrivacyRulesValue.rules);
+        size += serializedSize(accountPrivacyRulesValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLAuthAuthorization &authAuthorizationValue)
+{
+    int size = serializedSize(authAuthorizationValue.tlType);
+    switch (authAuthorizationValue.tlType) {
+    case TLValue::AuthAuthorization:
+        size += serializedSize(authAuthorizationValue.flags);
+        if (authAuthorizationValue.flags & TLAuthAuthorization::TmpSessions) {
+            size += serializedSize(authAuthorizationValue.tmpSessions);
+        }
+        size += serializedSize(authAuthorizationValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLBotInlineMessage &botInlineMessageValue)
+{
+    int size = serializedSize(botInlineMessageValue.tlType);
+    switch (botInlineMessageValue.tlType) {
+    case TLValue::BotInlineMessageMediaAuto:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.caption);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageText:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.message);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::Entities) {
+            size += serializedSize(botInlineMessageValue.entities);
+        }
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageMediaGeo:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.geo);
+        size += serializedSize(botInlineMessageValue.period);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageMediaVenue:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.geo);
+        size += serializedSize(botInlineMessageValue.title);
+        size += serializedSize(botInlineMessageValue.address);
+        size += serializedSize(botInlineMessageValue.provider);
+        size += serializedSize(botInlineMessageValue.venueId);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageMediaContact:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.phoneNumber);
+        size += serializedSize(botInlineMessageValue.firstName);
+        size += serializedSize(botInlineMessageValue.lastName);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelsChannelParticipant &channelsChannelParticipantValue)
+{
+    int size = serializedSize(channelsChannelParticipantValue.tlType);
+    switch (channelsChannelParticipantValue.tlType) {
+    case TLValue::ChannelsChannelParticipant:
+        size += serializedSize(channelsChannelParticipantValue.participant);
+        size += serializedSize(channelsChannelParticipantValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelsChannelParticipants &channelsChannelParticipantsValue)
+{
+    int size = serializedSize(channelsChannelParticipantsValue.tlType);
+    switch (channelsChannelParticipantsValue.tlType) {
+    case TLValue::ChannelsChannelParticipants:
+        size += serializedSize(channelsChannelParticipantsValue.count);
+        size += serializedSize(channelsChannelParticipantsValue.participants);
+        size += serializedSize(channelsChannelParticipantsValue.users);
+        break;
+    case TLValue::ChannelsChannelParticipantsNotModified:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChat &chatValue)
+{
+    int size = serializedSize(chatValue.tlType);
+    switch (chatValue.tlType) {
+    case TLValue::ChatEmpty:
+        size += serializedSize(chatValue.id);
+        break;
+    case TLValue::Chat:
+        size += serializedSize(chatValue.flags);
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.title);
+        size += serializedSize(chatValue.photo);
+        size += serializedSize(chatValue.participantsCount);
+        size += serializedSize(chatValue.date);
+        size += serializedSize(chatValue.version);
+        if (chatValue.flags & TLChat::MigratedTo) {
+            size += serializedSize(chatValue.migratedTo);
+        }
+        break;
+    case TLValue::ChatForbidden:
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.title);
+        break;
+    case TLValue::Channel:
+        size += serializedSize(chatValue.flags);
+        size += serializedSize(chatValue.id);
+        if (chatValue.flags & TLChat::AccessHash) {
+            size += serializedSize(chatValue.accessHash);
+        }
+        size += serializedSize(chatValue.title);
+        if (chatValue.flags & TLChat::Username) {
+            size += serializedSize(chatValue.username);
+        }
+        size += serializedSize(chatValue.photo);
+        size += serializedSize(chatValue.date);
+        size += serializedSize(chatValue.version);
+        if (chatValue.flags & TLChat::RestrictionReason) {
+            size += serializedSize(chatValue.restrictionReason);
+        }
+        if (chatValue.flags & TLChat::AdminRights) {
+            size += serializedSize(chatValue.adminRights);
+        }
+        if (chatValue.flags & TLChat::BannedRights) {
+            size += serializedSize(chatValue.bannedRights);
+        }
+        break;
+    case TLValue::ChannelForbidden:
+        size += serializedSize(chatValue.flags);
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.accessHash);
+        size += serializedSize(chatValue.title);
+        if (chatValue.flags & TLChat::UntilDate) {
+            size += serializedSize(chatValue.untilDate);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChatFull &chatFullValue)
+{
+    int size = serializedSize(chatFullValue.tlType);
+    switch (chatFullValue.tlType) {
+    case TLValue::ChatFull:
+        size += serializedSize(chatFullValue.id);
+        size += serializedSize(chatFullValue.participants);
+        size += serializedSize(chatFullValue.chatPhoto);
+        size += serializedSize(chatFullValue.notifySettings);
+        size += serializedSize(chatFullValue.exportedInvite);
+        size += serializedSize(chatFullValue.botInfo);
+        break;
+    case TLValue::ChannelFull:
+        size += serializedSize(chatFullValue.flags);
+        size += serializedSize(chatFullValue.id);
+        size += serializedSize(chatFullValue.about);
+        if (chatFullValue.flags & TLChatFull::ParticipantsCount) {
+            size += serializedSize(chatFullValue.participantsCount);
+        }
+        if (chatFullValue.flags & TLChatFull::AdminsCount) {
+            size += serializedSize(chatFullValue.adminsCount);
+        }
+        if (chatFullValue.flags & TLChatFull::KickedCount) {
+            size += serializedSize(chatFullValue.kickedCount);
+        }
+        if (chatFullValue.flags & TLChatFull::BannedCount) {
+            size += serializedSize(chatFullValue.bannedCount);
+        }
+        size += serializedSize(chatFullValue.readInboxMaxId);
+        size += serializedSize(chatFullValue.readOutboxMaxId);
+        size += serializedSize(chatFullValue.unreadCount);
+        size += serializedSize(chatFullValue.chatPhoto);
+        size += serializedSize(chatFullValue.notifySettings);
+        size += serializedSize(chatFullValue.exportedInvite);
+        size += serializedSize(chatFullValue.botInfo);
+        if (chatFullValue.flags & TLChatFull::MigratedFromChatId) {
+            size += serializedSize(chatFullValue.migratedFromChatId);
+        }
+        if (chatFullValue.flags & TLChatFull::MigratedFromMaxId) {
+            size += serializedSize(chatFullValue.migratedFromMaxId);
+        }
+        if (chatFullValue.flags & TLChatFull::PinnedMsgId) {
+            size += serializedSize(chatFullValue.pinnedMsgId);
+        }
+        if (chatFullValue.flags & TLChatFull::Stickerset) {
+            size += serializedSize(chatFullValue.stickerset);
+        }
+        if (chatFullValue.flags & TLChatFull::AvailableMinId) {
+            size += serializedSize(chatFullValue.availableMinId);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChatInvite &chatInviteValue)
+{
+    int size = serializedSize(chatInviteValue.tlType);
+    switch (chatInviteValue.tlType) {
+    case TLValue::ChatInviteAlready:
+        size += serializedSize(*chatInviteValue.chat);
+        break;
+    case TLValue::ChatInvite:
+        size += serializedSize(chatInviteValue.flags);
+        size += serializedSize(chatInviteValue.title);
+        size += serializedSize(chatInviteValue.photo);
+        size += serializedSize(chatInviteValue.participantsCount);
+        if (chatInviteValue.flags & TLChatInvite::Participants) {
+            size += serializedSize(chatInviteValue.participants);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLConfig &configValue)
+{
+    int size = serializedSize(configValue.tlType);
+    switch (configValue.tlType) {
+    case TLValue::Config:
+        size += serializedSize(configValue.flags);
+        size += serializedSize(configValue.date);
+        size += serializedSize(configValue.expires);
+        size += serializedSize(configValue.testMode);
+        size += serializedSize(configValue.thisDc);
+        size += serializedSize(configValue.dcOptions);
+        size += serializedSize(configValue.chatSizeMax);
+        size += serializedSize(configValue.megagroupSizeMax);
+        size += serializedSize(configValue.forwardedCountMax);
+        size += serializedSize(configValue.onlineUpdatePeriodMs);
+        size += serializedSize(configValue.offlineBlurTimeoutMs);
+        size += serializedSize(configValue.offlineIdleTimeoutMs);
+        size += serializedSize(configValue.onlineCloudTimeoutMs);
+        size += serializedSize(configValue.notifyCloudDelayMs);
+        size += serializedSize(configValue.notifyDefaultDelayMs);
+        size += serializedSize(configValue.chatBigSize);
+        size += serializedSize(configValue.pushChatPeriodMs);
+        size += serializedSize(configValue.pushChatLimit);
+        size += serializedSize(configValue.savedGifsLimit);
+        size += serializedSize(configValue.editTimeLimit);
+        size += serializedSize(configValue.ratingEDecay);
+        size += serializedSize(configValue.stickersRecentLimit);
+        size += serializedSize(configValue.stickersFavedLimit);
+        size += serializedSize(configValue.channelsReadMediaPeriod);
+        if (configValue.flags & TLConfig::TmpSessions) {
+            size += serializedSize(configValue.tmpSessions);
+        }
+        size += serializedSize(configValue.pinnedDialogsCountMax);
+        size += serializedSize(configValue.callReceiveTimeoutMs);
+        size += serializedSize(configValue.callRingTimeoutMs);
+        size += serializedSize(configValue.callConnectTimeoutMs);
+        size += serializedSize(configValue.callPacketTimeoutMs);
+        size += serializedSize(configValue.meUrlPrefix);
+        if (configValue.flags & TLConfig::SuggestedLangCode) {
+            size += serializedSize(configValue.suggestedLangCode);
+        }
+        if (configValue.flags & TLConfig::LangPackVersion) {
+            size += serializedSize(configValue.langPackVersion);
+        }
+        size += serializedSize(configValue.disabledFeatures);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactsBlocked &contactsBlockedValue)
+{
+    int size = serializedSize(contactsBlockedValue.tlType);
+    switch (contactsBlockedValue.tlType) {
+    case TLValue::ContactsBlocked:
+        size += serializedSize(contactsBlockedValue.blocked);
+        size += serializedSize(contactsBlockedValue.users);
+        break;
+    case TLValue::ContactsBlockedSlice:
+        size += serializedSize(contactsBlockedValue.count);
+        size += serializedSize(contactsBlockedValue.blocked);
+        size += serializedSize(contactsBlockedValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactsContacts &contactsContactsValue)
+{
+    int size = serializedSize(contactsContactsValue.tlType);
+    switch (contactsContactsValue.tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        size += serializedSize(contactsContactsValue.contacts);
+        size += serializedSize(contactsContactsValue.savedCount);
+        size += serializedSize(contactsContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactsFound &contactsFoundValue)
+{
+    int size = serializedSize(contactsFoundValue.tlType);
+    switch (contactsFoundValue.tlType) {
+    case TLValue::ContactsFound:
+        size += serializedSize(contactsFoundValue.results);
+        size += serializedSize(contactsFoundValue.chats);
+        size += serializedSize(contactsFoundValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactsImportedContacts &contactsImportedContactsValue)
+{
+    int size = serializedSize(contactsImportedContactsValue.tlType);
+    switch (contactsImportedContactsValue.tlType) {
+    case TLValue::ContactsImportedContacts:
+        size += serializedSize(contactsImportedContactsValue.imported);
+        size += serializedSize(contactsImportedContactsValue.popularInvites);
+        size += serializedSize(contactsImportedContactsValue.retryContacts);
+        size += serializedSize(contactsImportedContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactsLink &contactsLinkValue)
+{
+    int size = serializedSize(contactsLinkValue.tlType);
+    switch (contactsLinkValue.tlType) {
+    case TLValue::ContactsLink:
+        size += serializedSize(contactsLinkValue.myLink);
+        size += serializedSize(contactsLinkValue.foreignLink);
+        size += serializedSize(contactsLinkValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactsResolvedPeer &contactsResolvedPeerValue)
+{
+    int size = serializedSize(contactsResolvedPeerValue.tlType);
+    switch (contactsResolvedPeerValue.tlType) {
+    case TLValue::ContactsResolvedPeer:
+        size += serializedSize(contactsResolvedPeerValue.peer);
+        size += serializedSize(contactsResolvedPeerValue.chats);
+        size += serializedSize(contactsResolvedPeerValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLContactsTopPeers &contactsTopPeersValue)
+{
+    int size = serializedSize(contactsTopPeersValue.tlType);
+    switch (contactsTopPeersValue.tlType) {
+    case TLValue::ContactsTopPeersNotModified:
+        break;
+    case TLValue::ContactsTopPeers:
+        size += serializedSize(contactsTopPeersValue.categories);
+        size += serializedSize(contactsTopPeersValue.chats);
+        size += serializedSize(contactsTopPeersValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDialog &dialogValue)
+{
+    int size = serializedSize(dialogValue.tlType);
+    switch (dialogValue.tlType) {
+    case TLValue::Dialog:
+        size += serializedSize(dialogValue.flags);
+        size += serializedSize(dialogValue.peer);
+        size += serializedSize(dialogValue.topMessage);
+        size += serializedSize(dialogValue.readInboxMaxId);
+        size += serializedSize(dialogValue.readOutboxMaxId);
+        size += serializedSize(dialogValue.unreadCount);
+        size += serializedSize(dialogValue.unreadMentionsCount);
+        size += serializedSize(dialogValue.notifySettings);
+        if (dialogValue.flags & TLDialog::Pts) {
+            size += serializedSize(dialogValue.pts);
+        }
+        if (dialogValue.flags & TLDialog::Draft) {
+            size += serializedSize(dialogValue.draft);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLDocument &documentValue)
+{
+    int size = serializedSize(documentValue.tlType);
+    switch (documentValue.tlType) {
+    case TLValue::DocumentEmpty:
+        size += serializedSize(documentValue.id);
+        break;
+    case TLValue::Document:
+        size += serializedSize(documentValue.id);
+        size += serializedSize(documentValue.accessHash);
+        size += serializedSize(documentValue.date);
+        size += serializedSize(documentValue.mimeType);
+        size += serializedSize(documentValue.size);
+        size += serializedSize(documentValue.thumb);
+        size += serializedSize(documentValue.dcId);
+        size += serializedSize(documentValue.version);
+        size += serializedSize(documentValue.attributes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLFoundGif &foundGifValue)
+{
+    int size = serializedSize(foundGifValue.tlType);
+    switch (foundGifValue.tlType) {
+    case TLValue::FoundGif:
+        size += serializedSize(foundGifValue.url);
+        size += serializedSize(foundGifValue.thumbUrl);
+        size += serializedSize(foundGifValue.contentUrl);
+        size += serializedSize(foundGifValue.contentType);
+        size += serializedSize(foundGifValue.w);
+        size += serializedSize(foundGifValue.h);
+        break;
+    case TLValue::FoundGifCached:
+        size += serializedSize(foundGifValue.url);
+        size += serializedSize(foundGifValue.photo);
+        size += serializedSize(foundGifValue.document);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLGame &gameValue)
+{
+    int size = serializedSize(gameValue.tlType);
+    switch (gameValue.tlType) {
+    case TLValue::Game:
+        size += serializedSize(gameValue.flags);
+        size += serializedSize(gameValue.id);
+        size += serializedSize(gameValue.accessHash);
+        size += serializedSize(gameValue.shortName);
+        size += serializedSize(gameValue.title);
+        size += serializedSize(gameValue.description);
+        size += serializedSize(gameValue.photo);
+        if (gameValue.flags & TLGame::Document) {
+            size += serializedSize(gameValue.document);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHelpSupport &helpSupportValue)
+{
+    int size = serializedSize(helpSupportValue.tlType);
+    switch (helpSupportValue.tlType) {
+    case TLValue::HelpSupport:
+        size += serializedSize(helpSupportValue.phoneNumber);
+        size += serializedSize(helpSupportValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputBotInlineMessage &inputBotInlineMessageValue)
+{
+    int size = serializedSize(inputBotInlineMessageValue.tlType);
+    switch (inputBotInlineMessageValue.tlType) {
+    case TLValue::InputBotInlineMessageMediaAuto:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.caption);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageText:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.message);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::Entities) {
+            size += serializedSize(inputBotInlineMessageValue.entities);
+        }
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaGeo:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.geoPoint);
+        size += serializedSize(inputBotInlineMessageValue.period);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaVenue:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.geoPoint);
+        size += serializedSize(inputBotInlineMessageValue.title);
+        size += serializedSize(inputBotInlineMessageValue.address);
+        size += serializedSize(inputBotInlineMessageValue.provider);
+        size += serializedSize(inputBotInlineMessageValue.venueId);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaContact:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.phoneNumber);
+        size += serializedSize(inputBotInlineMessageValue.firstName);
+        size += serializedSize(inputBotInlineMessageValue.lastName);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageGame:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputBotInlineResult &inputBotInlineResultValue)
+{
+    int size = serializedSize(inputBotInlineResultValue.tlType);
+    switch (inputBotInlineResultValue.tlType) {
+    case TLValue::InputBotInlineResult:
+        size += serializedSize(inputBotInlineResultValue.flags);
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.type);
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Title) {
+            size += serializedSize(inputBotInlineResultValue.title);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Description) {
+            size += serializedSize(inputBotInlineResultValue.description);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Url) {
+            size += serializedSize(inputBotInlineResultValue.url);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::ThumbUrl) {
+            size += serializedSize(inputBotInlineResultValue.thumbUrl);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::ContentUrl) {
+            size += serializedSize(inputBotInlineResultValue.contentUrl);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::ContentType) {
+            size += serializedSize(inputBotInlineResultValue.contentType);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::W) {
+            size += serializedSize(inputBotInlineResultValue.w);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::H) {
+            size += serializedSize(inputBotInlineResultValue.h);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Duration) {
+            size += serializedSize(inputBotInlineResultValue.duration);
+        }
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    case TLValue::InputBotInlineResultPhoto:
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.type);
+        size += serializedSize(inputBotInlineResultValue.photo);
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    case TLValue::InputBotInlineResultDocument:
+        size += serializedSize(inputBotInlineResultValue.flags);
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.type);
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Title) {
+            size += serializedSize(inputBotInlineResultValue.title);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Description) {
+            size += serializedSize(inputBotInlineResultValue.description);
+        }
+        size += serializedSize(inputBotInlineResultValue.document);
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    case TLValue::InputBotInlineResultGame:
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.shortName);
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLInputMedia &inputMediaValue)
+{
+    int size = serializedSize(inputMediaValue.tlType);
+    switch (inputMediaValue.tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::Stickers) {
+            size += serializedSize(inputMediaValue.stickers);
+        }
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds1) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaPhoto:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.inputPhotoId);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds0) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaGeoPoint:
+        size += serializedSize(inputMediaValue.geoPoint);
+        break;
+    case TLValue::InputMediaContact:
+        size += serializedSize(inputMediaValue.phoneNumber);
+        size += serializedSize(inputMediaValue.firstName);
+        size += serializedSize(inputMediaValue.lastName);
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.file);
+        if (inputMediaValue.flags & TLInputMedia::Thumb) {
+            size += serializedSize(inputMediaValue.thumb);
+        }
+        size += serializedSize(inputMediaValue.mimeType);
+        size += serializedSize(inputMediaValue.attributes);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::Stickers) {
+            size += serializedSize(inputMediaValue.stickers);
+        }
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds1) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaDocument:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.inputDocumentId);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds0) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaVenue:
+        size += serializedSize(inputMediaValue.geoPoint);
+        size += serializedSize(inputMediaValue.title);
+        size += serializedSize(inputMediaValue.address);
+        size += serializedSize(inputMediaValue.provider);
+        size += serializedSize(inputMediaValue.venueId);
+        size += serializedSize(inputMediaValue.venueType);
+        break;
+    case TLValue::InputMediaGifExternal:
+        size += serializedSize(inputMediaValue.url);
+        size += serializedSize(inputMediaValue.q);
+        break;
+    case TLValue::InputMediaPhotoExternal:
+    case TLValue::InputMediaDocumentExternal:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.url);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds0) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaGame:
+        size += serializedSize(inputMediaValue.inputGameId);
+        break;
+    case TLValue::InputMediaInvoice:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.title);
+        size += serializedSize(inputMediaValue.description);
+        if (inputMediaValue.flags & TLInputMedia::Photo) {
+            size += serializedSize(inputMediaValue.photo);
+        }
+        size += serializedSize(inputMediaValue.invoice);
+        size += serializedSize(inputMediaValue.payload);
+        size += serializedSize(inputMediaValue.provider);
+        size += serializedSize(inputMediaValue.startParam);
+        break;
+    case TLValue::InputMediaGeoLive:
+        size += serializedSize(inputMediaValue.geoPoint);
+        size += serializedSize(inputMediaValue.period);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessageAction &messageActionValue)
+{
+    int size = serializedSize(messageActionValue.tlType);
+    switch (messageActionValue.tlType) {
+    case TLValue::MessageActionEmpty:
+    case TLValue::MessageActionChatDeletePhoto:
+    case TLValue::MessageActionPinMessage:
+    case TLValue::MessageActionHistoryClear:
+    case TLValue::MessageActionScreenshotTaken:
+        break;
+    case TLValue::MessageActionChatCreate:
+        size += serializedSize(messageActionValue.title);
+        size += serializedSize(messageActionValue.users);
+        break;
+    case TLValue::MessageActionChatEditTitle:
+    case TLValue::MessageActionChannelCreate:
+        size += serializedSize(messageActionValue.title);
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        size += serializedSize(messageActionValue.photo);
+        break;
+    case TLValue::MessageActionChatAddUser:
+        size += serializedSize(messageActionValue.users);
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+        size += serializedSize(messageActionValue.userId);
+        break;
+    case TLValue::MessageActionChatJoinedByLink:
+        size += serializedSize(messageActionValue.inviterId);
+        break;
+    case TLValue::MessageActionChatMigrateTo:
+        size += serializedSize(messageActionValue.channelId);
+        break;
+    case TLValue::MessageActionChannelMigrateFrom:
+        size += serializedSize(messageActionValue.title);
+        size += serializedSize(messageActionValue.chatId);
+        break;
+    case TLValue::MessageActionGameScore:
+        size += serializedSize(messageActionValue.gameId);
+        size += serializedSize(messageActionValue.score);
+        break;
+    case TLValue::MessageActionPaymentSentMe:
+        size += serializedSize(messageActionValue.flags);
+        size += serializedSize(messageActionValue.currency);
+        size += serializedSize(messageActionValue.totalAmount);
+        size += serializedSize(messageActionValue.payload);
+        if (messageActionValue.flags & TLMessageAction::Info) {
+            size += serializedSize(messageActionValue.info);
+        }
+        if (messageActionValue.flags & TLMessageAction::ShippingOptionId) {
+            size += serializedSize(messageActionValue.shippingOptionId);
+        }
+        size += serializedSize(messageActionValue.charge);
+        break;
+    case TLValue::MessageActionPaymentSent:
+        size += serializedSize(messageActionValue.currency);
+        size += serializedSize(messageActionValue.totalAmount);
+        break;
+    case TLValue::MessageActionPhoneCall:
+        size += serializedSize(messageActionValue.flags);
+        size += serializedSize(messageActionValue.callId);
+        if (messageActionValue.flags & TLMessageAction::Reason) {
+            size += serializedSize(messageActionValue.reason);
+        }
+        if (messageActionValue.flags & TLMessageAction::Duration) {
+            size += serializedSize(messageActionValue.duration);
+        }
+        break;
+    case TLValue::MessageActionCustomAction:
+        size += serializedSize(messageActionValue.message);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesAllStickers &messagesAllStickersValue)
+{
+    int size = serializedSize(messagesAllStickersValue.tlType);
+    switch (messagesAllStickersValue.tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        size += serializedSize(messagesAllStickersValue.hash);
+        size += serializedSize(messagesAllStickersValue.sets);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesChatFull &messagesChatFullValue)
+{
+    int size = serializedSize(messagesChatFullValue.tlType);
+    switch (messagesChatFullValue.tlType) {
+    case TLValue::MessagesChatFull:
+        size += serializedSize(messagesChatFullValue.fullChat);
+        size += serializedSize(messagesChatFullValue.chats);
+        size += serializedSize(messagesChatFullValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesChats &messagesChatsValue)
+{
+    int size = serializedSize(messagesChatsValue.tlType);
+    switch (messagesChatsValue.tlType) {
+    case TLValue::MessagesChats:
+        size += serializedSize(messagesChatsValue.chats);
+        break;
+    case TLValue::MessagesChatsSlice:
+        size += serializedSize(messagesChatsValue.count);
+        size += serializedSize(messagesChatsValue.chats);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesFavedStickers &messagesFavedStickersValue)
+{
+    int size = serializedSize(messagesFavedStickersValue.tlType);
+    switch (messagesFavedStickersValue.tlType) {
+    case TLValue::MessagesFavedStickersNotModified:
+        break;
+    case TLValue::MessagesFavedStickers:
+        size += serializedSize(messagesFavedStickersValue.hash);
+        size += serializedSize(messagesFavedStickersValue.packs);
+        size += serializedSize(messagesFavedStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesFoundGifs &messagesFoundGifsValue)
+{
+    int size = serializedSize(messagesFoundGifsValue.tlType);
+    switch (messagesFoundGifsValue.tlType) {
+    case TLValue::MessagesFoundGifs:
+        size += serializedSize(messagesFoundGifsValue.nextOffset);
+        size += serializedSize(messagesFoundGifsValue.results);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesHighScores &messagesHighScoresValue)
+{
+    int size = serializedSize(messagesHighScoresValue.tlType);
+    switch (messagesHighScoresValue.tlType) {
+    case TLValue::MessagesHighScores:
+        size += serializedSize(messagesHighScoresValue.scores);
+        size += serializedSize(messagesHighScoresValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesRecentStickers &messagesRecentStickersValue)
+{
+    int size = serializedSize(messagesRecentStickersValue.tlType);
+    switch (messagesRecentStickersValue.tlType) {
+    case TLValue::MessagesRecentStickersNotModified:
+        break;
+    case TLValue::MessagesRecentStickers:
+        size += serializedSize(messagesRecentStickersValue.hash);
+        size += serializedSize(messagesRecentStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesSavedGifs &messagesSavedGifsValue)
+{
+    int size = serializedSize(messagesSavedGifsValue.tlType);
+    switch (messagesSavedGifsValue.tlType) {
+    case TLValue::MessagesSavedGifsNotModified:
+        break;
+    case TLValue::MessagesSavedGifs:
+        size += serializedSize(messagesSavedGifsValue.hash);
+        size += serializedSize(messagesSavedGifsValue.gifs);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesStickerSet &messagesStickerSetValue)
+{
+    int size = serializedSize(messagesStickerSetValue.tlType);
+    switch (messagesStickerSetValue.tlType) {
+    case TLValue::MessagesStickerSet:
+        size += serializedSize(messagesStickerSetValue.set);
+        size += serializedSize(messagesStickerSetValue.packs);
+        size += serializedSize(messagesStickerSetValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesStickers &messagesStickersValue)
+{
+    int size = serializedSize(messagesStickersValue.tlType);
+    switch (messagesStickersValue.tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        size += serializedSize(messagesStickersValue.hash);
+        size += serializedSize(messagesStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPageBlock &pageBlockValue)
+{
+    int size = serializedSize(pageBlockValue.tlType);
+    switch (pageBlockValue.tlType) {
+    case TLValue::PageBlockUnsupported:
+    case TLValue::PageBlockDivider:
+        break;
+    case TLValue::PageBlockTitle:
+    case TLValue::PageBlockSubtitle:
+    case TLValue::PageBlockHeader:
+    case TLValue::PageBlockSubheader:
+    case TLValue::PageBlockParagraph:
+    case TLValue::PageBlockFooter:
+        size += serializedSize(*pageBlockValue.text);
+        break;
+    case TLValue::PageBlockAuthorDate:
+        size += serializedSize(*pageBlockValue.richTextAuthor);
+        size += serializedSize(pageBlockValue.publishedDate);
+        break;
+    case TLValue::PageBlockPreformatted:
+        size += serializedSize(*pageBlockValue.text);
+        size += serializedSize(pageBlockValue.language);
+        break;
+    case TLValue::PageBlockAnchor:
+        size += serializedSize(pageBlockValue.name);
+        break;
+    case TLValue::PageBlockList:
+        size += serializedSize(pageBlockValue.ordered);
+        size += serializedSize(pageBlockValue.richTextItemsVector);
+        break;
+    case TLValue::PageBlockBlockquote:
+    case TLValue::PageBlockPullquote:
+        size += serializedSize(*pageBlockValue.text);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockPhoto:
+        size += serializedSize(pageBlockValue.photoId);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockVideo:
+        size += serializedSize(pageBlockValue.flags);
+        size += serializedSize(pageBlockValue.videoId);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockCover:
+        size += serializedSize(*pageBlockValue.cover);
+        break;
+    case TLValue::PageBlockEmbed:
+        size += serializedSize(pageBlockValue.flags);
+        if (pageBlockValue.flags & TLPageBlock::Url) {
+            size += serializedSize(pageBlockValue.url);
+        }
+        if (pageBlockValue.flags & TLPageBlock::Html) {
+            size += serializedSize(pageBlockValue.html);
+        }
+        if (pageBlockValue.flags & TLPageBlock::PosterPhotoId) {
+            size += serializedSize(pageBlockValue.posterPhotoId);
+        }
+        size += serializedSize(pageBlockValue.w);
+        size += serializedSize(pageBlockValue.h);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockEmbedPost:
+        size += serializedSize(pageBlockValue.url);
+        size += serializedSize(pageBlockValue.webpageId);
+        size += serializedSize(pageBlockValue.authorPhotoId);
+        size += serializedSize(pageBlockValue.stringAuthor);
+        size += serializedSize(pageBlockValue.date);
+        size += serializedSize(pageBlockValue.blocks);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockCollage:
+    case TLValue::PageBlockSlideshow:
+        size += serializedSize(pageBlockValue.pageBlockItemsVector);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockChannel:
+        size += serializedSize(*pageBlockValue.channel);
+        break;
+    case TLValue::PageBlockAudio:
+        size += serializedSize(pageBlockValue.audioId);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentsPaymentForm &paymentsPaymentFormValue)
+{
+    int size = serializedSize(paymentsPaymentFormValue.tlType);
+    switch (paymentsPaymentFormValue.tlType) {
+    case TLValue::PaymentsPaymentForm:
+        size += serializedSize(paymentsPaymentFormValue.flags);
+        size += serializedSize(paymentsPaymentFormValue.botId);
+        size += serializedSize(paymentsPaymentFormValue.invoice);
+        size += serializedSize(paymentsPaymentFormValue.providerId);
+        size += serializedSize(paymentsPaymentFormValue.url);
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::NativeProvider) {
+            size += serializedSize(paymentsPaymentFormValue.nativeProvider);
+        }
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::NativeParams) {
+            size += serializedSize(paymentsPaymentFormValue.nativeParams);
+        }
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::SavedInfo) {
+            size += serializedSize(paymentsPaymentFormValue.savedInfo);
+        }
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::SavedCredentials) {
+            size += serializedSize(paymentsPaymentFormValue.savedCredentials);
+        }
+        size += serializedSize(paymentsPaymentFormValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentsPaymentReceipt &paymentsPaymentReceiptValue)
+{
+    int size = serializedSize(paymentsPaymentReceiptValue.tlType);
+    switch (paymentsPaymentReceiptValue.tlType) {
+    case TLValue::PaymentsPaymentReceipt:
+        size += serializedSize(paymentsPaymentReceiptValue.flags);
+        size += serializedSize(paymentsPaymentReceiptValue.date);
+        size += serializedSize(paymentsPaymentReceiptValue.botId);
+        size += serializedSize(paymentsPaymentReceiptValue.invoice);
+        size += serializedSize(paymentsPaymentReceiptValue.providerId);
+        if (paymentsPaymentReceiptValue.flags & TLPaymentsPaymentReceipt::Info) {
+            size += serializedSize(paymentsPaymentReceiptValue.info);
+        }
+        if (paymentsPaymentReceiptValue.flags & TLPaymentsPaymentReceipt::Shipping) {
+            size += serializedSize(paymentsPaymentReceiptValue.shipping);
+        }
+        size += serializedSize(paymentsPaymentReceiptValue.currency);
+        size += serializedSize(paymentsPaymentReceiptValue.totalAmount);
+        size += serializedSize(paymentsPaymentReceiptValue.credentialsTitle);
+        size += serializedSize(paymentsPaymentReceiptValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhoneCall &phoneCallValue)
+{
+    int size = serializedSize(phoneCallValue.tlType);
+    switch (phoneCallValue.tlType) {
+    case TLValue::PhoneCallEmpty:
+        size += serializedSize(phoneCallValue.id);
+        break;
+    case TLValue::PhoneCallWaiting:
+        size += serializedSize(phoneCallValue.flags);
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.protocol);
+        if (phoneCallValue.flags & TLPhoneCall::ReceiveDate) {
+            size += serializedSize(phoneCallValue.receiveDate);
+        }
+        break;
+    case TLValue::PhoneCallRequested:
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.gAHash);
+        size += serializedSize(phoneCallValue.protocol);
+        break;
+    case TLValue::PhoneCallAccepted:
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.gB);
+        size += serializedSize(phoneCallValue.protocol);
+        break;
+    case TLValue::PhoneCall:
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.gAOrB);
+        size += serializedSize(phoneCallValue.keyFingerprint);
+        size += serializedSize(phoneCallValue.protocol);
+        size += serializedSize(phoneCallValue.connection);
+        size += serializedSize(phoneCallValue.alternativeConnections);
+        size += serializedSize(phoneCallValue.startDate);
+        break;
+    case TLValue::PhoneCallDiscarded:
+        size += serializedSize(phoneCallValue.flags);
+        size += serializedSize(phoneCallValue.id);
+        if (phoneCallValue.flags & TLPhoneCall::Reason) {
+            size += serializedSize(phoneCallValue.reason);
+        }
+        if (phoneCallValue.flags & TLPhoneCall::Duration) {
+            size += serializedSize(phoneCallValue.duration);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhonePhoneCall &phonePhoneCallValue)
+{
+    int size = serializedSize(phonePhoneCallValue.tlType);
+    switch (phonePhoneCallValue.tlType) {
+    case TLValue::PhonePhoneCall:
+        size += serializedSize(phonePhoneCallValue.phoneCall);
+        size += serializedSize(phonePhoneCallValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhotosPhoto &photosPhotoValue)
+{
+    int size = serializedSize(photosPhotoValue.tlType);
+    switch (photosPhotoValue.tlType) {
+    case TLValue::PhotosPhoto:
+        size += serializedSize(photosPhotoValue.photo);
+        size += serializedSize(photosPhotoValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPhotosPhotos &photosPhotosValue)
+{
+    int size = serializedSize(photosPhotosValue.tlType);
+    switch (photosPhotosValue.tlType) {
+    case TLValue::PhotosPhotos:
+        size += serializedSize(photosPhotosValue.photos);
+        size += serializedSize(photosPhotosValue.users);
+        break;
+    case TLValue::PhotosPhotosSlice:
+        size += serializedSize(photosPhotosValue.count);
+        size += serializedSize(photosPhotosValue.photos);
+        size += serializedSize(photosPhotosValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLStickerSetCovered &stickerSetCoveredValue)
+{
+    int size = serializedSize(stickerSetCoveredValue.tlType);
+    switch (stickerSetCoveredValue.tlType) {
+    case TLValue::StickerSetCovered:
+        size += serializedSize(stickerSetCoveredValue.set);
+        size += serializedSize(stickerSetCoveredValue.cover);
+        break;
+    case TLValue::StickerSetMultiCovered:
+        size += serializedSize(stickerSetCoveredValue.set);
+        size += serializedSize(stickerSetCoveredValue.covers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUserFull &userFullValue)
+{
+    int size = serializedSize(userFullValue.tlType);
+    switch (userFullValue.tlType) {
+    case TLValue::UserFull:
+        size += serializedSize(userFullValue.flags);
+        size += serializedSize(userFullValue.user);
+        if (userFullValue.flags & TLUserFull::About) {
+            size += serializedSize(userFullValue.about);
+        }
+        size += serializedSize(userFullValue.link);
+        if (userFullValue.flags & TLUserFull::ProfilePhoto) {
+            size += serializedSize(userFullValue.profilePhoto);
+        }
+        size += serializedSize(userFullValue.notifySettings);
+        if (userFullValue.flags & TLUserFull::BotInfo) {
+            size += serializedSize(userFullValue.botInfo);
+        }
+        size += serializedSize(userFullValue.commonChatsCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLBotInlineResult &botInlineResultValue)
+{
+    int size = serializedSize(botInlineResultValue.tlType);
+    switch (botInlineResultValue.tlType) {
+    case TLValue::BotInlineResult:
+        size += serializedSize(botInlineResultValue.flags);
+        size += serializedSize(botInlineResultValue.id);
+        size += serializedSize(botInlineResultValue.type);
+        if (botInlineResultValue.flags & TLBotInlineResult::Title1) {
+            size += serializedSize(botInlineResultValue.title);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Description2) {
+            size += serializedSize(botInlineResultValue.description);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Url) {
+            size += serializedSize(botInlineResultValue.url);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::ThumbUrl) {
+            size += serializedSize(botInlineResultValue.thumbUrl);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::ContentUrl) {
+            size += serializedSize(botInlineResultValue.contentUrl);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::ContentType) {
+            size += serializedSize(botInlineResultValue.contentType);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::W) {
+            size += serializedSize(botInlineResultValue.w);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::H) {
+            size += serializedSize(botInlineResultValue.h);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Duration) {
+            size += serializedSize(botInlineResultValue.duration);
+        }
+        size += serializedSize(botInlineResultValue.sendMessage);
+        break;
+    case TLValue::BotInlineMediaResult:
+        size += serializedSize(botInlineResultValue.flags);
+        size += serializedSize(botInlineResultValue.id);
+        size += serializedSize(botInlineResultValue.type);
+        if (botInlineResultValue.flags & TLBotInlineResult::Photo) {
+            size += serializedSize(botInlineResultValue.photo);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Document) {
+            size += serializedSize(botInlineResultValue.document);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Title2) {
+            size += serializedSize(botInlineResultValue.title);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Description3) {
+            size += serializedSize(botInlineResultValue.description);
+        }
+        size += serializedSize(botInlineResultValue.sendMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesArchivedStickers &messagesArchivedStickersValue)
+{
+    int size = serializedSize(messagesArchivedStickersValue.tlType);
+    switch (messagesArchivedStickersValue.tlType) {
+    case TLValue::MessagesArchivedStickers:
+        size += serializedSize(messagesArchivedStickersValue.count);
+        size += serializedSize(messagesArchivedStickersValue.sets);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesBotResults &messagesBotResultsValue)
+{
+    int size = serializedSize(messagesBotResultsValue.tlType);
+    switch (messagesBotResultsValue.tlType) {
+    case TLValue::MessagesBotResults:
+        size += serializedSize(messagesBotResultsValue.flags);
+        size += serializedSize(messagesBotResultsValue.queryId);
+        if (messagesBotResultsValue.flags & TLMessagesBotResults::NextOffset) {
+            size += serializedSize(messagesBotResultsValue.nextOffset);
+        }
+        if (messagesBotResultsValue.flags & TLMessagesBotResults::SwitchPm) {
+            size += serializedSize(messagesBotResultsValue.switchPm);
+        }
+        size += serializedSize(messagesBotResultsValue.results);
+        size += serializedSize(messagesBotResultsValue.cacheTime);
+        size += serializedSize(messagesBotResultsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesFeaturedStickers &messagesFeaturedStickersValue)
+{
+    int size = serializedSize(messagesFeaturedStickersValue.tlType);
+    switch (messagesFeaturedStickersValue.tlType) {
+    case TLValue::MessagesFeaturedStickersNotModified:
+        break;
+    case TLValue::MessagesFeaturedStickers:
+        size += serializedSize(messagesFeaturedStickersValue.hash);
+        size += serializedSize(messagesFeaturedStickersValue.sets);
+        size += serializedSize(messagesFeaturedStickersValue.unread);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesStickerSetInstallResult &messagesStickerSetInstallResultValue)
+{
+    int size = serializedSize(messagesStickerSetInstallResultValue.tlType);
+    switch (messagesStickerSetInstallResultValue.tlType) {
+    case TLValue::MessagesStickerSetInstallResultSuccess:
+        break;
+    case TLValue::MessagesStickerSetInstallResultArchive:
+        size += serializedSize(messagesStickerSetInstallResultValue.sets);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPage &pageValue)
+{
+    int size = serializedSize(pageValue.tlType);
+    switch (pageValue.tlType) {
+    case TLValue::PagePart:
+    case TLValue::PageFull:
+        size += serializedSize(pageValue.blocks);
+        size += serializedSize(pageValue.photos);
+        size += serializedSize(pageValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLRecentMeUrl &recentMeUrlValue)
+{
+    int size = serializedSize(recentMeUrlValue.tlType);
+    switch (recentMeUrlValue.tlType) {
+    case TLValue::RecentMeUrlUnknown:
+        size += serializedSize(recentMeUrlValue.url);
+        break;
+    case TLValue::RecentMeUrlUser:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(recentMeUrlValue.userId);
+        break;
+    case TLValue::RecentMeUrlChat:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(recentMeUrlValue.chatId);
+        break;
+    case TLValue::RecentMeUrlChatInvite:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(*recentMeUrlValue.chatInvite);
+        break;
+    case TLValue::RecentMeUrlStickerSet:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(*recentMeUrlValue.set);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLWebPage &webPageValue)
+{
+    int size = serializedSize(webPageValue.tlType);
+    switch (webPageValue.tlType) {
+    case TLValue::WebPageEmpty:
+        size += serializedSize(webPageValue.id);
+        break;
+    case TLValue::WebPagePending:
+        size += serializedSize(webPageValue.id);
+        size += serializedSize(webPageValue.date);
+        break;
+    case TLValue::WebPage:
+        size += serializedSize(webPageValue.flags);
+        size += serializedSize(webPageValue.id);
+        size += serializedSize(webPageValue.url);
+        size += serializedSize(webPageValue.displayUrl);
+        size += serializedSize(webPageValue.hash);
+        if (webPageValue.flags & TLWebPage::Type) {
+            size += serializedSize(webPageValue.type);
+        }
+        if (webPageValue.flags & TLWebPage::SiteName) {
+            size += serializedSize(webPageValue.siteName);
+        }
+        if (webPageValue.flags & TLWebPage::Title) {
+            size += serializedSize(webPageValue.title);
+        }
+        if (webPageValue.flags & TLWebPage::Description) {
+            size += serializedSize(webPageValue.description);
+        }
+        if (webPageValue.flags & TLWebPage::Photo) {
+            size += serializedSize(webPageValue.photo);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedUrl) {
+            size += serializedSize(webPageValue.embedUrl);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedType) {
+            size += serializedSize(webPageValue.embedType);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedWidth) {
+            size += serializedSize(webPageValue.embedWidth);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedHeight) {
+            size += serializedSize(webPageValue.embedHeight);
+        }
+        if (webPageValue.flags & TLWebPage::Duration) {
+            size += serializedSize(webPageValue.duration);
+        }
+        if (webPageValue.flags & TLWebPage::Author) {
+            size += serializedSize(webPageValue.author);
+        }
+        if (webPageValue.flags & TLWebPage::Document) {
+            size += serializedSize(webPageValue.document);
+        }
+        if (webPageValue.flags & TLWebPage::CachedPage) {
+            size += serializedSize(webPageValue.cachedPage);
+        }
+        break;
+    case TLValue::WebPageNotModified:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLHelpRecentMeUrls &helpRecentMeUrlsValue)
+{
+    int size = serializedSize(helpRecentMeUrlsValue.tlType);
+    switch (helpRecentMeUrlsValue.tlType) {
+    case TLValue::HelpRecentMeUrls:
+        size += serializedSize(helpRecentMeUrlsValue.urls);
+        size += serializedSize(helpRecentMeUrlsValue.chats);
+        size += serializedSize(helpRecentMeUrlsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessageMedia &messageMediaValue)
+{
+    int size = serializedSize(messageMediaValue.tlType);
+    switch (messageMediaValue.tlType) {
+    case TLValue::MessageMediaEmpty:
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaPhoto:
+        size += serializedSize(messageMediaValue.flags);
+        if (messageMediaValue.flags & TLMessageMedia::Photo) {
+            size += serializedSize(messageMediaValue.photo);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::Caption) {
+            size += serializedSize(messageMediaValue.caption);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::TtlSeconds) {
+            size += serializedSize(messageMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::MessageMediaGeo:
+        size += serializedSize(messageMediaValue.geo);
+        break;
+    case TLValue::MessageMediaContact:
+        size += serializedSize(messageMediaValue.phoneNumber);
+        size += serializedSize(messageMediaValue.firstName);
+        size += serializedSize(messageMediaValue.lastName);
+        size += serializedSize(messageMediaValue.userId);
+        break;
+    case TLValue::MessageMediaDocument:
+        size += serializedSize(messageMediaValue.flags);
+        if (messageMediaValue.flags & TLMessageMedia::Document) {
+            size += serializedSize(messageMediaValue.document);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::Caption) {
+            size += serializedSize(messageMediaValue.caption);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::TtlSeconds) {
+            size += serializedSize(messageMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::MessageMediaWebPage:
+        size += serializedSize(*messageMediaValue.webpage);
+        break;
+    case TLValue::MessageMediaVenue:
+        size += serializedSize(messageMediaValue.geo);
+        size += serializedSize(messageMediaValue.title);
+        size += serializedSize(messageMediaValue.address);
+        size += serializedSize(messageMediaValue.provider);
+        size += serializedSize(messageMediaValue.venueId);
+        size += serializedSize(messageMediaValue.venueType);
+        break;
+    case TLValue::MessageMediaGame:
+        size += serializedSize(*messageMediaValue.game);
+        break;
+    case TLValue::MessageMediaInvoice:
+        size += serializedSize(messageMediaValue.flags);
+        size += serializedSize(messageMediaValue.title);
+        size += serializedSize(messageMediaValue.description);
+        if (messageMediaValue.flags & TLMessageMedia::WebDocumentPhoto) {
+            size += serializedSize(messageMediaValue.webDocumentPhoto);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::ReceiptMsgId) {
+            size += serializedSize(messageMediaValue.receiptMsgId);
+        }
+        size += serializedSize(messageMediaValue.currency);
+        size += serializedSize(messageMediaValue.totalAmount);
+        size += serializedSize(messageMediaValue.startParam);
+        break;
+    case TLValue::MessageMediaGeoLive:
+        size += serializedSize(messageMediaValue.geo);
+        size += serializedSize(messageMediaValue.period);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessage &messageValue)
+{
+    int size = serializedSize(messageValue.tlType);
+    switch (messageValue.tlType) {
+    case TLValue::MessageEmpty:
+        size += serializedSize(messageValue.id);
+        break;
+    case TLValue::Message:
+        size += serializedSize(messageValue.flags);
+        size += serializedSize(messageValue.id);
+        if (messageValue.flags & TLMessage::FromId) {
+            size += serializedSize(messageValue.fromId);
+        }
+        size += serializedSize(messageValue.toId);
+        if (messageValue.flags & TLMessage::FwdFrom) {
+            size += serializedSize(messageValue.fwdFrom);
+        }
+        if (messageValue.flags & TLMessage::ViaBotId) {
+            size += serializedSize(messageValue.viaBotId);
+        }
+        if (messageValue.flags & TLMessage::ReplyToMsgId) {
+            size += serializedSize(messageValue.replyToMsgId);
+        }
+        size += serializedSize(messageValue.date);
+        size += serializedSize(messageValue.message);
+        if (messageValue.flags & TLMessage::Media) {
+            size += serializedSize(*messageValue.media);
+        }
+        if (messageValue.flags & TLMessage::ReplyMarkup) {
+            size += serializedSize(messageValue.replyMarkup);
+        }
+        if (messageValue.flags & TLMessage::Entities) {
+            size += serializedSize(messageValue.entities);
+        }
+        if (messageValue.flags & TLMessage::Views) {
+            size += serializedSize(messageValue.views);
+        }
+        if (messageValue.flags & TLMessage::EditDate) {
+            size += serializedSize(messageValue.editDate);
+        }
+        if (messageValue.flags & TLMessage::PostAuthor) {
+            size += serializedSize(messageValue.postAuthor);
+        }
+        break;
+    case TLValue::MessageService:
+        size += serializedSize(messageValue.flags);
+        size += serializedSize(messageValue.id);
+        if (messageValue.flags & TLMessage::FromId) {
+            size += serializedSize(messageValue.fromId);
+        }
+        size += serializedSize(messageValue.toId);
+        if (messageValue.flags & TLMessage::ReplyToMsgId) {
+            size += serializedSize(messageValue.replyToMsgId);
+        }
+        size += serializedSize(messageValue.date);
+        size += serializedSize(*messageValue.action);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesDialogs &messagesDialogsValue)
+{
+    int size = serializedSize(messagesDialogsValue.tlType);
+    switch (messagesDialogsValue.tlType) {
+    case TLValue::MessagesDialogs:
+        size += serializedSize(messagesDialogsValue.dialogs);
+        size += serializedSize(messagesDialogsValue.messages);
+        size += serializedSize(messagesDialogsValue.chats);
+        size += serializedSize(messagesDialogsValue.users);
+        break;
+    case TLValue::MessagesDialogsSlice:
+        size += serializedSize(messagesDialogsValue.count);
+        size += serializedSize(messagesDialogsValue.dialogs);
+        size += serializedSize(messagesDialogsValue.messages);
+        size += serializedSize(messagesDialogsValue.chats);
+        size += serializedSize(messagesDialogsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesMessages &messagesMessagesValue)
+{
+    int size = serializedSize(messagesMessagesValue.tlType);
+    switch (messagesMessagesValue.tlType) {
+    case TLValue::MessagesMessages:
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesMessagesSlice:
+        size += serializedSize(messagesMessagesValue.count);
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesChannelMessages:
+        size += serializedSize(messagesMessagesValue.flags);
+        size += serializedSize(messagesMessagesValue.pts);
+        size += serializedSize(messagesMessagesValue.count);
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesMessagesNotModified:
+        size += serializedSize(messagesMessagesValue.count);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLMessagesPeerDialogs &messagesPeerDialogsValue)
+{
+    int size = serializedSize(messagesPeerDialogsValue.tlType);
+    switch (messagesPeerDialogsValue.tlType) {
+    case TLValue::MessagesPeerDialogs:
+        size += serializedSize(messagesPeerDialogsValue.dialogs);
+        size += serializedSize(messagesPeerDialogsValue.messages);
+        size += serializedSize(messagesPeerDialogsValue.chats);
+        size += serializedSize(messagesPeerDialogsValue.users);
+        size += serializedSize(messagesPeerDialogsValue.state);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUpdate &updateValue)
+{
+    int size = serializedSize(updateValue.tlType);
+    switch (updateValue.tlType) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+    case TLValue::UpdateEditChannelMessage:
+    case TLValue::UpdateEditMessage:
+        size += serializedSize(*updateValue.message);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateMessageID:
+        size += serializedSize(updateValue.quint32Id);
+        size += serializedSize(updateValue.randomId);
+        break;
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+        size += serializedSize(updateValue.messages);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateUserTyping:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatUserTyping:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatParticipants:
+        size += serializedSize(updateValue.participants);
+        break;
+    case TLValue::UpdateUserStatus:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.status);
+        break;
+    case TLValue::UpdateUserName:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.firstName);
+        size += serializedSize(updateValue.lastName);
+        size += serializedSize(updateValue.username);
+        break;
+    case TLValue::UpdateUserPhoto:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.date);
+        size += serializedSize(updateValue.photo);
+        size += serializedSize(updateValue.previous);
+        break;
+    case TLValue::UpdateContactRegistered:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateContactLink:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.myLink);
+        size += serializedSize(updateValue.foreignLink);
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        size += serializedSize(updateValue.encryptedMessage);
+        size += serializedSize(updateValue.qts);
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+        size += serializedSize(updateValue.chatId);
+        break;
+    case TLValue::UpdateEncryption:
+        size += serializedSize(updateValue.chat);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.maxDate);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.inviterId);
+        size += serializedSize(updateValue.date);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateChatParticipantDelete:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateDcOptions:
+        size += serializedSize(updateValue.dcOptions);
+        break;
+    case TLValue::UpdateUserBlocked:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.blocked);
+        break;
+    case TLValue::UpdateNotifySettings:
+        size += serializedSize(updateValue.notifyPeer);
+        size += serializedSize(updateValue.notifySettings);
+        break;
+    case TLValue::UpdateServiceNotification:
+        size += serializedSize(updateValue.flags);
+        if (updateValue.flags & TLUpdate::InboxDate) {
+            size += serializedSize(updateValue.inboxDate);
+        }
+        size += serializedSize(updateValue.type);
+        size += serializedSize(updateValue.stringMessage);
+        size += serializedSize(*updateValue.media);
+        size += serializedSize(updateValue.entities);
+        break;
+    case TLValue::UpdatePrivacy:
+        size += serializedSize(updateValue.key);
+        size += serializedSize(updateValue.rules);
+        break;
+    case TLValue::UpdateUserPhone:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.phone);
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.maxId);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateWebPage:
+        size += serializedSize(*updateValue.webpage);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateChannelTooLong:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.channelId);
+        if (updateValue.flags & TLUpdate::Pts) {
+            size += serializedSize(updateValue.pts);
+        }
+        break;
+    case TLValue::UpdateChannel:
+        size += serializedSize(updateValue.channelId);
+        break;
+    case TLValue::UpdateReadChannelInbox:
+    case TLValue::UpdateReadChannelOutbox:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.maxId);
+        break;
+    case TLValue::UpdateDeleteChannelMessages:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.messages);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateChannelMessageViews:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.quint32Id);
+        size += serializedSize(updateValue.views);
+        break;
+    case TLValue::UpdateChatAdmins:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.enabled);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateChatParticipantAdmin:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.isAdmin);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateNewStickerSet:
+        size += serializedSize(updateValue.stickerset);
+        break;
+    case TLValue::UpdateStickerSetsOrder:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.quint64OrderVector);
+        break;
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+    case TLValue::UpdateReadFeaturedStickers:
+    case TLValue::UpdateRecentStickers:
+    case TLValue::UpdateConfig:
+    case TLValue::UpdatePtsChanged:
+    case TLValue::UpdateLangPackTooLong:
+    case TLValue::UpdateFavedStickers:
+    case TLValue::UpdateContactsReset:
+        break;
+    case TLValue::UpdateBotInlineQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.query);
+        if (updateValue.flags & TLUpdate::Geo) {
+            size += serializedSize(updateValue.geo);
+        }
+        size += serializedSize(updateValue.offset);
+        break;
+    case TLValue::UpdateBotInlineSend:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.query);
+        if (updateValue.flags & TLUpdate::Geo) {
+            size += serializedSize(updateValue.geo);
+        }
+        size += serializedSize(updateValue.stringId);
+        if (updateValue.flags & TLUpdate::InputBotInlineMessageIDMsgId) {
+            size += serializedSize(updateValue.inputBotInlineMessageIDMsgId);
+        }
+        break;
+    case TLValue::UpdateChannelPinnedMessage:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.quint32Id);
+        break;
+    case TLValue::UpdateBotCallbackQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.msgId);
+        size += serializedSize(updateValue.chatInstance);
+        if (updateValue.flags & TLUpdate::ByteArrayData) {
+            size += serializedSize(updateValue.byteArrayData);
+        }
+        if (updateValue.flags & TLUpdate::GameShortName) {
+            size += serializedSize(updateValue.gameShortName);
+        }
+        break;
+    case TLValue::UpdateInlineBotCallbackQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.inputBotInlineMessageIDMsgId);
+        size += serializedSize(updateValue.chatInstance);
+        if (updateValue.flags & TLUpdate::ByteArrayData) {
+            size += serializedSize(updateValue.byteArrayData);
+        }
+        if (updateValue.flags & TLUpdate::GameShortName) {
+            size += serializedSize(updateValue.gameShortName);
+        }
+        break;
+    case TLValue::UpdateDraftMessage:
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.draft);
+        break;
+    case TLValue::UpdateChannelWebPage:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(*updateValue.webpage);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateDialogPinned:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.peer);
+        break;
+    case TLValue::UpdatePinnedDialogs:
+        size += serializedSize(updateValue.flags);
+        if (updateValue.flags & TLUpdate::PeerOrderVector) {
+            size += serializedSize(updateValue.peerOrderVector);
+        }
+        break;
+    case TLValue::UpdateBotWebhookJSON:
+        size += serializedSize(updateValue.jSONData);
+        break;
+    case TLValue::UpdateBotWebhookJSONQuery:
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.jSONData);
+        size += serializedSize(updateValue.timeout);
+        break;
+    case TLValue::UpdateBotShippingQuery:
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.payload);
+        size += serializedSize(updateValue.shippingAddress);
+        break;
+    case TLValue::UpdateBotPrecheckoutQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.payload);
+        if (updateValue.flags & TLUpdate::Info) {
+            size += serializedSize(updateValue.info);
+        }
+        if (updateValue.flags & TLUpdate::ShippingOptionId) {
+            size += serializedSize(updateValue.shippingOptionId);
+        }
+        size += serializedSize(updateValue.currency);
+        size += serializedSize(updateValue.totalAmount);
+        break;
+    case TLValue::UpdatePhoneCall:
+        size += serializedSize(*updateValue.phoneCall);
+        break;
+    case TLValue::UpdateLangPack:
+        size += serializedSize(updateValue.difference);
+        break;
+    case TLValue::UpdateChannelReadMessagesContents:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.messages);
+        break;
+    case TLValue::UpdateChannelAvailableMessages:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.availableMinId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUpdates &updatesValue)
+{
+    int size = serializedSize(updatesValue.tlType);
+    switch (updatesValue.tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.userId);
+        size += serializedSize(updatesValue.message);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & TLUpdates::FwdFrom) {
+            size += serializedSize(updatesValue.fwdFrom);
+        }
+        if (updatesValue.flags & TLUpdates::ViaBotId) {
+            size += serializedSize(updatesValue.viaBotId);
+        }
+        if (updatesValue.flags & TLUpdates::ReplyToMsgId) {
+            size += serializedSize(updatesValue.replyToMsgId);
+        }
+        if (updatesValue.flags & TLUpdates::Entities) {
+            size += serializedSize(updatesValue.entities);
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.fromId);
+        size += serializedSize(updatesValue.chatId);
+        size += serializedSize(updatesValue.message);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & TLUpdates::FwdFrom) {
+            size += serializedSize(updatesValue.fwdFrom);
+        }
+        if (updatesValue.flags & TLUpdates::ViaBotId) {
+            size += serializedSize(updatesValue.viaBotId);
+        }
+        if (updatesValue.flags & TLUpdates::ReplyToMsgId) {
+            size += serializedSize(updatesValue.replyToMsgId);
+        }
+        if (updatesValue.flags & TLUpdates::Entities) {
+            size += serializedSize(updatesValue.entities);
+        }
+        break;
+    case TLValue::UpdateShort:
+        size += serializedSize(*updatesValue.update);
+        size += serializedSize(updatesValue.date);
+        break;
+    case TLValue::UpdatesCombined:
+        size += serializedSize(updatesValue.updates);
+        size += serializedSize(updatesValue.users);
+        size += serializedSize(updatesValue.chats);
+        size += serializedSize(updatesValue.date);
+        size += serializedSize(updatesValue.seqStart);
+        size += serializedSize(updatesValue.seq);
+        break;
+    case TLValue::Updates:
+        size += serializedSize(updatesValue.updates);
+        size += serializedSize(updatesValue.users);
+        size += serializedSize(updatesValue.chats);
+        size += serializedSize(updatesValue.date);
+        size += serializedSize(updatesValue.seq);
+        break;
+    case TLValue::UpdateShortSentMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & TLUpdates::Media) {
+            size += serializedSize(*updatesValue.media);
+        }
+        if (updatesValue.flags & TLUpdates::Entities) {
+            size += serializedSize(updatesValue.entities);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUpdatesChannelDifference &updatesChannelDifferenceValue)
+{
+    int size = serializedSize(updatesChannelDifferenceValue.tlType);
+    switch (updatesChannelDifferenceValue.tlType) {
+    case TLValue::UpdatesChannelDifferenceEmpty:
+        size += serializedSize(updatesChannelDifferenceValue.flags);
+        size += serializedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & TLUpdatesChannelDifference::Timeout) {
+            size += serializedSize(updatesChannelDifferenceValue.timeout);
+        }
+        break;
+    case TLValue::UpdatesChannelDifferenceTooLong:
+        size += serializedSize(updatesChannelDifferenceValue.flags);
+        size += serializedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & TLUpdatesChannelDifference::Timeout) {
+            size += serializedSize(updatesChannelDifferenceValue.timeout);
+        }
+        size += serializedSize(updatesChannelDifferenceValue.topMessage);
+        size += serializedSize(updatesChannelDifferenceValue.readInboxMaxId);
+        size += serializedSize(updatesChannelDifferenceValue.readOutboxMaxId);
+        size += serializedSize(updatesChannelDifferenceValue.unreadCount);
+        size += serializedSize(updatesChannelDifferenceValue.unreadMentionsCount);
+        size += serializedSize(updatesChannelDifferenceValue.messages);
+        size += serializedSize(updatesChannelDifferenceValue.chats);
+        size += serializedSize(updatesChannelDifferenceValue.users);
+        break;
+    case TLValue::UpdatesChannelDifference:
+        size += serializedSize(updatesChannelDifferenceValue.flags);
+        size += serializedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & TLUpdatesChannelDifference::Timeout) {
+            size += serializedSize(updatesChannelDifferenceValue.timeout);
+        }
+        size += serializedSize(updatesChannelDifferenceValue.newMessages);
+        size += serializedSize(updatesChannelDifferenceValue.otherUpdates);
+        size += serializedSize(updatesChannelDifferenceValue.chats);
+        size += serializedSize(updatesChannelDifferenceValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLUpdatesDifference &updatesDifferenceValue)
+{
+    int size = serializedSize(updatesDifferenceValue.tlType);
+    switch (updatesDifferenceValue.tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        size += serializedSize(updatesDifferenceValue.date);
+        size += serializedSize(updatesDifferenceValue.seq);
+        break;
+    case TLValue::UpdatesDifference:
+        size += serializedSize(updatesDifferenceValue.newMessages);
+        size += serializedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += serializedSize(updatesDifferenceValue.otherUpdates);
+        size += serializedSize(updatesDifferenceValue.chats);
+        size += serializedSize(updatesDifferenceValue.users);
+        size += serializedSize(updatesDifferenceValue.state);
+        break;
+    case TLValue::UpdatesDifferenceSlice:
+        size += serializedSize(updatesDifferenceValue.newMessages);
+        size += serializedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += serializedSize(updatesDifferenceValue.otherUpdates);
+        size += serializedSize(updatesDifferenceValue.chats);
+        size += serializedSize(updatesDifferenceValue.users);
+        size += serializedSize(updatesDifferenceValue.intermediateState);
+        break;
+    case TLValue::UpdatesDifferenceTooLong:
+        size += serializedSize(updatesDifferenceValue.pts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelAdminLogEventAction &channelAdminLogEventActionValue)
+{
+    int size = serializedSize(channelAdminLogEventActionValue.tlType);
+    switch (channelAdminLogEventActionValue.tlType) {
+    case TLValue::ChannelAdminLogEventActionChangeTitle:
+    case TLValue::ChannelAdminLogEventActionChangeAbout:
+    case TLValue::ChannelAdminLogEventActionChangeUsername:
+        size += serializedSize(channelAdminLogEventActionValue.prevValue);
+        size += serializedSize(channelAdminLogEventActionValue.stringNewValue);
+        break;
+    case TLValue::ChannelAdminLogEventActionChangePhoto:
+        size += serializedSize(channelAdminLogEventActionValue.prevPhoto);
+        size += serializedSize(channelAdminLogEventActionValue.newPhoto);
+        break;
+    case TLValue::ChannelAdminLogEventActionToggleInvites:
+    case TLValue::ChannelAdminLogEventActionToggleSignatures:
+    case TLValue::ChannelAdminLogEventActionTogglePreHistoryHidden:
+        size += serializedSize(channelAdminLogEventActionValue.boolNewValue);
+        break;
+    case TLValue::ChannelAdminLogEventActionUpdatePinned:
+    case TLValue::ChannelAdminLogEventActionDeleteMessage:
+        size += serializedSize(*channelAdminLogEventActionValue.message);
+        break;
+    case TLValue::ChannelAdminLogEventActionEditMessage:
+        size += serializedSize(*channelAdminLogEventActionValue.prevMessage);
+        size += serializedSize(*channelAdminLogEventActionValue.newMessage);
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantJoin:
+    case TLValue::ChannelAdminLogEventActionParticipantLeave:
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantInvite:
+        size += serializedSize(channelAdminLogEventActionValue.participant);
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantToggleBan:
+    case TLValue::ChannelAdminLogEventActionParticipantToggleAdmin:
+        size += serializedSize(channelAdminLogEventActionValue.prevParticipant);
+        size += serializedSize(channelAdminLogEventActionValue.newParticipant);
+        break;
+    case TLValue::ChannelAdminLogEventActionChangeStickerSet:
+        size += serializedSize(channelAdminLogEventActionValue.prevStickerset);
+        size += serializedSize(channelAdminLogEventActionValue.newStickerset);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLPaymentsPaymentResult &paymentsPaymentResultValue)
+{
+    int size = serializedSize(paymentsPaymentResultValue.tlType);
+    switch (paymentsPaymentResultValue.tlType) {
+    case TLValue::PaymentsPaymentResult:
+        size += serializedSize(*paymentsPaymentResultValue.updates);
+        break;
+    case TLValue::PaymentsPaymentVerficationNeeded:
+        size += serializedSize(paymentsPaymentResultValue.url);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelAdminLogEvent &channelAdminLogEventValue)
+{
+    int size = serializedSize(channelAdminLogEventValue.tlType);
+    switch (channelAdminLogEventValue.tlType) {
+    case TLValue::ChannelAdminLogEvent:
+        size += serializedSize(channelAdminLogEventValue.id);
+        size += serializedSize(channelAdminLogEventValue.date);
+        size += serializedSize(channelAdminLogEventValue.userId);
+        size += serializedSize(channelAdminLogEventValue.action);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int serializedSize(const TLChannelsAdminLogResults &channelsAdminLogResultsValue)
+{
+    int size = serializedSize(channelsAdminLogResultsValue.tlType);
+    switch (channelsAdminLogResultsValue.tlType) {
+    case TLValue::ChannelsAdminLogResults:
+        size += serializedSize(channelsAdminLogResultsValue.events);
+        size += serializedSize(channelsAdminLogResultsValue.chats);
+        size += serializedSize(channelsAdminLogResultsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+// End of generated serialized size functions implementation
+
+} // MTProto namespace
+
+} // Telegram namespace
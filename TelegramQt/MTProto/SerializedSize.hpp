@@ -0,0 +1,327 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_QT_MTPROTO_SERIALIZED_SIZE_HPP
+#define TELEGRAM_QT_MTPROTO_SERIALIZED_SIZE_HPP
+
+#include "telegramqt_global.h"
+
+#include "AbridgedLength.hpp"
+#include "TLTypes.hpp"
+
+#include <QByteArray>
+#include <QString>
+
+namespace Telegram {
+
+namespace MTProto {
+
+// serializedSize() returns the exact number of bytes MTProto::Stream writes for the value,
+// so the output buffer can be allocated once before the serialization.
+
+constexpr int serializedSize(qint32) { return sizeof(qint32); }
+constexpr int serializedSize(quint32) { return sizeof(quint32); }
+constexpr int serializedSize(qint64) { return sizeof(qint64); }
+constexpr int serializedSize(quint64) { return sizeof(quint64); }
+constexpr int serializedSize(double) { return sizeof(double); }
+constexpr int serializedSize(bool) { return sizeof(quint32); } // Written as TLBool
+constexpr int serializedSize(TLValue) { return sizeof(quint32); }
+constexpr int serializedSize(const TLBool &) { return sizeof(quint32); }
+
+template <int Size>
+constexpr int serializedSize(const TLNumber<Size> &) { return Size / 8; }
+
+inline int serializedSize(const QByteArray &data)
+{
+    const AbridgedLength length(static_cast<quint32>(data.size()));
+    return length.packedSize() + data.size() + length.paddingForAlignment(4);
+}
+
+// The size of the UTF-8 representation, computed without the conversion
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const QString &str);
+
+template <typename T>
+int serializedSize(const TLVector<T> &v);
+template <typename T>
+int serializedSize(const TLVector<T*> &v);
+
+// Generated serialized size functions
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAccountDaysTTL &accountDaysTTLValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAccountPassword &accountPasswordValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAccountTmpPassword &accountTmpPasswordValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthCheckedPhone &authCheckedPhoneValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthCodeType &authCodeTypeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthSentCodeType &authSentCodeTypeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthorization &authorizationValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLBadMsgNotification &badMsgNotificationValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLBotCommand &botCommandValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLBotInfo &botInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLCdnFileHash &cdnFileHashValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLCdnPublicKey &cdnPublicKeyValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelParticipantsFilter &channelParticipantsFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChatParticipant &chatParticipantValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChatParticipants &chatParticipantsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLClientDHInnerData &clientDHInnerDataValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContact &contactValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactBlocked &contactBlockedValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactLink &contactLinkValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDataJSON &dataJSONValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDestroyAuthKeyRes &destroyAuthKeyResValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDestroySessionRes &destroySessionResValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDisabledFeature &disabledFeatureValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLEncryptedChat &encryptedChatValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLEncryptedFile &encryptedFileValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLEncryptedMessage &encryptedMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLError &errorValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLExportedChatInvite &exportedChatInviteValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLExportedMessageLink &exportedMessageLinkValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLFileLocation &fileLocationValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLFutureSalt &futureSaltValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLFutureSalts &futureSaltsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLGeoPoint &geoPointValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHelpAppUpdate &helpAppUpdateValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHelpInviteText &helpInviteTextValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHelpTermsOfService &helpTermsOfServiceValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHighScore &highScoreValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHttpWait &httpWaitValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLImportedContact &importedContactValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInlineBotSwitchPM &inlineBotSwitchPMValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputAppEvent &inputAppEventValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputBotInlineMessageID &inputBotInlineMessageIDValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputChannel &inputChannelValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputContact &inputContactValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputDocument &inputDocumentValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputEncryptedChat &inputEncryptedChatValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputEncryptedFile &inputEncryptedFileValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputFile &inputFileValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputFileLocation &inputFileLocationValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputGeoPoint &inputGeoPointValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPeer &inputPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPhoneCall &inputPhoneCallValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPhoto &inputPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPrivacyKey &inputPrivacyKeyValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputStickerSet &inputStickerSetValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputStickeredMedia &inputStickeredMediaValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputUser &inputUserValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputWebFileLocation &inputWebFileLocationValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLIpPort &ipPortValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLLabeledPrice &labeledPriceValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLLangPackLanguage &langPackLanguageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLLangPackString &langPackStringValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMaskCoords &maskCoordsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessageEntity &messageEntityValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessageFwdHeader &messageFwdHeaderValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessageRange &messageRangeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesAffectedHistory &messagesAffectedHistoryValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesAffectedMessages &messagesAffectedMessagesValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesDhConfig &messagesDhConfigValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMsgDetailedInfo &msgDetailedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMsgResendReq &msgResendReqValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMsgsAck &msgsAckValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMsgsAllInfo &msgsAllInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMsgsStateInfo &msgsStateInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMsgsStateReq &msgsStateReqValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLNearestDc &nearestDcValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLNewSession &newSessionValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPQInnerData &pQInnerDataValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentCharge &paymentChargeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentSavedCredentials &paymentSavedCredentialsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPeer &peerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPeerNotifyEvents &peerNotifyEventsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhoneCallDiscardReason &phoneCallDiscardReasonValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhoneConnection &phoneConnectionValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhotoSize &photoSizeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPong &pongValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPopularContact &popularContactValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPostAddress &postAddressValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPrivacyKey &privacyKeyValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPrivacyRule &privacyRuleValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLReceivedNotifyMessage &receivedNotifyMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLReportReason &reportReasonValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLResPQ &resPQValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLRichText &richTextValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLRpcDropAnswer &rpcDropAnswerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLRpcError &rpcErrorValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLSendMessageAction &sendMessageActionValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLServerDHInnerData &serverDHInnerDataValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLServerDHParams &serverDHParamsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLSetClientDHParamsAnswer &setClientDHParamsAnswerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLShippingOption &shippingOptionValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLStickerPack &stickerPackValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLStorageFileType &storageFileTypeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLTopPeer &topPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLTopPeerCategory &topPeerCategoryValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLTopPeerCategoryPeers &topPeerCategoryPeersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUpdatesState &updatesStateValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUploadCdnFile &uploadCdnFileValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUploadFile &uploadFileValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUploadWebFile &uploadWebFileValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUserProfilePhoto &userProfilePhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUserStatus &userStatusValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLWallPaper &wallPaperValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAccountAuthorizations &accountAuthorizationsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthSentCode &authSentCodeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLCdnConfig &cdnConfigValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelAdminLogEventsFilter &channelAdminLogEventsFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelAdminRights &channelAdminRightsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelBannedRights &channelBannedRightsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelMessagesFilter &channelMessagesFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelParticipant &channelParticipantValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChatPhoto &chatPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactStatus &contactStatusValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDcOption &dcOptionValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDocumentAttribute &documentAttributeValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDraftMessage &draftMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHelpConfigSimple &helpConfigSimpleValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputChatPhoto &inputChatPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputGame &inputGameValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputNotifyPeer &inputNotifyPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPaymentCredentials &inputPaymentCredentialsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputPrivacyRule &inputPrivacyRuleValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputStickerSetItem &inputStickerSetItemValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputWebDocument &inputWebDocumentValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInvoice &invoiceValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLKeyboardButton &keyboardButtonValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLKeyboardButtonRow &keyboardButtonRowValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLLangPackDifference &langPackDifferenceValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesBotCallbackAnswer &messagesBotCallbackAnswerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesFilter &messagesFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesMessageEditData &messagesMessageEditDataValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLNotifyPeer &notifyPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentsSavedInfo &paymentsSavedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentsValidatedRequestedInfo &paymentsValidatedRequestedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPeerNotifySettings &peerNotifySettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPeerSettings &peerSettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhoneCallProtocol &phoneCallProtocolValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhoto &photoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLReplyMarkup &replyMarkupValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLStickerSet &stickerSetValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUser &userValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLWebDocument &webDocumentValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLAuthAuthorization &authAuthorizationValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLBotInlineMessage &botInlineMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelsChannelParticipant &channelsChannelParticipantValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelsChannelParticipants &channelsChannelParticipantsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChat &chatValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChatFull &chatFullValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChatInvite &chatInviteValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLConfig &configValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactsBlocked &contactsBlockedValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactsContacts &contactsContactsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactsFound &contactsFoundValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactsImportedContacts &contactsImportedContactsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactsLink &contactsLinkValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactsResolvedPeer &contactsResolvedPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLContactsTopPeers &contactsTopPeersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDialog &dialogValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLDocument &documentValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLFoundGif &foundGifValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLGame &gameValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHelpSupport &helpSupportValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputBotInlineMessage &inputBotInlineMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputBotInlineResult &inputBotInlineResultValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLInputMedia &inputMediaValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessageAction &messageActionValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesAllStickers &messagesAllStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesChatFull &messagesChatFullValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesChats &messagesChatsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesFavedStickers &messagesFavedStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesFoundGifs &messagesFoundGifsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesHighScores &messagesHighScoresValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesRecentStickers &messagesRecentStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesSavedGifs &messagesSavedGifsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesStickerSet &messagesStickerSetValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesStickers &messagesStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPageBlock &pageBlockValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentsPaymentForm &paymentsPaymentFormValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentsPaymentReceipt &paymentsPaymentReceiptValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhoneCall &phoneCallValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhonePhoneCall &phonePhoneCallValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhotosPhoto &photosPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPhotosPhotos &photosPhotosValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLStickerSetCovered &stickerSetCoveredValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUserFull &userFullValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLBotInlineResult &botInlineResultValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesArchivedStickers &messagesArchivedStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesBotResults &messagesBotResultsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesFeaturedStickers &messagesFeaturedStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesStickerSetInstallResult &messagesStickerSetInstallResultValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPage &pageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLRecentMeUrl &recentMeUrlValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLWebPage &webPageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLHelpRecentMeUrls &helpRecentMeUrlsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessageMedia &messageMediaValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessage &messageValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesDialogs &messagesDialogsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesMessages &messagesMessagesValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLMessagesPeerDialogs &messagesPeerDialogsValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUpdate &updateValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUpdates &updatesValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUpdatesChannelDifference &updatesChannelDifferenceValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLUpdatesDifference &updatesDifferenceValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelAdminLogEventAction &channelAdminLogEventActionValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentsPaymentResult &paymentsPaymentResultValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelAdminLogEvent &channelAdminLogEventValue);
+TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLChannelsAdminLogResults &channelsAdminLogResultsValue);
+// End of generated serialized size functions
+
+template <typename T>
+int serializedSize(const TLVector<T> &v)
+{
+    int size = serializedSize(v.tlType);
+
+    if (v.tlType == TLValue::Vector) {
+        size += serializedSize(quint32(v.count()));
+
+        for (int i = 0; i < v.count(); ++i) {
+            size += serializedSize(v.at(i));
+        }
+    }
+
+    return size;
+}
+
+template <typename T>
+int serializedSize(const TLVector<T*> &v)
+{
+    int size = serializedSize(v.tlType);
+
+    if (v.tlType == TLValue::Vector) {
+        size += serializedSize(quint32(v.count()));
+
+        for (int i = 0; i < v.count(); ++i) {
+            size += serializedSize(*v.at(i));
+        }
+    }
+
+    return size;
+}
+
+} // MTProto namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_QT_MTPROTO_SERIALIZED_SIZE_HPP
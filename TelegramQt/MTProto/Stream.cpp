@@ -154,7 +154,7 @@ Stream &Stream::operator>>(TLAccountDaysTTL &accountDaysTTLValue)
         break;
     }
 
-    accountDaysTTLValue = result;
+    accountDaysTTLValue = std::move(result);
 
     return *this;
 }
@@ -181,7 +181,7 @@ Stream &Stream::operator>>(TLAccountPassword &accountPasswordValue)
         break;
     }
 
-    accountPasswordValue = result;
+    accountPasswordValue = std::move(result);
 
     return *this;
 }
@@ -212,7 +212,7 @@ Stream &Stream::operator>>(TLAccountPasswordInputSettings &accountPasswordInputS
         break;
     }
 
-    accountPasswordInputSettingsValue = result;
+    accountPasswordInputSettingsValue = std::move(result);
 
     return *this;
 }
@@ -231,7 +231,7 @@ Stream &Stream::operator>>(TLAccountPasswordSettings &accountPasswordSettingsVal
         break;
     }
 
-    accountPasswordSettingsValue = result;
+    accountPasswordSettingsValue = std::move(result);
 
     return *this;
 }
@@ -251,7 +251,7 @@ Stream &Stream::operator>>(TLAccountTmpPassword &accountTmpPasswordValue)
         break;
     }
 
-    accountTmpPasswordValue = result;
+    accountTmpPasswordValue = std::move(result);
 
     return *this;
 }
@@ -270,7 +270,7 @@ Stream &Stream::operator>>(TLAuthCheckedPhone &authCheckedPhoneValue)
         break;
     }
 
-    authCheckedPhoneValue = result;
+    authCheckedPhoneValue = std::move(result);
 
     return *this;
 }
@@ -290,7 +290,7 @@ Stream &Stream::operator>>(TLAuthCodeType &authCodeTypeValue)
         break;
     }
 
-    authCodeTypeValue = result;
+    authCodeTypeValue = std::move(result);
 
     return *this;
 }
@@ -310,7 +310,7 @@ Stream &Stream::operator>>(TLAuthExportedAuthorization &authExportedAuthorizatio
         break;
     }
 
-    authExportedAuthorizationValue = result;
+    authExportedAuthorizationValue = std::move(result);
 
     return *this;
 }
@@ -329,7 +329,7 @@ Stream &Stream::operator>>(TLAuthPasswordRecovery &authPasswordRecoveryValue)
         break;
     }
 
-    authPasswordRecoveryValue = result;
+    authPasswordRecoveryValue = std::move(result);
 
     return *this;
 }
@@ -353,7 +353,7 @@ Stream &Stream::operator>>(TLAuthSentCodeType &authSentCodeTypeValue)
         break;
     }
 
-    authSentCodeTypeValue = result;
+    authSentCodeTypeValue = std::move(result);
 
     return *this;
 }
@@ -384,7 +384,7 @@ Stream &Stream::operator>>(TLAuthorization &authorizationValue)
         break;
     }
 
-    authorizationValue = result;
+    authorizationValue = std::move(result);
 
     return *this;
 }
@@ -411,7 +411,7 @@ Stream &Stream::operator>>(TLBadMsgNotification &badMsgNotificationValue)
         break;
     }
 
-    badMsgNotificationValue = result;
+    badMsgNotificationValue = std::move(result);
 
     return *this;
 }
@@ -431,7 +431,7 @@ Stream &Stream::operator>>(TLBotCommand &botCommandValue)
         break;
     }
 
-    botCommandValue = result;
+    botCommandValue = std::move(result);
 
     return *this;
 }
@@ -452,7 +452,7 @@ Stream &Stream::operator>>(TLBotInfo &botInfoValue)
         break;
     }
 
-    botInfoValue = result;
+    botInfoValue = std::move(result);
 
     return *this;
 }
@@ -473,7 +473,7 @@ Stream &Stream::operator>>(TLCdnFileHash &cdnFileHashValue)
         break;
     }
 
-    cdnFileHashValue = result;
+    cdnFileHashValue = std::move(result);
 
     return *this;
 }
@@ -493,7 +493,7 @@ Stream &Stream::operator>>(TLCdnPublicKey &cdnPublicKeyValue)
         break;
     }
 
-    cdnPublicKeyValue = result;
+    cdnPublicKeyValue = std::move(result);
 
     return *this;
 }
@@ -518,7 +518,7 @@ Stream &Stream::operator>>(TLChannelParticipantsFilter &channelParticipantsFilte
         break;
     }
 
-    channelParticipantsFilterValue = result;
+    channelParticipantsFilterValue = std::move(result);
 
     return *this;
 }
@@ -543,7 +543,7 @@ Stream &Stream::operator>>(TLChatParticipant &chatParticipantValue)
         break;
     }
 
-    chatParticipantValue = result;
+    chatParticipantValue = std::move(result);
 
     return *this;
 }
@@ -571,7 +571,7 @@ Stream &Stream::operator>>(TLChatParticipants &chatParticipantsValue)
         break;
     }
 
-    chatParticipantsValue = result;
+    chatParticipantsValue = std::move(result);
 
     return *this;
 }
@@ -593,7 +593,7 @@ Stream &Stream::operator>>(TLClientDHInnerData &clientDHInnerDataValue)
         break;
     }
 
-    clientDHInnerDataValue = result;
+    clientDHInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -613,7 +613,7 @@ Stream &Stream::operator>>(TLContact &contactValue)
         break;
     }
 
-    contactValue = result;
+    contactValue = std::move(result);
 
     return *this;
 }
@@ -633,7 +633,7 @@ Stream &Stream::operator>>(TLContactBlocked &contactBlockedValue)
         break;
     }
 
-    contactBlockedValue = result;
+    contactBlockedValue = std::move(result);
 
     return *this;
 }
@@ -654,7 +654,7 @@ Stream &Stream::operator>>(TLContactLink &contactLinkValue)
         break;
     }
 
-    contactLinkValue = result;
+    contactLinkValue = std::move(result);
 
     return *this;
 }
@@ -673,7 +673,7 @@ Stream &Stream::operator>>(TLDataJSON &dataJSONValue)
         break;
     }
 
-    dataJSONValue = result;
+    dataJSONValue = std::move(result);
 
     return *this;
 }
@@ -693,7 +693,7 @@ Stream &Stream::operator>>(TLDestroyAuthKeyRes &destroyAuthKeyResValue)
         break;
     }
 
-    destroyAuthKeyResValue = result;
+    destroyAuthKeyResValue = std::move(result);
 
     return *this;
 }
@@ -713,7 +713,7 @@ Stream &Stream::operator>>(TLDestroySessionRes &destroySessionResValue)
         break;
     }
 
-    destroySessionResValue = result;
+    destroySessionResValue = std::move(result);
 
     return *this;
 }
@@ -733,7 +733,7 @@ Stream &Stream::operator>>(TLDisabledFeature &disabledFeatureValue)
         break;
     }
 
-    disabledFeatureValue = result;
+    disabledFeatureValue = std::move(result);
 
     return *this;
 }
@@ -777,7 +777,7 @@ Stream &Stream::operator>>(TLEncryptedChat &encryptedChatValue)
         break;
     }
 
-    encryptedChatValue = result;
+    encryptedChatValue = std::move(result);
 
     return *this;
 }
@@ -802,7 +802,7 @@ Stream &Stream::operator>>(TLEncryptedFile &encryptedFileValue)
         break;
     }
 
-    encryptedFileValue = result;
+    encryptedFileValue = std::move(result);
 
     return *this;
 }
@@ -831,7 +831,7 @@ Stream &Stream::operator>>(TLEncryptedMessage &encryptedMessageValue)
         break;
     }
 
-    encryptedMessageValue = result;
+    encryptedMessageValue = std::move(result);
 
     return *this;
 }
@@ -851,7 +851,7 @@ Stream &Stream::operator>>(TLError &errorValue)
         break;
     }
 
-    errorValue = result;
+    errorValue = std::move(result);
 
     return *this;
 }
@@ -872,7 +872,7 @@ Stream &Stream::operator>>(TLExportedChatInvite &exportedChatInviteValue)
         break;
     }
 
-    exportedChatInviteValue = result;
+    exportedChatInviteValue = std::move(result);
 
     return *this;
 }
@@ -891,7 +891,7 @@ Stream &Stream::operator>>(TLExportedMessageLink &exportedMessageLinkValue)
         break;
     }
 
-    exportedMessageLinkValue = result;
+    exportedMessageLinkValue = std::move(result);
 
     return *this;
 }
@@ -918,7 +918,7 @@ Stream &Stream::operator>>(TLFileLocation &fileLocationValue)
         break;
     }
 
-    fileLocationValue = result;
+    fileLocationValue = std::move(result);
 
     return *this;
 }
@@ -939,7 +939,7 @@ Stream &Stream::operator>>(TLFutureSalt &futureSaltValue)
         break;
     }
 
-    futureSaltValue = result;
+    futureSaltValue = std::move(result);
 
     return *this;
 }
@@ -960,7 +960,7 @@ Stream &Stream::operator>>(TLFutureSalts &futureSaltsValue)
         break;
     }
 
-    futureSaltsValue = result;
+    futureSaltsValue = std::move(result);
 
     return *this;
 }
@@ -982,7 +982,7 @@ Stream &Stream::operator>>(TLGeoPoint &geoPointValue)
         break;
     }
 
-    geoPointValue = result;
+    geoPointValue = std::move(result);
 
     return *this;
 }
@@ -1006,7 +1006,7 @@ Stream &Stream::operator>>(TLHelpAppUpdate &helpAppUpdateValue)
         break;
     }
 
-    helpAppUpdateValue = result;
+    helpAppUpdateValue = std::move(result);
 
     return *this;
 }
@@ -1025,7 +1025,7 @@ Stream &Stream::operator>>(TLHelpInviteText &helpInviteTextValue)
         break;
     }
 
-    helpInviteTextValue = result;
+    helpInviteTextValue = std::move(result);
 
     return *this;
 }
@@ -1044,7 +1044,7 @@ Stream &Stream::operator>>(TLHelpTermsOfService &helpTermsOfServiceValue)
         break;
     }
 
-    helpTermsOfServiceValue = result;
+    helpTermsOfServiceValue = std::move(result);
 
     return *this;
 }
@@ -1065,7 +1065,7 @@ Stream &Stream::operator>>(TLHighScore &highScoreValue)
         break;
     }
 
-    highScoreValue = result;
+    highScoreValue = std::move(result);
 
     return *this;
 }
@@ -1086,7 +1086,7 @@ Stream &Stream::operator>>(TLHttpWait &httpWaitValue)
         break;
     }
 
-    httpWaitValue = result;
+    httpWaitValue = std::move(result);
 
     return *this;
 }
@@ -1106,7 +1106,7 @@ Stream &Stream::operator>>(TLImportedContact &importedContactValue)
         break;
     }
 
-    importedContactValue = result;
+    importedContactValue = std::move(result);
 
     return *this;
 }
@@ -1126,7 +1126,7 @@ Stream &Stream::operator>>(TLInlineBotSwitchPM &inlineBotSwitchPMValue)
         break;
     }
 
-    inlineBotSwitchPMValue = result;
+    inlineBotSwitchPMValue = std::move(result);
 
     return *this;
 }
@@ -1148,7 +1148,7 @@ Stream &Stream::operator>>(TLInputAppEvent &inputAppEventValue)
         break;
     }
 
-    inputAppEventValue = result;
+    inputAppEventValue = std::move(result);
 
     return *this;
 }
@@ -1169,7 +1169,7 @@ Stream &Stream::operator>>(TLInputBotInlineMessageID &inputBotInlineMessageIDVal
         break;
     }
 
-    inputBotInlineMessageIDValue = result;
+    inputBotInlineMessageIDValue = std::move(result);
 
     return *this;
 }
@@ -1191,7 +1191,7 @@ Stream &Stream::operator>>(TLInputChannel &inputChannelValue)
         break;
     }
 
-    inputChannelValue = result;
+    inputChannelValue = std::move(result);
 
     return *this;
 }
@@ -1213,7 +1213,7 @@ Stream &Stream::operator>>(TLInputContact &inputContactValue)
         break;
     }
 
-    inputContactValue = result;
+    inputContactValue = std::move(result);
 
     return *this;
 }
@@ -1235,7 +1235,7 @@ Stream &Stream::operator>>(TLInputDocument &inputDocumentValue)
         break;
     }
 
-    inputDocumentValue = result;
+    inputDocumentValue = std::move(result);
 
     return *this;
 }
@@ -1255,7 +1255,7 @@ Stream &Stream::operator>>(TLInputEncryptedChat &inputEncryptedChatValue)
         break;
     }
 
-    inputEncryptedChatValue = result;
+    inputEncryptedChatValue = std::move(result);
 
     return *this;
 }
@@ -1288,7 +1288,7 @@ Stream &Stream::operator>>(TLInputEncryptedFile &inputEncryptedFileValue)
         break;
     }
 
-    inputEncryptedFileValue = result;
+    inputEncryptedFileValue = std::move(result);
 
     return *this;
 }
@@ -1315,7 +1315,7 @@ Stream &Stream::operator>>(TLInputFile &inputFileValue)
         break;
     }
 
-    inputFileValue = result;
+    inputFileValue = std::move(result);
 
     return *this;
 }
@@ -1345,7 +1345,7 @@ Stream &Stream::operator>>(TLInputFileLocation &inputFileLocationValue)
         break;
     }
 
-    inputFileLocationValue = result;
+    inputFileLocationValue = std::move(result);
 
     return *this;
 }
@@ -1367,7 +1367,7 @@ Stream &Stream::operator>>(TLInputGeoPoint &inputGeoPointValue)
         break;
     }
 
-    inputGeoPointValue = result;
+    inputGeoPointValue = std::move(result);
 
     return *this;
 }
@@ -1397,7 +1397,7 @@ Stream &Stream::operator>>(TLInputPeer &inputPeerValue)
         break;
     }
 
-    inputPeerValue = result;
+    inputPeerValue = std::move(result);
 
     return *this;
 }
@@ -1416,7 +1416,7 @@ Stream &Stream::operator>>(TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
         break;
     }
 
-    inputPeerNotifyEventsValue = result;
+    inputPeerNotifyEventsValue = std::move(result);
 
     return *this;
 }
@@ -1436,7 +1436,7 @@ Stream &Stream::operator>>(TLInputPhoneCall &inputPhoneCallValue)
         break;
     }
 
-    inputPhoneCallValue = result;
+    inputPhoneCallValue = std::move(result);
 
     return *this;
 }
@@ -1458,7 +1458,7 @@ Stream &Stream::operator>>(TLInputPhoto &inputPhotoValue)
         break;
     }
 
-    inputPhotoValue = result;
+    inputPhotoValue = std::move(result);
 
     return *this;
 }
@@ -1478,7 +1478,7 @@ Stream &Stream::operator>>(TLInputPrivacyKey &inputPrivacyKeyValue)
         break;
     }
 
-    inputPrivacyKeyValue = result;
+    inputPrivacyKeyValue = std::move(result);
 
     return *this;
 }
@@ -1503,7 +1503,7 @@ Stream &Stream::operator>>(TLInputStickerSet &inputStickerSetValue)
         break;
     }
 
-    inputStickerSetValue = result;
+    inputStickerSetValue = std::move(result);
 
     return *this;
 }
@@ -1525,7 +1525,7 @@ Stream &Stream::operator>>(TLInputStickeredMedia &inputStickeredMediaValue)
         break;
     }
 
-    inputStickeredMediaValue = result;
+    inputStickeredMediaValue = std::move(result);
 
     return *this;
 }
@@ -1548,7 +1548,7 @@ Stream &Stream::operator>>(TLInputUser &inputUserValue)
         break;
     }
 
-    inputUserValue = result;
+    inputUserValue = std::move(result);
 
     return *this;
 }
@@ -1568,7 +1568,7 @@ Stream &Stream::operator>>(TLInputWebFileLocation &inputWebFileLocationValue)
         break;
     }
 
-    inputWebFileLocationValue = result;
+    inputWebFileLocationValue = std::move(result);
 
     return *this;
 }
@@ -1588,7 +1588,7 @@ Stream &Stream::operator>>(TLIpPort &ipPortValue)
         break;
     }
 
-    ipPortValue = result;
+    ipPortValue = std::move(result);
 
     return *this;
 }
@@ -1608,7 +1608,7 @@ Stream &Stream::operator>>(TLLabeledPrice &labeledPriceValue)
         break;
     }
 
-    labeledPriceValue = result;
+    labeledPriceValue = std::move(result);
 
     return *this;
 }
@@ -1629,7 +1629,7 @@ Stream &Stream::operator>>(TLLangPackLanguage &langPackLanguageValue)
         break;
     }
 
-    langPackLanguageValue = result;
+    langPackLanguageValue = std::move(result);
 
     return *this;
 }
@@ -1672,7 +1672,7 @@ Stream &Stream::operator>>(TLLangPackString &langPackStringValue)
         break;
     }
 
-    langPackStringValue = result;
+    langPackStringValue = std::move(result);
 
     return *this;
 }
@@ -1694,7 +1694,7 @@ Stream &Stream::operator>>(TLMaskCoords &maskCoordsValue)
         break;
     }
 
-    maskCoordsValue = result;
+    maskCoordsValue = std::move(result);
 
     return *this;
 }
@@ -1742,7 +1742,7 @@ Stream &Stream::operator>>(TLMessageEntity &messageEntityValue)
         break;
     }
 
-    messageEntityValue = result;
+    messageEntityValue = std::move(result);
 
     return *this;
 }
@@ -1774,7 +1774,7 @@ Stream &Stream::operator>>(TLMessageFwdHeader &messageFwdHeaderValue)
         break;
     }
 
-    messageFwdHeaderValue = result;
+    messageFwdHeaderValue = std::move(result);
 
     return *this;
 }
@@ -1794,7 +1794,7 @@ Stream &Stream::operator>>(TLMessageRange &messageRangeValue)
         break;
     }
 
-    messageRangeValue = result;
+    messageRangeValue = std::move(result);
 
     return *this;
 }
@@ -1815,7 +1815,7 @@ Stream &Stream::operator>>(TLMessagesAffectedHistory &messagesAffectedHistoryVal
         break;
     }
 
-    messagesAffectedHistoryValue = result;
+    messagesAffectedHistoryValue = std::move(result);
 
     return *this;
 }
@@ -1835,7 +1835,7 @@ Stream &Stream::operator>>(TLMessagesAffectedMessages &messagesAffectedMessagesV
         break;
     }
 
-    messagesAffectedMessagesValue = result;
+    messagesAffectedMessagesValue = std::move(result);
 
     return *this;
 }
@@ -1860,7 +1860,7 @@ Stream &Stream::operator>>(TLMessagesDhConfig &messagesDhConfigValue)
         break;
     }
 
-    messagesDhConfigValue = result;
+    messagesDhConfigValue = std::move(result);
 
     return *this;
 }
@@ -1883,7 +1883,7 @@ Stream &Stream::operator>>(TLMessagesSentEncryptedMessage &messagesSentEncrypted
         break;
     }
 
-    messagesSentEncryptedMessageValue = result;
+    messagesSentEncryptedMessageValue = std::move(result);
 
     return *this;
 }
@@ -1910,7 +1910,7 @@ Stream &Stream::operator>>(TLMsgDetailedInfo &msgDetailedInfoValue)
         break;
     }
 
-    msgDetailedInfoValue = result;
+    msgDetailedInfoValue = std::move(result);
 
     return *this;
 }
@@ -1929,7 +1929,7 @@ Stream &Stream::operator>>(TLMsgResendReq &msgResendReqValue)
         break;
     }
 
-    msgResendReqValue = result;
+    msgResendReqValue = std::move(result);
 
     return *this;
 }
@@ -1948,7 +1948,7 @@ Stream &Stream::operator>>(TLMsgsAck &msgsAckValue)
         break;
     }
 
-    msgsAckValue = result;
+    msgsAckValue = std::move(result);
 
     return *this;
 }
@@ -1968,7 +1968,7 @@ Stream &Stream::operator>>(TLMsgsAllInfo &msgsAllInfoValue)
         break;
     }
 
-    msgsAllInfoValue = result;
+    msgsAllInfoValue = std::move(result);
 
     return *this;
 }
@@ -1988,7 +1988,7 @@ Stream &Stream::operator>>(TLMsgsStateInfo &msgsStateInfoValue)
         break;
     }
 
-    msgsStateInfoValue = result;
+    msgsStateInfoValue = std::move(result);
 
     return *this;
 }
@@ -2007,7 +2007,7 @@ Stream &Stream::operator>>(TLMsgsStateReq &msgsStateReqValue)
         break;
     }
 
-    msgsStateReqValue = result;
+    msgsStateReqValue = std::move(result);
 
     return *this;
 }
@@ -2028,7 +2028,7 @@ Stream &Stream::operator>>(TLNearestDc &nearestDcValue)
         break;
     }
 
-    nearestDcValue = result;
+    nearestDcValue = std::move(result);
 
     return *this;
 }
@@ -2049,7 +2049,7 @@ Stream &Stream::operator>>(TLNewSession &newSessionValue)
         break;
     }
 
-    newSessionValue = result;
+    newSessionValue = std::move(result);
 
     return *this;
 }
@@ -2073,7 +2073,7 @@ Stream &Stream::operator>>(TLPQInnerData &pQInnerDataValue)
         break;
     }
 
-    pQInnerDataValue = result;
+    pQInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -2093,7 +2093,7 @@ Stream &Stream::operator>>(TLPaymentCharge &paymentChargeValue)
         break;
     }
 
-    paymentChargeValue = result;
+    paymentChargeValue = std::move(result);
 
     return *this;
 }
@@ -2113,7 +2113,7 @@ Stream &Stream::operator>>(TLPaymentSavedCredentials &paymentSavedCredentialsVal
         break;
     }
 
-    paymentSavedCredentialsValue = result;
+    paymentSavedCredentialsValue = std::move(result);
 
     return *this;
 }
@@ -2138,7 +2138,7 @@ Stream &Stream::operator>>(TLPeer &peerValue)
         break;
     }
 
-    peerValue = result;
+    peerValue = std::move(result);
 
     return *this;
 }
@@ -2157,7 +2157,7 @@ Stream &Stream::operator>>(TLPeerNotifyEvents &peerNotifyEventsValue)
         break;
     }
 
-    peerNotifyEventsValue = result;
+    peerNotifyEventsValue = std::move(result);
 
     return *this;
 }
@@ -2178,7 +2178,7 @@ Stream &Stream::operator>>(TLPhoneCallDiscardReason &phoneCallDiscardReasonValue
         break;
     }
 
-    phoneCallDiscardReasonValue = result;
+    phoneCallDiscardReasonValue = std::move(result);
 
     return *this;
 }
@@ -2201,7 +2201,7 @@ Stream &Stream::operator>>(TLPhoneConnection &phoneConnectionValue)
         break;
     }
 
-    phoneConnectionValue = result;
+    phoneConnectionValue = std::move(result);
 
     return *this;
 }
@@ -2234,7 +2234,7 @@ Stream &Stream::operator>>(TLPhotoSize &photoSizeValue)
         break;
     }
 
-    photoSizeValue = result;
+    photoSizeValue = std::move(result);
 
     return *this;
 }
@@ -2254,7 +2254,7 @@ Stream &Stream::operator>>(TLPong &pongValue)
         break;
     }
 
-    pongValue = result;
+    pongValue = std::move(result);
 
     return *this;
 }
@@ -2274,7 +2274,7 @@ Stream &Stream::operator>>(TLPopularContact &popularContactValue)
         break;
     }
 
-    popularContactValue = result;
+    popularContactValue = std::move(result);
 
     return *this;
 }
@@ -2298,7 +2298,7 @@ Stream &Stream::operator>>(TLPostAddress &postAddressValue)
         break;
     }
 
-    postAddressValue = result;
+    postAddressValue = std::move(result);
 
     return *this;
 }
@@ -2318,7 +2318,7 @@ Stream &Stream::operator>>(TLPrivacyKey &privacyKeyValue)
         break;
     }
 
-    privacyKeyValue = result;
+    privacyKeyValue = std::move(result);
 
     return *this;
 }
@@ -2343,7 +2343,7 @@ Stream &Stream::operator>>(TLPrivacyRule &privacyRuleValue)
         break;
     }
 
-    privacyRuleValue = result;
+    privacyRuleValue = std::move(result);
 
     return *this;
 }
@@ -2363,7 +2363,7 @@ Stream &Stream::operator>>(TLReceivedNotifyMessage &receivedNotifyMessageValue)
         break;
     }
 
-    receivedNotifyMessageValue = result;
+    receivedNotifyMessageValue = std::move(result);
 
     return *this;
 }
@@ -2386,7 +2386,7 @@ Stream &Stream::operator>>(TLReportReason &reportReasonValue)
         break;
     }
 
-    reportReasonValue = result;
+    reportReasonValue = std::move(result);
 
     return *this;
 }
@@ -2408,7 +2408,7 @@ Stream &Stream::operator>>(TLResPQ &resPQValue)
         break;
     }
 
-    resPQValue = result;
+    resPQValue = std::move(result);
 
     return *this;
 }
@@ -2448,7 +2448,7 @@ Stream &Stream::operator>>(TLRichText &richTextValue)
         break;
     }
 
-    richTextValue = result;
+    richTextValue = std::move(result);
 
     return *this;
 }
@@ -2472,7 +2472,7 @@ Stream &Stream::operator>>(TLRpcDropAnswer &rpcDropAnswerValue)
         break;
     }
 
-    rpcDropAnswerValue = result;
+    rpcDropAnswerValue = std::move(result);
 
     return *this;
 }
@@ -2492,7 +2492,7 @@ Stream &Stream::operator>>(TLRpcError &rpcErrorValue)
         break;
     }
 
-    rpcErrorValue = result;
+    rpcErrorValue = std::move(result);
 
     return *this;
 }
@@ -2524,7 +2524,7 @@ Stream &Stream::operator>>(TLSendMessageAction &sendMessageActionValue)
         break;
     }
 
-    sendMessageActionValue = result;
+    sendMessageActionValue = std::move(result);
 
     return *this;
 }
@@ -2548,7 +2548,7 @@ Stream &Stream::operator>>(TLServerDHInnerData &serverDHInnerDataValue)
         break;
     }
 
-    serverDHInnerDataValue = result;
+    serverDHInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -2574,7 +2574,7 @@ Stream &Stream::operator>>(TLServerDHParams &serverDHParamsValue)
         break;
     }
 
-    serverDHParamsValue = result;
+    serverDHParamsValue = std::move(result);
 
     return *this;
 }
@@ -2605,7 +2605,7 @@ Stream &Stream::operator>>(TLSetClientDHParamsAnswer &setClientDHParamsAnswerVal
         break;
     }
 
-    setClientDHParamsAnswerValue = result;
+    setClientDHParamsAnswerValue = std::move(result);
 
     return *this;
 }
@@ -2626,7 +2626,7 @@ Stream &Stream::operator>>(TLShippingOption &shippingOptionValue)
         break;
     }
 
-    shippingOptionValue = result;
+    shippingOptionValue = std::move(result);
 
     return *this;
 }
@@ -2646,7 +2646,7 @@ Stream &Stream::operator>>(TLStickerPack &stickerPackValue)
         break;
     }
 
-    stickerPackValue = result;
+    stickerPackValue = std::move(result);
 
     return *this;
 }
@@ -2673,7 +2673,7 @@ Stream &Stream::operator>>(TLStorageFileType &storageFileTypeValue)
         break;
     }
 
-    storageFileTypeValue = result;
+    storageFileTypeValue = std::move(result);
 
     return *this;
 }
@@ -2693,7 +2693,7 @@ Stream &Stream::operator>>(TLTopPeer &topPeerValue)
         break;
     }
 
-    topPeerValue = result;
+    topPeerValue = std::move(result);
 
     return *this;
 }
@@ -2716,7 +2716,7 @@ Stream &Stream::operator>>(TLTopPeerCategory &topPeerCategoryValue)
         break;
     }
 
-    topPeerCategoryValue = result;
+    topPeerCategoryValue = std::move(result);
 
     return *this;
 }
@@ -2737,7 +2737,7 @@ Stream &Stream::operator>>(TLTopPeerCategoryPeers &topPeerCategoryPeersValue)
         break;
     }
 
-    topPeerCategoryPeersValue = result;
+    topPeerCategoryPeersValue = std::move(result);
 
     return *this;
 }
@@ -2760,7 +2760,7 @@ Stream &Stream::operator>>(TLUpdatesState &updatesStateValue)
         break;
     }
 
-    updatesStateValue = result;
+    updatesStateValue = std::move(result);
 
     return *this;
 }
@@ -2782,7 +2782,7 @@ Stream &Stream::operator>>(TLUploadCdnFile &uploadCdnFileValue)
         break;
     }
 
-    uploadCdnFileValue = result;
+    uploadCdnFileValue = std::move(result);
 
     return *this;
 }
@@ -2810,7 +2810,7 @@ Stream &Stream::operator>>(TLUploadFile &uploadFileValue)
         break;
     }
 
-    uploadFileValue = result;
+    uploadFileValue = std::move(result);
 
     return *this;
 }
@@ -2833,7 +2833,7 @@ Stream &Stream::operator>>(TLUploadWebFile &uploadWebFileValue)
         break;
     }
 
-    uploadWebFileValue = result;
+    uploadWebFileValue = std::move(result);
 
     return *this;
 }
@@ -2856,7 +2856,7 @@ Stream &Stream::operator>>(TLUserProfilePhoto &userProfilePhotoValue)
         break;
     }
 
-    userProfilePhotoValue = result;
+    userProfilePhotoValue = std::move(result);
 
     return *this;
 }
@@ -2883,7 +2883,7 @@ Stream &Stream::operator>>(TLUserStatus &userStatusValue)
         break;
     }
 
-    userStatusValue = result;
+    userStatusValue = std::move(result);
 
     return *this;
 }
@@ -2911,7 +2911,7 @@ Stream &Stream::operator>>(TLWallPaper &wallPaperValue)
         break;
     }
 
-    wallPaperValue = result;
+    wallPaperValue = std::move(result);
 
     return *this;
 }
@@ -2930,7 +2930,7 @@ Stream &Stream::operator>>(TLAccountAuthorizations &accountAuthorizationsValue)
         break;
     }
 
-    accountAuthorizationsValue = result;
+    accountAuthorizationsValue = std::move(result);
 
     return *this;
 }
@@ -2957,7 +2957,7 @@ Stream &Stream::operator>>(TLAuthSentCode &authSentCodeValue)
         break;
     }
 
-    authSentCodeValue = result;
+    authSentCodeValue = std::move(result);
 
     return *this;
 }
@@ -2976,7 +2976,7 @@ Stream &Stream::operator>>(TLCdnConfig &cdnConfigValue)
         break;
     }
 
-    cdnConfigValue = result;
+    cdnConfigValue = std::move(result);
 
     return *this;
 }
@@ -2995,7 +2995,7 @@ Stream &Stream::operator>>(TLChannelAdminLogEventsFilter &channelAdminLogEventsF
         break;
     }
 
-    channelAdminLogEventsFilterValue = result;
+    channelAdminLogEventsFilterValue = std::move(result);
 
     return *this;
 }
@@ -3014,7 +3014,7 @@ Stream &Stream::operator>>(TLChannelAdminRights &channelAdminRightsValue)
         break;
     }
 
-    channelAdminRightsValue = result;
+    channelAdminRightsValue = std::move(result);
 
     return *this;
 }
@@ -3034,7 +3034,7 @@ Stream &Stream::operator>>(TLChannelBannedRights &channelBannedRightsValue)
         break;
     }
 
-    channelBannedRightsValue = result;
+    channelBannedRightsValue = std::move(result);
 
     return *this;
 }
@@ -3056,7 +3056,7 @@ Stream &Stream::operator>>(TLChannelMessagesFilter &channelMessagesFilterValue)
         break;
     }
 
-    channelMessagesFilterValue = result;
+    channelMessagesFilterValue = std::move(result);
 
     return *this;
 }
@@ -3099,7 +3099,7 @@ Stream &Stream::operator>>(TLChannelParticipant &channelParticipantValue)
         break;
     }
 
-    channelParticipantValue = result;
+    channelParticipantValue = std::move(result);
 
     return *this;
 }
@@ -3121,7 +3121,7 @@ Stream &Stream::operator>>(TLChatPhoto &chatPhotoValue)
         break;
     }
 
-    chatPhotoValue = result;
+    chatPhotoValue = std::move(result);
 
     return *this;
 }
@@ -3141,7 +3141,7 @@ Stream &Stream::operator>>(TLContactStatus &contactStatusValue)
         break;
     }
 
-    contactStatusValue = result;
+    contactStatusValue = std::move(result);
 
     return *this;
 }
@@ -3163,7 +3163,7 @@ Stream &Stream::operator>>(TLDcOption &dcOptionValue)
         break;
     }
 
-    dcOptionValue = result;
+    dcOptionValue = std::move(result);
 
     return *this;
 }
@@ -3216,7 +3216,7 @@ Stream &Stream::operator>>(TLDocumentAttribute &documentAttributeValue)
         break;
     }
 
-    documentAttributeValue = result;
+    documentAttributeValue = std::move(result);
 
     return *this;
 }
@@ -3245,7 +3245,7 @@ Stream &Stream::operator>>(TLDraftMessage &draftMessageValue)
         break;
     }
 
-    draftMessageValue = result;
+    draftMessageValue = std::move(result);
 
     return *this;
 }
@@ -3267,7 +3267,7 @@ Stream &Stream::operator>>(TLHelpConfigSimple &helpConfigSimpleValue)
         break;
     }
 
-    helpConfigSimpleValue = result;
+    helpConfigSimpleValue = std::move(result);
 
     return *this;
 }
@@ -3291,7 +3291,7 @@ Stream &Stream::operator>>(TLInputChatPhoto &inputChatPhotoValue)
         break;
     }
 
-    inputChatPhotoValue = result;
+    inputChatPhotoValue = std::move(result);
 
     return *this;
 }
@@ -3315,7 +3315,7 @@ Stream &Stream::operator>>(TLInputGame &inputGameValue)
         break;
     }
 
-    inputGameValue = result;
+    inputGameValue = std::move(result);
 
     return *this;
 }
@@ -3338,7 +3338,7 @@ Stream &Stream::operator>>(TLInputNotifyPeer &inputNotifyPeerValue)
         break;
     }
 
-    inputNotifyPeerValue = result;
+    inputNotifyPeerValue = std::move(result);
 
     return *this;
 }
@@ -3368,7 +3368,7 @@ Stream &Stream::operator>>(TLInputPaymentCredentials &inputPaymentCredentialsVal
         break;
     }
 
-    inputPaymentCredentialsValue = result;
+    inputPaymentCredentialsValue = std::move(result);
 
     return *this;
 }
@@ -3389,7 +3389,7 @@ Stream &Stream::operator>>(TLInputPeerNotifySettings &inputPeerNotifySettingsVal
         break;
     }
 
-    inputPeerNotifySettingsValue = result;
+    inputPeerNotifySettingsValue = std::move(result);
 
     return *this;
 }
@@ -3414,7 +3414,7 @@ Stream &Stream::operator>>(TLInputPrivacyRule &inputPrivacyRuleValue)
         break;
     }
 
-    inputPrivacyRuleValue = result;
+    inputPrivacyRuleValue = std::move(result);
 
     return *this;
 }
@@ -3438,7 +3438,7 @@ Stream &Stream::operator>>(TLInputStickerSetItem &inputStickerSetItemValue)
         break;
     }
 
-    inputStickerSetItemValue = result;
+    inputStickerSetItemValue = std::move(result);
 
     return *this;
 }
@@ -3460,7 +3460,7 @@ Stream &Stream::operator>>(TLInputWebDocument &inputWebDocumentValue)
         break;
     }
 
-    inputWebDocumentValue = result;
+    inputWebDocumentValue = std::move(result);
 
     return *this;
 }
@@ -3481,7 +3481,7 @@ Stream &Stream::operator>>(TLInvoice &invoiceValue)
         break;
     }
 
-    invoiceValue = result;
+    invoiceValue = std::move(result);
 
     return *this;
 }
@@ -3517,7 +3517,7 @@ Stream &Stream::operator>>(TLKeyboardButton &keyboardButtonValue)
         break;
     }
 
-    keyboardButtonValue = result;
+    keyboardButtonValue = std::move(result);
 
     return *this;
 }
@@ -3536,7 +3536,7 @@ Stream &Stream::operator>>(TLKeyboardButtonRow &keyboardButtonRowValue)
         break;
     }
 
-    keyboardButtonRowValue = result;
+    keyboardButtonRowValue = std::move(result);
 
     return *this;
 }
@@ -3558,7 +3558,7 @@ Stream &Stream::operator>>(TLLangPackDifference &langPackDifferenceValue)
         break;
     }
 
-    langPackDifferenceValue = result;
+    langPackDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -3584,7 +3584,7 @@ Stream &Stream::operator>>(TLMessagesBotCallbackAnswer &messagesBotCallbackAnswe
         break;
     }
 
-    messagesBotCallbackAnswerValue = result;
+    messagesBotCallbackAnswerValue = std::move(result);
 
     return *this;
 }
@@ -3619,7 +3619,7 @@ Stream &Stream::operator>>(TLMessagesFilter &messagesFilterValue)
         break;
     }
 
-    messagesFilterValue = result;
+    messagesFilterValue = std::move(result);
 
     return *this;
 }
@@ -3638,7 +3638,7 @@ Stream &Stream::operator>>(TLMessagesMessageEditData &messagesMessageEditDataVal
         break;
     }
 
-    messagesMessageEditDataValue = result;
+    messagesMessageEditDataValue = std::move(result);
 
     return *this;
 }
@@ -3661,7 +3661,7 @@ Stream &Stream::operator>>(TLNotifyPeer &notifyPeerValue)
         break;
     }
 
-    notifyPeerValue = result;
+    notifyPeerValue = std::move(result);
 
     return *this;
 }
@@ -3692,7 +3692,7 @@ Stream &Stream::operator>>(TLPaymentRequestedInfo &paymentRequestedInfoValue)
         break;
     }
 
-    paymentRequestedInfoValue = result;
+    paymentRequestedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3714,7 +3714,7 @@ Stream &Stream::operator>>(TLPaymentsSavedInfo &paymentsSavedInfoValue)
         break;
     }
 
-    paymentsSavedInfoValue = result;
+    paymentsSavedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3739,7 +3739,7 @@ Stream &Stream::operator>>(TLPaymentsValidatedRequestedInfo &paymentsValidatedRe
         break;
     }
 
-    paymentsValidatedRequestedInfoValue = result;
+    paymentsValidatedRequestedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3762,7 +3762,7 @@ Stream &Stream::operator>>(TLPeerNotifySettings &peerNotifySettingsValue)
         break;
     }
 
-    peerNotifySettingsValue = result;
+    peerNotifySettingsValue = std::move(result);
 
     return *this;
 }
@@ -3781,7 +3781,7 @@ Stream &Stream::operator>>(TLPeerSettings &peerSettingsValue)
         break;
     }
 
-    peerSettingsValue = result;
+    peerSettingsValue = std::move(result);
 
     return *this;
 }
@@ -3802,7 +3802,7 @@ Stream &Stream::operator>>(TLPhoneCallProtocol &phoneCallProtocolValue)
         break;
     }
 
-    phoneCallProtocolValue = result;
+    phoneCallProtocolValue = std::move(result);
 
     return *this;
 }
@@ -3828,7 +3828,7 @@ Stream &Stream::operator>>(TLPhoto &photoValue)
         break;
     }
 
-    photoValue = result;
+    photoValue = std::move(result);
 
     return *this;
 }
@@ -3855,7 +3855,7 @@ Stream &Stream::operator>>(TLReplyMarkup &replyMarkupValue)
         break;
     }
 
-    replyMarkupValue = result;
+    replyMarkupValue = std::move(result);
 
     return *this;
 }
@@ -3880,7 +3880,7 @@ Stream &Stream::operator>>(TLStickerSet &stickerSetValue)
         break;
     }
 
-    stickerSetValue = result;
+    stickerSetValue = std::move(result);
 
     return *this;
 }
@@ -3936,7 +3936,7 @@ Stream &Stream::operator>>(TLUser &userValue)
         break;
     }
 
-    userValue = result;
+    userValue = std::move(result);
 
     return *this;
 }
@@ -3960,7 +3960,7 @@ Stream &Stream::operator>>(TLWebDocument &webDocumentValue)
         break;
     }
 
-    webDocumentValue = result;
+    webDocumentValue = std::move(result);
 
     return *this;
 }
@@ -3980,7 +3980,7 @@ Stream &Stream::operator>>(TLAccountPrivacyRules &accountPrivacyRulesValue)
         break;
     }
 
-    accountPrivacyRulesValue = result;
+    accountPrivacyRulesValue = std::move(result);
 
     return *this;
 }
@@ -4003,7 +4003,7 @@ Stream &Stream::operator>>(TLAuthAuthorization &authAuthorizationValue)
         break;
     }
 
-    authAuthorizationValue = result;
+    authAuthorizationValue = std::move(result);
 
     return *this;
 }
@@ -4064,7 +4064,7 @@ Stream &Stream::operator>>(TLBotInlineMessage &botInlineMessageValue)
         break;
     }
 
-    botInlineMessageValue = result;
+    botInlineMessageValue = std::move(result);
 
     return *this;
 }
@@ -4084,7 +4084,7 @@ Stream &Stream::operator>>(TLChannelsChannelParticipant &channelsChannelParticip
         break;
     }
 
-    channelsChannelParticipantValue = result;
+    channelsChannelParticipantValue = std::move(result);
 
     return *this;
 }
@@ -4107,7 +4107,7 @@ Stream &Stream::operator>>(TLChannelsChannelParticipants &channelsChannelPartici
         break;
     }
 
-    channelsChannelParticipantsValue = result;
+    channelsChannelParticipantsValue = std::move(result);
 
     return *this;
 }
@@ -4174,7 +4174,7 @@ Stream &Stream::operator>>(TLChat &chatValue)
         break;
     }
 
-    chatValue = result;
+    chatValue = std::move(result);
 
     return *this;
 }
@@ -4237,7 +4237,7 @@ Stream &Stream::operator>>(TLChatFull &chatFullValue)
         break;
     }
 
-    chatFullValue = result;
+    chatFullValue = std::move(result);
 
     return *this;
 }
@@ -4250,7 +4250,7 @@ Stream &Stream::operator>>(TLChatInvite &chatInviteValue)
 
     switch (result.tlType) {
     case TLValue::ChatInviteAlready:
-        *this >> result.chat;
+        *this >> *result.chat;
         break;
     case TLValue::ChatInvite:
         *this >> result.flags;
@@ -4265,7 +4265,7 @@ Stream &Stream::operator>>(TLChatInvite &chatInviteValue)
         break;
     }
 
-    chatInviteValue = result;
+    chatInviteValue = std::move(result);
 
     return *this;
 }
@@ -4323,7 +4323,7 @@ Stream &Stream::operator>>(TLConfig &configValue)
         break;
     }
 
-    configValue = result;
+    configValue = std::move(result);
 
     return *this;
 }
@@ -4348,7 +4348,7 @@ Stream &Stream::operator>>(TLContactsBlocked &contactsBlockedValue)
         break;
     }
 
-    contactsBlockedValue = result;
+    contactsBlockedValue = std::move(result);
 
     return *this;
 }
@@ -4371,7 +4371,7 @@ Stream &Stream::operator>>(TLContactsContacts &contactsContactsValue)
         break;
     }
 
-    contactsContactsValue = result;
+    contactsContactsValue = std::move(result);
 
     return *this;
 }
@@ -4392,7 +4392,7 @@ Stream &Stream::operator>>(TLContactsFound &contactsFoundValue)
         break;
     }
 
-    contactsFoundValue = result;
+    contactsFoundValue = std::move(result);
 
     return *this;
 }
@@ -4414,7 +4414,7 @@ Stream &Stream::operator>>(TLContactsImportedContacts &contactsImportedContactsV
         break;
     }
 
-    contactsImportedContactsValue = result;
+    contactsImportedContactsValue = std::move(result);
 
     return *this;
 }
@@ -4435,7 +4435,7 @@ Stream &Stream::operator>>(TLContactsLink &contactsLinkValue)
         break;
     }
 
-    contactsLinkValue = result;
+    contactsLinkValue = std::move(result);
 
     return *this;
 }
@@ -4456,7 +4456,7 @@ Stream &Stream::operator>>(TLContactsResolvedPeer &contactsResolvedPeerValue)
         break;
     }
 
-    contactsResolvedPeerValue = result;
+    contactsResolvedPeerValue = std::move(result);
 
     return *this;
 }
@@ -4479,7 +4479,7 @@ Stream &Stream::operator>>(TLContactsTopPeers &contactsTopPeersValue)
         break;
     }
 
-    contactsTopPeersValue = result;
+    contactsTopPeersValue = std::move(result);
 
     return *this;
 }
@@ -4511,7 +4511,7 @@ Stream &Stream::operator>>(TLDialog &dialogValue)
         break;
     }
 
-    dialogValue = result;
+    dialogValue = std::move(result);
 
     return *this;
 }
@@ -4541,7 +4541,7 @@ Stream &Stream::operator>>(TLDocument &documentValue)
         break;
     }
 
-    documentValue = result;
+    documentValue = std::move(result);
 
     return *this;
 }
@@ -4570,7 +4570,7 @@ Stream &Stream::operator>>(TLFoundGif &foundGifValue)
         break;
     }
 
-    foundGifValue = result;
+    foundGifValue = std::move(result);
 
     return *this;
 }
@@ -4598,7 +4598,7 @@ Stream &Stream::operator>>(TLGame &gameValue)
         break;
     }
 
-    gameValue = result;
+    gameValue = std::move(result);
 
     return *this;
 }
@@ -4618,7 +4618,7 @@ Stream &Stream::operator>>(TLHelpSupport &helpSupportValue)
         break;
     }
 
-    helpSupportValue = result;
+    helpSupportValue = std::move(result);
 
     return *this;
 }
@@ -4685,7 +4685,7 @@ Stream &Stream::operator>>(TLInputBotInlineMessage &inputBotInlineMessageValue)
         break;
     }
 
-    inputBotInlineMessageValue = result;
+    inputBotInlineMessageValue = std::move(result);
 
     return *this;
 }
@@ -4758,7 +4758,7 @@ Stream &Stream::operator>>(TLInputBotInlineResult &inputBotInlineResultValue)
         break;
     }
 
-    inputBotInlineResultValue = result;
+    inputBotInlineResultValue = std::move(result);
 
     return *this;
 }
@@ -4867,7 +4867,7 @@ Stream &Stream::operator>>(TLInputMedia &inputMediaValue)
         break;
     }
 
-    inputMediaValue = result;
+    inputMediaValue = std::move(result);
 
     return *this;
 }
@@ -4950,7 +4950,7 @@ Stream &Stream::operator>>(TLMessageAction &messageActionValue)
         break;
     }
 
-    messageActionValue = result;
+    messageActionValue = std::move(result);
 
     return *this;
 }
@@ -4972,7 +4972,7 @@ Stream &Stream::operator>>(TLMessagesAllStickers &messagesAllStickersValue)
         break;
     }
 
-    messagesAllStickersValue = result;
+    messagesAllStickersValue = std::move(result);
 
     return *this;
 }
@@ -4993,7 +4993,7 @@ Stream &Stream::operator>>(TLMessagesChatFull &messagesChatFullValue)
         break;
     }
 
-    messagesChatFullValue = result;
+    messagesChatFullValue = std::move(result);
 
     return *this;
 }
@@ -5016,7 +5016,7 @@ Stream &Stream::operator>>(TLMessagesChats &messagesChatsValue)
         break;
     }
 
-    messagesChatsValue = result;
+    messagesChatsValue = std::move(result);
 
     return *this;
 }
@@ -5039,7 +5039,7 @@ Stream &Stream::operator>>(TLMessagesFavedStickers &messagesFavedStickersValue)
         break;
     }
 
-    messagesFavedStickersValue = result;
+    messagesFavedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5059,7 +5059,7 @@ Stream &Stream::operator>>(TLMessagesFoundGifs &messagesFoundGifsValue)
         break;
     }
 
-    messagesFoundGifsValue = result;
+    messagesFoundGifsValue = std::move(result);
 
     return *this;
 }
@@ -5079,7 +5079,7 @@ Stream &Stream::operator>>(TLMessagesHighScores &messagesHighScoresValue)
         break;
     }
 
-    messagesHighScoresValue = result;
+    messagesHighScoresValue = std::move(result);
 
     return *this;
 }
@@ -5101,7 +5101,7 @@ Stream &Stream::operator>>(TLMessagesRecentStickers &messagesRecentStickersValue
         break;
     }
 
-    messagesRecentStickersValue = result;
+    messagesRecentStickersValue = std::move(result);
 
     return *this;
 }
@@ -5123,7 +5123,7 @@ Stream &Stream::operator>>(TLMessagesSavedGifs &messagesSavedGifsValue)
         break;
     }
 
-    messagesSavedGifsValue = result;
+    messagesSavedGifsValue = std::move(result);
 
     return *this;
 }
@@ -5144,7 +5144,7 @@ Stream &Stream::operator>>(TLMessagesStickerSet &messagesStickerSetValue)
         break;
     }
 
-    messagesStickerSetValue = result;
+    messagesStickerSetValue = std::move(result);
 
     return *this;
 }
@@ -5166,7 +5166,7 @@ Stream &Stream::operator>>(TLMessagesStickers &messagesStickersValue)
         break;
     }
 
-    messagesStickersValue = result;
+    messagesStickersValue = std::move(result);
 
     return *this;
 }
@@ -5251,7 +5251,7 @@ Stream &Stream::operator>>(TLPageBlock &pageBlockValue)
         *this >> *result.caption;
         break;
     case TLValue::PageBlockChannel:
-        *this >> result.channel;
+        *this >> *result.channel;
         break;
     case TLValue::PageBlockAudio:
         *this >> result.audioId;
@@ -5261,7 +5261,7 @@ Stream &Stream::operator>>(TLPageBlock &pageBlockValue)
         break;
     }
 
-    pageBlockValue = result;
+    pageBlockValue = std::move(result);
 
     return *this;
 }
@@ -5297,7 +5297,7 @@ Stream &Stream::operator>>(TLPaymentsPaymentForm &paymentsPaymentFormValue)
         break;
     }
 
-    paymentsPaymentFormValue = result;
+    paymentsPaymentFormValue = std::move(result);
 
     return *this;
 }
@@ -5330,7 +5330,7 @@ Stream &Stream::operator>>(TLPaymentsPaymentReceipt &paymentsPaymentReceiptValue
         break;
     }
 
-    paymentsPaymentReceiptValue = result;
+    paymentsPaymentReceiptValue = std::move(result);
 
     return *this;
 }
@@ -5402,7 +5402,7 @@ Stream &Stream::operator>>(TLPhoneCall &phoneCallValue)
         break;
     }
 
-    phoneCallValue = result;
+    phoneCallValue = std::move(result);
 
     return *this;
 }
@@ -5422,7 +5422,7 @@ Stream &Stream::operator>>(TLPhonePhoneCall &phonePhoneCallValue)
         break;
     }
 
-    phonePhoneCallValue = result;
+    phonePhoneCallValue = std::move(result);
 
     return *this;
 }
@@ -5442,7 +5442,7 @@ Stream &Stream::operator>>(TLPhotosPhoto &photosPhotoValue)
         break;
     }
 
-    photosPhotoValue = result;
+    photosPhotoValue = std::move(result);
 
     return *this;
 }
@@ -5467,7 +5467,7 @@ Stream &Stream::operator>>(TLPhotosPhotos &photosPhotosValue)
         break;
     }
 
-    photosPhotosValue = result;
+    photosPhotosValue = std::move(result);
 
     return *this;
 }
@@ -5491,7 +5491,7 @@ Stream &Stream::operator>>(TLStickerSetCovered &stickerSetCoveredValue)
         break;
     }
 
-    stickerSetCoveredValue = result;
+    stickerSetCoveredValue = std::move(result);
 
     return *this;
 }
@@ -5523,7 +5523,7 @@ Stream &Stream::operator>>(TLUserFull &userFullValue)
         break;
     }
 
-    userFullValue = result;
+    userFullValue = std::move(result);
 
     return *this;
 }
@@ -5590,7 +5590,7 @@ Stream &Stream::operator>>(TLBotInlineResult &botInlineResultValue)
         break;
     }
 
-    botInlineResultValue = result;
+    botInlineResultValue = std::move(result);
 
     return *this;
 }
@@ -5610,7 +5610,7 @@ Stream &Stream::operator>>(TLMessagesArchivedStickers &messagesArchivedStickersV
         break;
     }
 
-    messagesArchivedStickersValue = result;
+    messagesArchivedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5639,7 +5639,7 @@ Stream &Stream::operator>>(TLMessagesBotResults &messagesBotResultsValue)
         break;
     }
 
-    messagesBotResultsValue = result;
+    messagesBotResultsValue = std::move(result);
 
     return *this;
 }
@@ -5662,7 +5662,7 @@ Stream &Stream::operator>>(TLMessagesFeaturedStickers &messagesFeaturedStickersV
         break;
     }
 
-    messagesFeaturedStickersValue = result;
+    messagesFeaturedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5683,7 +5683,7 @@ Stream &Stream::operator>>(TLMessagesStickerSetInstallResult &messagesStickerSet
         break;
     }
 
-    messagesStickerSetInstallResultValue = result;
+    messagesStickerSetInstallResultValue = std::move(result);
 
     return *this;
 }
@@ -5705,7 +5705,7 @@ Stream &Stream::operator>>(TLPage &pageValue)
         break;
     }
 
-    pageValue = result;
+    pageValue = std::move(result);
 
     return *this;
 }
@@ -5730,17 +5730,17 @@ Stream &Stream::operator>>(TLRecentMeUrl &recentMeUrlValue)
         break;
     case TLValue::RecentMeUrlChatInvite:
         *this >> result.url;
-        *this >> result.chatInvite;
+        *this >> *result.chatInvite;
         break;
     case TLValue::RecentMeUrlStickerSet:
         *this >> result.url;
-        *this >> result.set;
+        *this >> *result.set;
         break;
     default:
         break;
     }
 
-    recentMeUrlValue = result;
+    recentMeUrlValue = std::move(result);
 
     return *this;
 }
@@ -5811,7 +5811,7 @@ Stream &Stream::operator>>(TLWebPage &webPageValue)
         break;
     }
 
-    webPageValue = result;
+    webPageValue = std::move(result);
 
     return *this;
 }
@@ -5832,7 +5832,7 @@ Stream &Stream::operator>>(TLHelpRecentMeUrls &helpRecentMeUrlsValue)
         break;
     }
 
-    helpRecentMeUrlsValue = result;
+    helpRecentMeUrlsValue = std::move(result);
 
     return *this;
 }
@@ -5881,7 +5881,7 @@ Stream &Stream::operator>>(TLMessageMedia &messageMediaValue)
         }
         break;
     case TLValue::MessageMediaWebPage:
-        *this >> result.webpage;
+        *this >> *result.webpage;
         break;
     case TLValue::MessageMediaVenue:
         *this >> result.geo;
@@ -5892,7 +5892,7 @@ Stream &Stream::operator>>(TLMessageMedia &messageMediaValue)
         *this >> result.venueType;
         break;
     case TLValue::MessageMediaGame:
-        *this >> result.game;
+        *this >> *result.game;
         break;
     case TLValue::MessageMediaInvoice:
         *this >> result.flags;
@@ -5916,7 +5916,7 @@ Stream &Stream::operator>>(TLMessageMedia &messageMediaValue)
         break;
     }
 
-    messageMediaValue = result;
+    messageMediaValue = std::move(result);
 
     return *this;
 }
@@ -5950,7 +5950,7 @@ Stream &Stream::operator>>(TLMessage &messageValue)
         *this >> result.date;
         *this >> result.message;
         if (result.flags & TLMessage::Media) {
-            *this >> result.media;
+            *this >> *result.media;
         }
         if (result.flags & TLMessage::ReplyMarkup) {
             *this >> result.replyMarkup;
@@ -5979,13 +5979,13 @@ Stream &Stream::operator>>(TLMessage &messageValue)
             *this >> result.replyToMsgId;
         }
         *this >> result.date;
-        *this >> result.action;
+        *this >> *result.action;
         break;
     default:
         break;
     }
 
-    messageValue = result;
+    messageValue = std::move(result);
 
     return *this;
 }
@@ -6014,7 +6014,7 @@ Stream &Stream::operator>>(TLMessagesDialogs &messagesDialogsValue)
         break;
     }
 
-    messagesDialogsValue = result;
+    messagesDialogsValue = std::move(result);
 
     return *this;
 }
@@ -6052,7 +6052,7 @@ Stream &Stream::operator>>(TLMessagesMessages &messagesMessagesValue)
         break;
     }
 
-    messagesMessagesValue = result;
+    messagesMessagesValue = std::move(result);
 
     return *this;
 }
@@ -6075,7 +6075,7 @@ Stream &Stream::operator>>(TLMessagesPeerDialogs &messagesPeerDialogsValue)
         break;
     }
 
-    messagesPeerDialogsValue = result;
+    messagesPeerDialogsValue = std::move(result);
 
     return *this;
 }
@@ -6091,7 +6091,7 @@ Stream &Stream::operator>>(TLUpdate &updateValue)
     case TLValue::UpdateNewChannelMessage:
     case TLValue::UpdateEditChannelMessage:
     case TLValue::UpdateEditMessage:
-        *this >> result.message;
+        *this >> *result.message;
         *this >> result.pts;
         *this >> result.ptsCount;
         break;
@@ -6188,7 +6188,7 @@ Stream &Stream::operator>>(TLUpdate &updateValue)
         }
         *this >> result.type;
         *this >> result.stringMessage;
-        *this >> result.media;
+        *this >> *result.media;
         *this >> result.entities;
         break;
     case TLValue::UpdatePrivacy:
@@ -6207,7 +6207,7 @@ Stream &Stream::operator>>(TLUpdate &updateValue)
         *this >> result.ptsCount;
         break;
     case TLValue::UpdateWebPage:
-        *this >> result.webpage;
+        *this >> *result.webpage;
         *this >> result.pts;
         *this >> result.ptsCount;
         break;
@@ -6324,7 +6324,7 @@ Stream &Stream::operator>>(TLUpdate &updateValue)
         break;
     case TLValue::UpdateChannelWebPage:
         *this >> result.channelId;
-        *this >> result.webpage;
+        *this >> *result.webpage;
         *this >> result.pts;
         *this >> result.ptsCount;
         break;
@@ -6367,7 +6367,7 @@ Stream &Stream::operator>>(TLUpdate &updateValue)
         *this >> result.totalAmount;
         break;
     case TLValue::UpdatePhoneCall:
-        *this >> result.phoneCall;
+        *this >> *result.phoneCall;
         break;
     case TLValue::UpdateLangPack:
         *this >> result.difference;
@@ -6384,7 +6384,7 @@ Stream &Stream::operator>>(TLUpdate &updateValue)
         break;
     }
 
-    updateValue = result;
+    updateValue = std::move(result);
 
     return *this;
 }
@@ -6442,7 +6442,7 @@ Stream &Stream::operator>>(TLUpdates &updatesValue)
         }
         break;
     case TLValue::UpdateShort:
-        *this >> result.update;
+        *this >> *result.update;
         *this >> result.date;
         break;
     case TLValue::UpdatesCombined:
@@ -6467,7 +6467,7 @@ Stream &Stream::operator>>(TLUpdates &updatesValue)
         *this >> result.ptsCount;
         *this >> result.date;
         if (result.flags & TLUpdates::Media) {
-            *this >> result.media;
+            *this >> *result.media;
         }
         if (result.flags & TLUpdates::Entities) {
             *this >> result.entities;
@@ -6477,7 +6477,7 @@ Stream &Stream::operator>>(TLUpdates &updatesValue)
         break;
     }
 
-    updatesValue = result;
+    updatesValue = std::move(result);
 
     return *this;
 }
@@ -6526,7 +6526,7 @@ Stream &Stream::operator>>(TLUpdatesChannelDifference &updatesChannelDifferenceV
         break;
     }
 
-    updatesChannelDifferenceValue = result;
+    updatesChannelDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -6565,7 +6565,7 @@ Stream &Stream::operator>>(TLUpdatesDifference &updatesDifferenceValue)
         break;
     }
 
-    updatesDifferenceValue = result;
+    updatesDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -6594,11 +6594,11 @@ Stream &Stream::operator>>(TLChannelAdminLogEventAction &channelAdminLogEventAct
         break;
     case TLValue::ChannelAdminLogEventActionUpdatePinned:
     case TLValue::ChannelAdminLogEventActionDeleteMessage:
-        *this >> result.message;
+        *this >> *result.message;
         break;
     case TLValue::ChannelAdminLogEventActionEditMessage:
-        *this >> result.prevMessage;
-        *this >> result.newMessage;
+        *this >> *result.prevMessage;
+        *this >> *result.newMessage;
         break;
     case TLValue::ChannelAdminLogEventActionParticipantJoin:
     case TLValue::ChannelAdminLogEventActionParticipantLeave:
@@ -6619,7 +6619,7 @@ Stream &Stream::operator>>(TLChannelAdminLogEventAction &channelAdminLogEventAct
         break;
     }
 
-    channelAdminLogEventActionValue = result;
+    channelAdminLogEventActionValue = std::move(result);
 
     return *this;
 }
@@ -6632,7 +6632,7 @@ Stream &Stream::operator>>(TLPaymentsPaymentResult &paymentsPaymentResultValue)
 
     switch (result.tlType) {
     case TLValue::PaymentsPaymentResult:
-        *this >> result.updates;
+        *this >> *result.updates;
         break;
     case TLValue::PaymentsPaymentVerficationNeeded:
         *this >> result.url;
@@ -6641,7 +6641,7 @@ Stream &Stream::operator>>(TLPaymentsPaymentResult &paymentsPaymentResultValue)
         break;
     }
 
-    paymentsPaymentResultValue = result;
+    paymentsPaymentResultValue = std::move(result);
 
     return *this;
 }
@@ -6663,7 +6663,7 @@ Stream &Stream::operator>>(TLChannelAdminLogEvent &channelAdminLogEventValue)
         break;
     }
 
-    channelAdminLogEventValue = result;
+    channelAdminLogEventValue = std::move(result);
 
     return *this;
 }
@@ -6684,7 +6684,7 @@ Stream &Stream::operator>>(TLChannelsAdminLogResults &channelsAdminLogResultsVal
         break;
     }
 
-    channelsAdminLogResultsValue = result;
+    channelsAdminLogResultsValue = std::move(result);
 
     return *this;
 }
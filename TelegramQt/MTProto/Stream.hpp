@@ -29,6 +29,9 @@ namespace Telegram {
 
 namespace MTProto {
 
+class DecodeArena;
+template <typename T> class LazyVector;
+
 class TELEGRAMQT_INTERNAL_EXPORT Stream : public RawStreamEx
 {
 public:
@@ -65,6 +68,12 @@ public:
     template <int Size>
     Stream &operator>>(TLNumber<Size> &n);
 
+    // Advance past an encoded value without the decoding
+    template <typename T>
+    Stream &skip();
+    template <typename T>
+    Stream &skipVector();
+
     // Generated read operators
     Stream &operator>>(TLAccountDaysTTL &accountDaysTTLValue);
     Stream &operator>>(TLAccountPassword &accountPasswordValue);
@@ -352,13 +361,273 @@ public:
     Stream &operator<<(const TLInputBotInlineResult &inputBotInlineResultValue);
     Stream &operator<<(const TLInputMedia &inputMediaValue);
     // End of generated write operators
+
+    // The arena (if set) owns the items of the decoded TLVector<T*> values
+    DecodeArena *arena() const { return m_arena; }
+    void setArena(DecodeArena *arena) { m_arena = arena; }
+
+protected:
+    template <typename T> friend class LazyVector;
+
+    // Each encoded item takes at least 4 bytes, so the remaining input limits
+    // the number of items that a valid vector can have
+    bool isAcceptableVectorLength(quint32 length) const
+    {
+        return !error() && (length <= static_cast<quint32>(bytesAvailable()) / 4);
+    }
+
+    // An item can be much larger in memory than its 4 bytes in the input, so the
+    // declared length reserves only a few items; the vector grows as they decode
+    static int getVectorReserve(quint32 length)
+    {
+        constexpr quint32 c_maxReservedItems = 64;
+        return static_cast<int>(qMin(length, c_maxReservedItems));
+    }
+
+    DecodeArena *m_arena = nullptr;
 };
 
+template <> inline Stream &Stream::skip<quint32>() { skipBytes(sizeof(quint32)); return *this; }
+template <> inline Stream &Stream::skip<quint64>() { skipBytes(sizeof(quint64)); return *this; }
+template <> inline Stream &Stream::skip<double>() { skipBytes(sizeof(double)); return *this; }
+template <> inline Stream &Stream::skip<bool>() { skipBytes(sizeof(quint32)); return *this; } // TLBool
+template <> inline Stream &Stream::skip<TLNumber128>() { skipBytes(128 / 8); return *this; }
+template <> inline Stream &Stream::skip<TLNumber256>() { skipBytes(256 / 8); return *this; }
+template <> inline Stream &Stream::skip<QByteArray>() { skipByteArray(); return *this; }
+template <> inline Stream &Stream::skip<QString>() { skipByteArray(); return *this; }
+
+// Generated skip specializations
+template <> Stream &Stream::skip<TLAccountDaysTTL>();
+template <> Stream &Stream::skip<TLAccountPassword>();
+template <> Stream &Stream::skip<TLAccountPasswordInputSettings>();
+template <> Stream &Stream::skip<TLAccountPasswordSettings>();
+template <> Stream &Stream::skip<TLAccountTmpPassword>();
+template <> Stream &Stream::skip<TLAuthCheckedPhone>();
+template <> Stream &Stream::skip<TLAuthCodeType>();
+template <> Stream &Stream::skip<TLAuthExportedAuthorization>();
+template <> Stream &Stream::skip<TLAuthPasswordRecovery>();
+template <> Stream &Stream::skip<TLAuthSentCodeType>();
+template <> Stream &Stream::skip<TLAuthorization>();
+template <> Stream &Stream::skip<TLBadMsgNotification>();
+template <> Stream &Stream::skip<TLBotCommand>();
+template <> Stream &Stream::skip<TLBotInfo>();
+template <> Stream &Stream::skip<TLCdnFileHash>();
+template <> Stream &Stream::skip<TLCdnPublicKey>();
+template <> Stream &Stream::skip<TLChannelParticipantsFilter>();
+template <> Stream &Stream::skip<TLChatParticipant>();
+template <> Stream &Stream::skip<TLChatParticipants>();
+template <> Stream &Stream::skip<TLClientDHInnerData>();
+template <> Stream &Stream::skip<TLContact>();
+template <> Stream &Stream::skip<TLContactBlocked>();
+template <> Stream &Stream::skip<TLContactLink>();
+template <> Stream &Stream::skip<TLDataJSON>();
+template <> Stream &Stream::skip<TLDestroyAuthKeyRes>();
+template <> Stream &Stream::skip<TLDestroySessionRes>();
+template <> Stream &Stream::skip<TLDisabledFeature>();
+template <> Stream &Stream::skip<TLEncryptedChat>();
+template <> Stream &Stream::skip<TLEncryptedFile>();
+template <> Stream &Stream::skip<TLEncryptedMessage>();
+template <> Stream &Stream::skip<TLError>();
+template <> Stream &Stream::skip<TLExportedChatInvite>();
+template <> Stream &Stream::skip<TLExportedMessageLink>();
+template <> Stream &Stream::skip<TLFileLocation>();
+template <> Stream &Stream::skip<TLFutureSalt>();
+template <> Stream &Stream::skip<TLFutureSalts>();
+template <> Stream &Stream::skip<TLGeoPoint>();
+template <> Stream &Stream::skip<TLHelpAppUpdate>();
+template <> Stream &Stream::skip<TLHelpInviteText>();
+template <> Stream &Stream::skip<TLHelpTermsOfService>();
+template <> Stream &Stream::skip<TLHighScore>();
+template <> Stream &Stream::skip<TLHttpWait>();
+template <> Stream &Stream::skip<TLImportedContact>();
+template <> Stream &Stream::skip<TLInlineBotSwitchPM>();
+template <> Stream &Stream::skip<TLInputAppEvent>();
+template <> Stream &Stream::skip<TLInputBotInlineMessageID>();
+template <> Stream &Stream::skip<TLInputChannel>();
+template <> Stream &Stream::skip<TLInputContact>();
+template <> Stream &Stream::skip<TLInputDocument>();
+template <> Stream &Stream::skip<TLInputEncryptedChat>();
+template <> Stream &Stream::skip<TLInputEncryptedFile>();
+template <> Stream &Stream::skip<TLInputFile>();
+template <> Stream &Stream::skip<TLInputFileLocation>();
+template <> Stream &Stream::skip<TLInputGeoPoint>();
+template <> Stream &Stream::skip<TLInputPeer>();
+template <> Stream &Stream::skip<TLInputPeerNotifyEvents>();
+template <> Stream &Stream::skip<TLInputPhoneCall>();
+template <> Stream &Stream::skip<TLInputPhoto>();
+template <> Stream &Stream::skip<TLInputPrivacyKey>();
+template <> Stream &Stream::skip<TLInputStickerSet>();
+template <> Stream &Stream::skip<TLInputStickeredMedia>();
+template <> Stream &Stream::skip<TLInputUser>();
+template <> Stream &Stream::skip<TLInputWebFileLocation>();
+template <> Stream &Stream::skip<TLIpPort>();
+template <> Stream &Stream::skip<TLLabeledPrice>();
+template <> Stream &Stream::skip<TLLangPackLanguage>();
+template <> Stream &Stream::skip<TLLangPackString>();
+template <> Stream &Stream::skip<TLMaskCoords>();
+template <> Stream &Stream::skip<TLMessageEntity>();
+template <> Stream &Stream::skip<TLMessageFwdHeader>();
+template <> Stream &Stream::skip<TLMessageRange>();
+template <> Stream &Stream::skip<TLMessagesAffectedHistory>();
+template <> Stream &Stream::skip<TLMessagesAffectedMessages>();
+template <> Stream &Stream::skip<TLMessagesDhConfig>();
+template <> Stream &Stream::skip<TLMessagesSentEncryptedMessage>();
+template <> Stream &Stream::skip<TLMsgDetailedInfo>();
+template <> Stream &Stream::skip<TLMsgResendReq>();
+template <> Stream &Stream::skip<TLMsgsAck>();
+template <> Stream &Stream::skip<TLMsgsAllInfo>();
+template <> Stream &Stream::skip<TLMsgsStateInfo>();
+template <> Stream &Stream::skip<TLMsgsStateReq>();
+template <> Stream &Stream::skip<TLNearestDc>();
+template <> Stream &Stream::skip<TLNewSession>();
+template <> Stream &Stream::skip<TLPQInnerData>();
+template <> Stream &Stream::skip<TLPaymentCharge>();
+template <> Stream &Stream::skip<TLPaymentSavedCredentials>();
+template <> Stream &Stream::skip<TLPeer>();
+template <> Stream &Stream::skip<TLPeerNotifyEvents>();
+template <> Stream &Stream::skip<TLPhoneCallDiscardReason>();
+template <> Stream &Stream::skip<TLPhoneConnection>();
+template <> Stream &Stream::skip<TLPhotoSize>();
+template <> Stream &Stream::skip<TLPong>();
+template <> Stream &Stream::skip<TLPopularContact>();
+template <> Stream &Stream::skip<TLPostAddress>();
+template <> Stream &Stream::skip<TLPrivacyKey>();
+template <> Stream &Stream::skip<TLPrivacyRule>();
+template <> Stream &Stream::skip<TLReceivedNotifyMessage>();
+template <> Stream &Stream::skip<TLReportReason>();
+template <> Stream &Stream::skip<TLResPQ>();
+template <> Stream &Stream::skip<TLRichText>();
+template <> Stream &Stream::skip<TLRpcDropAnswer>();
+template <> Stream &Stream::skip<TLRpcError>();
+template <> Stream &Stream::skip<TLSendMessageAction>();
+template <> Stream &Stream::skip<TLServerDHInnerData>();
+template <> Stream &Stream::skip<TLServerDHParams>();
+template <> Stream &Stream::skip<TLSetClientDHParamsAnswer>();
+template <> Stream &Stream::skip<TLShippingOption>();
+template <> Stream &Stream::skip<TLStickerPack>();
+template <> Stream &Stream::skip<TLStorageFileType>();
+template <> Stream &Stream::skip<TLTopPeer>();
+template <> Stream &Stream::skip<TLTopPeerCategory>();
+template <> Stream &Stream::skip<TLTopPeerCategoryPeers>();
+template <> Stream &Stream::skip<TLUpdatesState>();
+template <> Stream &Stream::skip<TLUploadCdnFile>();
+template <> Stream &Stream::skip<TLUploadFile>();
+template <> Stream &Stream::skip<TLUploadWebFile>();
+template <> Stream &Stream::skip<TLUserProfilePhoto>();
+template <> Stream &Stream::skip<TLUserStatus>();
+template <> Stream &Stream::skip<TLWallPaper>();
+template <> Stream &Stream::skip<TLAccountAuthorizations>();
+template <> Stream &Stream::skip<TLAuthSentCode>();
+template <> Stream &Stream::skip<TLCdnConfig>();
+template <> Stream &Stream::skip<TLChannelAdminLogEventsFilter>();
+template <> Stream &Stream::skip<TLChannelAdminRights>();
+template <> Stream &Stream::skip<TLChannelBannedRights>();
+template <> Stream &Stream::skip<TLChannelMessagesFilter>();
+template <> Stream &Stream::skip<TLChannelParticipant>();
+template <> Stream &Stream::skip<TLChatPhoto>();
+template <> Stream &Stream::skip<TLContactStatus>();
+template <> Stream &Stream::skip<TLDcOption>();
+template <> Stream &Stream::skip<TLDocumentAttribute>();
+template <> Stream &Stream::skip<TLDraftMessage>();
+template <> Stream &Stream::skip<TLHelpConfigSimple>();
+template <> Stream &Stream::skip<TLInputChatPhoto>();
+template <> Stream &Stream::skip<TLInputGame>();
+template <> Stream &Stream::skip<TLInputNotifyPeer>();
+template <> Stream &Stream::skip<TLInputPaymentCredentials>();
+template <> Stream &Stream::skip<TLInputPeerNotifySettings>();
+template <> Stream &Stream::skip<TLInputPrivacyRule>();
+template <> Stream &Stream::skip<TLInputStickerSetItem>();
+template <> Stream &Stream::skip<TLInputWebDocument>();
+template <> Stream &Stream::skip<TLInvoice>();
+template <> Stream &Stream::skip<TLKeyboardButton>();
+template <> Stream &Stream::skip<TLKeyboardButtonRow>();
+template <> Stream &Stream::skip<TLLangPackDifference>();
+template <> Stream &Stream::skip<TLMessagesBotCallbackAnswer>();
+template <> Stream &Stream::skip<TLMessagesFilter>();
+template <> Stream &Stream::skip<TLMessagesMessageEditData>();
+template <> Stream &Stream::skip<TLNotifyPeer>();
+template <> Stream &Stream::skip<TLPaymentRequestedInfo>();
+template <> Stream &Stream::skip<TLPaymentsSavedInfo>();
+template <> Stream &Stream::skip<TLPaymentsValidatedRequestedInfo>();
+template <> Stream &Stream::skip<TLPeerNotifySettings>();
+template <> Stream &Stream::skip<TLPeerSettings>();
+template <> Stream &Stream::skip<TLPhoneCallProtocol>();
+template <> Stream &Stream::skip<TLPhoto>();
+template <> Stream &Stream::skip<TLReplyMarkup>();
+template <> Stream &Stream::skip<TLStickerSet>();
+template <> Stream &Stream::skip<TLUser>();
+template <> Stream &Stream::skip<TLWebDocument>();
+template <> Stream &Stream::skip<TLAccountPrivacyRules>();
+template <> Stream &Stream::skip<TLAuthAuthorization>();
+template <> Stream &Stream::skip<TLBotInlineMessage>();
+template <> Stream &Stream::skip<TLChannelsChannelParticipant>();
+template <> Stream &Stream::skip<TLChannelsChannelParticipants>();
+template <> Stream &Stream::skip<TLChat>();
+template <> Stream &Stream::skip<TLChatFull>();
+template <> Stream &Stream::skip<TLChatInvite>();
+template <> Stream &Stream::skip<TLConfig>();
+template <> Stream &Stream::skip<TLContactsBlocked>();
+template <> Stream &Stream::skip<TLContactsContacts>();
+template <> Stream &Stream::skip<TLContactsFound>();
+template <> Stream &Stream::skip<TLContactsImportedContacts>();
+template <> Stream &Stream::skip<TLContactsLink>();
+template <> Stream &Stream::skip<TLContactsResolvedPeer>();
+template <> Stream &Stream::skip<TLContactsTopPeers>();
+template <> Stream &Stream::skip<TLDialog>();
+template <> Stream &Stream::skip<TLDocument>();
+template <> Stream &Stream::skip<TLFoundGif>();
+template <> Stream &Stream::skip<TLGame>();
+template <> Stream &Stream::skip<TLHelpSupport>();
+template <> Stream &Stream::skip<TLInputBotInlineMessage>();
+template <> Stream &Stream::skip<TLInputBotInlineResult>();
+template <> Stream &Stream::skip<TLInputMedia>();
+template <> Stream &Stream::skip<TLMessageAction>();
+template <> Stream &Stream::skip<TLMessagesAllStickers>();
+template <> Stream &Stream::skip<TLMessagesChatFull>();
+template <> Stream &Stream::skip<TLMessagesChats>();
+template <> Stream &Stream::skip<TLMessagesFavedStickers>();
+template <> Stream &Stream::skip<TLMessagesFoundGifs>();
+template <> Stream &Stream::skip<TLMessagesHighScores>();
+template <> Stream &Stream::skip<TLMessagesRecentStickers>();
+template <> Stream &Stream::skip<TLMessagesSavedGifs>();
+template <> Stream &Stream::skip<TLMessagesStickerSet>();
+template <> Stream &Stream::skip<TLMessagesStickers>();
+template <> Stream &Stream::skip<TLPageBlock>();
+template <> Stream &Stream::skip<TLPaymentsPaymentForm>();
+template <> Stream &Stream::skip<TLPaymentsPaymentReceipt>();
+template <> Stream &Stream::skip<TLPhoneCall>();
+template <> Stream &Stream::skip<TLPhonePhoneCall>();
+template <> Stream &Stream::skip<TLPhotosPhoto>();
+template <> Stream &Stream::skip<TLPhotosPhotos>();
+template <> Stream &Stream::skip<TLStickerSetCovered>();
+template <> Stream &Stream::skip<TLUserFull>();
+template <> Stream &Stream::skip<TLBotInlineResult>();
+template <> Stream &Stream::skip<TLMessagesArchivedStickers>();
+template <> Stream &Stream::skip<TLMessagesBotResults>();
+template <> Stream &Stream::skip<TLMessagesFeaturedStickers>();
+template <> Stream &Stream::skip<TLMessagesStickerSetInstallResult>();
+template <> Stream &Stream::skip<TLPage>();
+template <> Stream &Stream::skip<TLRecentMeUrl>();
+template <> Stream &Stream::skip<TLWebPage>();
+template <> Stream &Stream::skip<TLHelpRecentMeUrls>();
+template <> Stream &Stream::skip<TLMessageMedia>();
+template <> Stream &Stream::skip<TLMessage>();
+template <> Stream &Stream::skip<TLMessagesDialogs>();
+template <> Stream &Stream::skip<TLMessagesMessages>();
+template <> Stream &Stream::skip<TLMessagesPeerDialogs>();
+template <> Stream &Stream::skip<TLUpdate>();
+template <> Stream &Stream::skip<TLUpdates>();
+template <> Stream &Stream::skip<TLUpdatesChannelDifference>();
+template <> Stream &Stream::skip<TLUpdatesDifference>();
+template <> Stream &Stream::skip<TLChannelAdminLogEventAction>();
+template <> Stream &Stream::skip<TLPaymentsPaymentResult>();
+template <> Stream &Stream::skip<TLChannelAdminLogEvent>();
+template <> Stream &Stream::skip<TLChannelsAdminLogResults>();
+// End of generated skip specializations
+
 inline Stream &Stream::operator>>(QString &str)
 {
-    QByteArray data;
-    *this >> data;
-    str = QString::fromUtf8(data);
+    readString(str);
     return *this;
 }
 
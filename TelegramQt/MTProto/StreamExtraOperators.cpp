@@ -2246,7 +2246,7 @@ Stream &operator<<(Stream &stream, const TLChatInvite &chatInviteValue)
     stream << chatInviteValue.tlType;
     switch (chatInviteValue.tlType) {
     case TLValue::ChatInviteAlready:
-        stream << chatInviteValue.chat;
+        stream << *chatInviteValue.chat;
         break;
     case TLValue::ChatInvite:
         stream << chatInviteValue.flags;
@@ -2873,7 +2873,7 @@ Stream &operator<<(Stream &stream, const TLPageBlock &pageBlockValue)
         stream << *pageBlockValue.caption;
         break;
     case TLValue::PageBlockChannel:
-        stream << pageBlockValue.channel;
+        stream << *pageBlockValue.channel;
         break;
     case TLValue::PageBlockAudio:
         stream << pageBlockValue.audioId;
@@ -3277,11 +3277,11 @@ Stream &operator<<(Stream &stream, const TLRecentMeUrl &recentMeUrlValue)
         break;
     case TLValue::RecentMeUrlChatInvite:
         stream << recentMeUrlValue.url;
-        stream << recentMeUrlValue.chatInvite;
+        stream << *recentMeUrlValue.chatInvite;
         break;
     case TLValue::RecentMeUrlStickerSet:
         stream << recentMeUrlValue.url;
-        stream << recentMeUrlValue.set;
+        stream << *recentMeUrlValue.set;
         break;
     default:
         break;
@@ -3413,7 +3413,7 @@ Stream &operator<<(Stream &stream, const TLMessageMedia &messageMediaValue)
         }
         break;
     case TLValue::MessageMediaWebPage:
-        stream << messageMediaValue.webpage;
+        stream << *messageMediaValue.webpage;
         break;
     case TLValue::MessageMediaVenue:
         stream << messageMediaValue.geo;
@@ -3424,7 +3424,7 @@ Stream &operator<<(Stream &stream, const TLMessageMedia &messageMediaValue)
         stream << messageMediaValue.venueType;
         break;
     case TLValue::MessageMediaGame:
-        stream << messageMediaValue.game;
+        stream << *messageMediaValue.game;
         break;
     case TLValue::MessageMediaInvoice:
         stream << messageMediaValue.flags;
@@ -3477,7 +3477,7 @@ Stream &operator<<(Stream &stream, const TLMessage &messageValue)
         stream << messageValue.date;
         stream << messageValue.message;
         if (messageValue.flags & TLMessage::Media) {
-            stream << messageValue.media;
+            stream << *messageValue.media;
         }
         if (messageValue.flags & TLMessage::ReplyMarkup) {
             stream << messageValue.replyMarkup;
@@ -3506,7 +3506,7 @@ Stream &operator<<(Stream &stream, const TLMessage &messageValue)
             stream << messageValue.replyToMsgId;
         }
         stream << messageValue.date;
-        stream << messageValue.action;
+        stream << *messageValue.action;
         break;
     default:
         break;
@@ -3598,7 +3598,7 @@ Stream &operator<<(Stream &stream, const TLUpdate &updateValue)
     case TLValue::UpdateNewChannelMessage:
     case TLValue::UpdateEditChannelMessage:
     case TLValue::UpdateEditMessage:
-        stream << updateValue.message;
+        stream << *updateValue.message;
         stream << updateValue.pts;
         stream << updateValue.ptsCount;
         break;
@@ -3695,7 +3695,7 @@ Stream &operator<<(Stream &stream, const TLUpdate &updateValue)
         }
         stream << updateValue.type;
         stream << updateValue.stringMessage;
-        stream << updateValue.media;
+        stream << *updateValue.media;
         stream << updateValue.entities;
         break;
     case TLValue::UpdatePrivacy:
@@ -3714,7 +3714,7 @@ Stream &operator<<(Stream &stream, const TLUpdate &updateValue)
         stream << updateValue.ptsCount;
         break;
     case TLValue::UpdateWebPage:
-        stream << updateValue.webpage;
+        stream << *updateValue.webpage;
         stream << updateValue.pts;
         stream << updateValue.ptsCount;
         break;
@@ -3831,7 +3831,7 @@ Stream &operator<<(Stream &stream, const TLUpdate &updateValue)
         break;
     case TLValue::UpdateChannelWebPage:
         stream << updateValue.channelId;
-        stream << updateValue.webpage;
+        stream << *updateValue.webpage;
         stream << updateValue.pts;
         stream << updateValue.ptsCount;
         break;
@@ -3874,7 +3874,7 @@ Stream &operator<<(Stream &stream, const TLUpdate &updateValue)
         stream << updateValue.totalAmount;
         break;
     case TLValue::UpdatePhoneCall:
-        stream << updateValue.phoneCall;
+        stream << *updateValue.phoneCall;
         break;
     case TLValue::UpdateLangPack:
         stream << updateValue.difference;
@@ -3944,7 +3944,7 @@ Stream &operator<<(Stream &stream, const TLUpdates &updatesValue)
         }
         break;
     case TLValue::UpdateShort:
-        stream << updatesValue.update;
+        stream << *updatesValue.update;
         stream << updatesValue.date;
         break;
     case TLValue::UpdatesCombined:
@@ -3969,7 +3969,7 @@ Stream &operator<<(Stream &stream, const TLUpdates &updatesValue)
         stream << updatesValue.ptsCount;
         stream << updatesValue.date;
         if (updatesValue.flags & TLUpdates::Media) {
-            stream << updatesValue.media;
+            stream << *updatesValue.media;
         }
         if (updatesValue.flags & TLUpdates::Entities) {
             stream << updatesValue.entities;
@@ -4081,11 +4081,11 @@ Stream &operator<<(Stream &stream, const TLChannelAdminLogEventAction &channelAd
         break;
     case TLValue::ChannelAdminLogEventActionUpdatePinned:
     case TLValue::ChannelAdminLogEventActionDeleteMessage:
-        stream << channelAdminLogEventActionValue.message;
+        stream << *channelAdminLogEventActionValue.message;
         break;
     case TLValue::ChannelAdminLogEventActionEditMessage:
-        stream << channelAdminLogEventActionValue.prevMessage;
-        stream << channelAdminLogEventActionValue.newMessage;
+        stream << *channelAdminLogEventActionValue.prevMessage;
+        stream << *channelAdminLogEventActionValue.newMessage;
         break;
     case TLValue::ChannelAdminLogEventActionParticipantJoin:
     case TLValue::ChannelAdminLogEventActionParticipantLeave:
@@ -4114,7 +4114,7 @@ Stream &operator<<(Stream &stream, const TLPaymentsPaymentResult &paymentsPaymen
     stream << paymentsPaymentResultValue.tlType;
     switch (paymentsPaymentResultValue.tlType) {
     case TLValue::PaymentsPaymentResult:
-        stream << paymentsPaymentResultValue.updates;
+        stream << *paymentsPaymentResultValue.updates;
         break;
     case TLValue::PaymentsPaymentVerficationNeeded:
         stream << paymentsPaymentResultValue.url;
@@ -0,0 +1,6317 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+#include "Stream_p.hpp"
+
+namespace Telegram {
+
+namespace MTProto {
+
+// Generated skip specializations implementation
+template <>
+Stream &Stream::skip<TLAccountDaysTTL>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountDaysTTL:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAccountPassword>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountNoPassword:
+        skip<QByteArray>();
+        skip<QString>();
+        break;
+    case TLValue::AccountPassword:
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skip<QString>();
+        skip<bool>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAccountPasswordInputSettings>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        *this >> flags;
+        if (flags & TLAccountPasswordInputSettings::NewSalt) {
+            skip<QByteArray>();
+        }
+        if (flags & TLAccountPasswordInputSettings::NewPasswordHash) {
+            skip<QByteArray>();
+        }
+        if (flags & TLAccountPasswordInputSettings::Hint) {
+            skip<QString>();
+        }
+        if (flags & TLAccountPasswordInputSettings::Email) {
+            skip<QString>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAccountPasswordSettings>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPasswordSettings:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAccountTmpPassword>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountTmpPassword:
+        skip<QByteArray>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthCheckedPhone>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthCheckedPhone:
+        skip<bool>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthCodeType>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthCodeTypeSms:
+    case TLValue::AuthCodeTypeCall:
+    case TLValue::AuthCodeTypeFlashCall:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthExportedAuthorization>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthExportedAuthorization:
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthPasswordRecovery>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthPasswordRecovery:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthSentCodeType>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthSentCodeTypeApp:
+    case TLValue::AuthSentCodeTypeSms:
+    case TLValue::AuthSentCodeTypeCall:
+        skip<quint32>();
+        break;
+    case TLValue::AuthSentCodeTypeFlashCall:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthorization>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Authorization:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLBadMsgNotification>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BadMsgNotification:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::BadServerSalt:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLBotCommand>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotCommand:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLBotInfo>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotInfo:
+        skip<quint32>();
+        skip<QString>();
+        skipVector<TLBotCommand>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLCdnFileHash>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::CdnFileHash:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLCdnPublicKey>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::CdnPublicKey:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelParticipantsFilter>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelParticipantsRecent:
+    case TLValue::ChannelParticipantsAdmins:
+    case TLValue::ChannelParticipantsBots:
+        break;
+    case TLValue::ChannelParticipantsKicked:
+    case TLValue::ChannelParticipantsBanned:
+    case TLValue::ChannelParticipantsSearch:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChatParticipant>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatParticipant:
+    case TLValue::ChatParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChatParticipantCreator:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChatParticipants>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLChatParticipants::SelfParticipant) {
+            skip<TLChatParticipant>();
+        }
+        break;
+    case TLValue::ChatParticipants:
+        skip<quint32>();
+        skipVector<TLChatParticipant>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLClientDHInnerData>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ClientDHInnerData:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContact>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Contact:
+        skip<quint32>();
+        skip<bool>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactBlocked>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactBlocked:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactLink>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactLinkUnknown:
+    case TLValue::ContactLinkNone:
+    case TLValue::ContactLinkHasPhone:
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDataJSON>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DataJSON:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDestroyAuthKeyRes>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DestroyAuthKeyOk:
+    case TLValue::DestroyAuthKeyNone:
+    case TLValue::DestroyAuthKeyFail:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDestroySessionRes>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DestroySessionOk:
+    case TLValue::DestroySessionNone:
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDisabledFeature>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DisabledFeature:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLEncryptedChat>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedChatEmpty:
+    case TLValue::EncryptedChatDiscarded:
+        skip<quint32>();
+        break;
+    case TLValue::EncryptedChatWaiting:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::EncryptedChatRequested:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    case TLValue::EncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLEncryptedFile>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLEncryptedMessage>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedMessage:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLEncryptedFile>();
+        break;
+    case TLValue::EncryptedMessageService:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLError>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Error:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLExportedChatInvite>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLExportedMessageLink>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ExportedMessageLink:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLFileLocation>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FileLocationUnavailable:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::FileLocation:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLFutureSalt>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FutureSalt:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLFutureSalts>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FutureSalts:
+        skip<quint64>();
+        skip<quint32>();
+        skipVector<TLFutureSalt>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLGeoPoint>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHelpAppUpdate>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpAppUpdate:
+        skip<quint32>();
+        skip<bool>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHelpInviteText>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpInviteText:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHelpTermsOfService>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpTermsOfService:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHighScore>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HighScore:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHttpWait>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HttpWait:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLImportedContact>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ImportedContact:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInlineBotSwitchPM>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InlineBotSwitchPM:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputAppEvent>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputAppEvent:
+        skip<double>();
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputBotInlineMessageID>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputBotInlineMessageID:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputChannel>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputChannelEmpty:
+        break;
+    case TLValue::InputChannel:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputContact>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhoneContact:
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputDocument>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputEncryptedChat>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputEncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputEncryptedFile>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::InputEncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputFile>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputFile:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputFileBig:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputFileLocation>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputFileLocation:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::InputEncryptedFileLocation:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputDocumentFileLocation:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputGeoPoint>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPeer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerChat:
+        skip<quint32>();
+        break;
+    case TLValue::InputPeerUser:
+    case TLValue::InputPeerChannel:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPeerNotifyEvents>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPhoneCall>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhoneCall:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPhoto>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPrivacyKey>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+    case TLValue::InputPrivacyKeyChatInvite:
+    case TLValue::InputPrivacyKeyPhoneCall:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputStickerSet>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputStickerSetShortName:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputStickeredMedia>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputStickeredMediaPhoto:
+        skip<TLInputPhoto>();
+        break;
+    case TLValue::InputStickeredMediaDocument:
+        skip<TLInputDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputUser>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputUserEmpty:
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUser:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputWebFileLocation>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputWebFileLocation:
+        skip<QString>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLIpPort>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::IpPort:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLLabeledPrice>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LabeledPrice:
+        skip<QString>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLLangPackLanguage>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LangPackLanguage:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLLangPackString>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LangPackString:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::LangPackStringPluralized:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLLangPackString::ZeroValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::OneValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::TwoValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::FewValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::ManyValue) {
+            skip<QString>();
+        }
+        skip<QString>();
+        break;
+    case TLValue::LangPackStringDeleted:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMaskCoords>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MaskCoords:
+        skip<quint32>();
+        skip<double>();
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessageEntity>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageEntityUnknown:
+    case TLValue::MessageEntityMention:
+    case TLValue::MessageEntityHashtag:
+    case TLValue::MessageEntityBotCommand:
+    case TLValue::MessageEntityUrl:
+    case TLValue::MessageEntityEmail:
+    case TLValue::MessageEntityBold:
+    case TLValue::MessageEntityItalic:
+    case TLValue::MessageEntityCode:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageEntityPre:
+    case TLValue::MessageEntityTextUrl:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::MessageEntityMentionName:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::InputMessageEntityMentionName:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLInputUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessageFwdHeader>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageFwdHeader:
+        *this >> flags;
+        if (flags & TLMessageFwdHeader::FromId) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        if (flags & TLMessageFwdHeader::ChannelId) {
+            skip<quint32>();
+        }
+        if (flags & TLMessageFwdHeader::ChannelPost) {
+            skip<quint32>();
+        }
+        if (flags & TLMessageFwdHeader::PostAuthor) {
+            skip<QString>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessageRange>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageRange:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesAffectedHistory>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAffectedHistory:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesAffectedMessages>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAffectedMessages:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesDhConfig>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        skip<QByteArray>();
+        break;
+    case TLValue::MessagesDhConfig:
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesSentEncryptedMessage>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        skip<quint32>();
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        skip<quint32>();
+        skip<TLEncryptedFile>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMsgDetailedInfo>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgDetailedInfo:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::MsgNewDetailedInfo:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMsgResendReq>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgResendReq:
+        skipVector<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMsgsAck>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsAck:
+        skipVector<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMsgsAllInfo>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsAllInfo:
+        skipVector<quint64>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMsgsStateInfo>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsStateInfo:
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMsgsStateReq>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsStateReq:
+        skipVector<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLNearestDc>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NearestDc:
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLNewSession>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NewSessionCreated:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPQInnerData>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PQInnerData:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<TLNumber256>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentCharge>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentCharge:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentSavedCredentials>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentSavedCredentialsCard:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPeer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerUser:
+    case TLValue::PeerChat:
+    case TLValue::PeerChannel:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPeerNotifyEvents>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhoneCallDiscardReason>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneCallDiscardReasonMissed:
+    case TLValue::PhoneCallDiscardReasonDisconnect:
+    case TLValue::PhoneCallDiscardReasonHangup:
+    case TLValue::PhoneCallDiscardReasonBusy:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhoneConnection>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneConnection:
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhotoSize>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotoSizeEmpty:
+        skip<QString>();
+        break;
+    case TLValue::PhotoSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::PhotoCachedSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPong>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Pong:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPopularContact>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PopularContact:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPostAddress>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PostAddress:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPrivacyKey>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+    case TLValue::PrivacyKeyChatInvite:
+    case TLValue::PrivacyKeyPhoneCall:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPrivacyRule>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+    case TLValue::PrivacyValueAllowAll:
+    case TLValue::PrivacyValueDisallowContacts:
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+    case TLValue::PrivacyValueDisallowUsers:
+        skipVector<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLReceivedNotifyMessage>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLReportReason>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputReportReasonSpam:
+    case TLValue::InputReportReasonViolence:
+    case TLValue::InputReportReasonPornography:
+        break;
+    case TLValue::InputReportReasonOther:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLResPQ>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ResPQ:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<QString>();
+        skipVector<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLRichText>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TextEmpty:
+        break;
+    case TLValue::TextPlain:
+        skip<QString>();
+        break;
+    case TLValue::TextBold:
+    case TLValue::TextItalic:
+    case TLValue::TextUnderline:
+    case TLValue::TextStrike:
+    case TLValue::TextFixed:
+        skip<TLRichText>();
+        break;
+    case TLValue::TextUrl:
+        skip<TLRichText>();
+        skip<QString>();
+        skip<quint64>();
+        break;
+    case TLValue::TextEmail:
+        skip<TLRichText>();
+        skip<QString>();
+        break;
+    case TLValue::TextConcat:
+        skipVector<TLRichText>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLRpcDropAnswer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::RpcAnswerUnknown:
+    case TLValue::RpcAnswerDroppedRunning:
+        break;
+    case TLValue::RpcAnswerDropped:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLRpcError>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::RpcError:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLSendMessageAction>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::SendMessageTypingAction:
+    case TLValue::SendMessageCancelAction:
+    case TLValue::SendMessageRecordVideoAction:
+    case TLValue::SendMessageRecordAudioAction:
+    case TLValue::SendMessageGeoLocationAction:
+    case TLValue::SendMessageChooseContactAction:
+    case TLValue::SendMessageGamePlayAction:
+    case TLValue::SendMessageRecordRoundAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+    case TLValue::SendMessageUploadAudioAction:
+    case TLValue::SendMessageUploadPhotoAction:
+    case TLValue::SendMessageUploadDocumentAction:
+    case TLValue::SendMessageUploadRoundAction:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLServerDHInnerData>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ServerDHInnerData:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLServerDHParams>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ServerDHParamsFail:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        break;
+    case TLValue::ServerDHParamsOk:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLSetClientDHParamsAnswer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DhGenOk:
+    case TLValue::DhGenRetry:
+    case TLValue::DhGenFail:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLShippingOption>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ShippingOption:
+        skip<QString>();
+        skip<QString>();
+        skipVector<TLLabeledPrice>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLStickerPack>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerPack:
+        skip<QString>();
+        skipVector<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLStorageFileType>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StorageFileUnknown:
+    case TLValue::StorageFilePartial:
+    case TLValue::StorageFileJpeg:
+    case TLValue::StorageFileGif:
+    case TLValue::StorageFilePng:
+    case TLValue::StorageFilePdf:
+    case TLValue::StorageFileMp3:
+    case TLValue::StorageFileMov:
+    case TLValue::StorageFileMp4:
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLTopPeer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TopPeer:
+        skip<TLPeer>();
+        skip<double>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLTopPeerCategory>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TopPeerCategoryBotsPM:
+    case TLValue::TopPeerCategoryBotsInline:
+    case TLValue::TopPeerCategoryCorrespondents:
+    case TLValue::TopPeerCategoryGroups:
+    case TLValue::TopPeerCategoryChannels:
+    case TLValue::TopPeerCategoryPhoneCalls:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLTopPeerCategoryPeers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TopPeerCategoryPeers:
+        skip<TLTopPeerCategory>();
+        skip<quint32>();
+        skipVector<TLTopPeer>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUpdatesState>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesState:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUploadCdnFile>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UploadCdnFileReuploadNeeded:
+    case TLValue::UploadCdnFile:
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUploadFile>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UploadFile:
+        skip<TLStorageFileType>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    case TLValue::UploadFileCdnRedirect:
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skipVector<TLCdnFileHash>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUploadWebFile>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UploadWebFile:
+        skip<quint32>();
+        skip<QString>();
+        skip<TLStorageFileType>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUserProfilePhoto>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        skip<quint64>();
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUserStatus>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserStatusEmpty:
+    case TLValue::UserStatusRecently:
+    case TLValue::UserStatusLastWeek:
+    case TLValue::UserStatusLastMonth:
+        break;
+    case TLValue::UserStatusOnline:
+    case TLValue::UserStatusOffline:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLWallPaper>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WallPaper:
+        skip<quint32>();
+        skip<QString>();
+        skipVector<TLPhotoSize>();
+        skip<quint32>();
+        break;
+    case TLValue::WallPaperSolid:
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAccountAuthorizations>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountAuthorizations:
+        skipVector<TLAuthorization>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthSentCode>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthSentCode:
+        *this >> flags;
+        skip<TLAuthSentCodeType>();
+        skip<QString>();
+        if (flags & TLAuthSentCode::NextType) {
+            skip<TLAuthCodeType>();
+        }
+        if (flags & TLAuthSentCode::Timeout) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLCdnConfig>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::CdnConfig:
+        skipVector<TLCdnPublicKey>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelAdminLogEventsFilter>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminLogEventsFilter:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelAdminRights>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminRights:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelBannedRights>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelBannedRights:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelMessagesFilter>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelMessagesFilterEmpty:
+        break;
+    case TLValue::ChannelMessagesFilter:
+        skip<quint32>();
+        skipVector<TLMessageRange>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelParticipant>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelParticipant:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantSelf:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantCreator:
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLChannelAdminRights>();
+        break;
+    case TLValue::ChannelParticipantBanned:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLChannelBannedRights>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChatPhoto>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactStatus>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDcOption>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DcOption:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDocumentAttribute>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAnimated:
+    case TLValue::DocumentAttributeHasStickers:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        *this >> flags;
+        skip<QString>();
+        skip<TLInputStickerSet>();
+        if (flags & TLDocumentAttribute::MaskCoords) {
+            skip<TLMaskCoords>();
+        }
+        break;
+    case TLValue::DocumentAttributeVideo:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAudio:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLDocumentAttribute::Title) {
+            skip<QString>();
+        }
+        if (flags & TLDocumentAttribute::Performer) {
+            skip<QString>();
+        }
+        if (flags & TLDocumentAttribute::Waveform) {
+            skip<QByteArray>();
+        }
+        break;
+    case TLValue::DocumentAttributeFilename:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDraftMessage>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DraftMessageEmpty:
+        break;
+    case TLValue::DraftMessage:
+        *this >> flags;
+        if (flags & TLDraftMessage::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        skip<QString>();
+        if (flags & TLDraftMessage::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHelpConfigSimple>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpConfigSimple:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLIpPort>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputChatPhoto>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        skip<TLInputFile>();
+        break;
+    case TLValue::InputChatPhoto:
+        skip<TLInputPhoto>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputGame>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputGameID:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputGameShortName:
+        skip<TLInputUser>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputNotifyPeer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputNotifyPeer:
+        skip<TLInputPeer>();
+        break;
+    case TLValue::InputNotifyUsers:
+    case TLValue::InputNotifyChats:
+    case TLValue::InputNotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPaymentCredentials>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPaymentCredentialsSaved:
+        skip<QString>();
+        skip<QByteArray>();
+        break;
+    case TLValue::InputPaymentCredentials:
+        skip<quint32>();
+        skip<TLDataJSON>();
+        break;
+    case TLValue::InputPaymentCredentialsApplePay:
+    case TLValue::InputPaymentCredentialsAndroidPay:
+        skip<TLDataJSON>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPeerNotifySettings>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerNotifySettings:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputPrivacyRule>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+    case TLValue::InputPrivacyValueAllowAll:
+    case TLValue::InputPrivacyValueDisallowContacts:
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+    case TLValue::InputPrivacyValueDisallowUsers:
+        skipVector<TLInputUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputStickerSetItem>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputStickerSetItem:
+        *this >> flags;
+        skip<TLInputDocument>();
+        skip<QString>();
+        if (flags & TLInputStickerSetItem::MaskCoords) {
+            skip<TLMaskCoords>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputWebDocument>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputWebDocument:
+        skip<QString>();
+        skip<quint32>();
+        skip<QString>();
+        skipVector<TLDocumentAttribute>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInvoice>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Invoice:
+        skip<quint32>();
+        skip<QString>();
+        skipVector<TLLabeledPrice>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLKeyboardButton>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::KeyboardButton:
+    case TLValue::KeyboardButtonRequestPhone:
+    case TLValue::KeyboardButtonRequestGeoLocation:
+    case TLValue::KeyboardButtonGame:
+    case TLValue::KeyboardButtonBuy:
+        skip<QString>();
+        break;
+    case TLValue::KeyboardButtonUrl:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::KeyboardButtonCallback:
+        skip<QString>();
+        skip<QByteArray>();
+        break;
+    case TLValue::KeyboardButtonSwitchInline:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLKeyboardButtonRow>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::KeyboardButtonRow:
+        skipVector<TLKeyboardButton>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLLangPackDifference>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LangPackDifference:
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLLangPackString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesBotCallbackAnswer>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesBotCallbackAnswer:
+        *this >> flags;
+        if (flags & TLMessagesBotCallbackAnswer::Message) {
+            skip<QString>();
+        }
+        if (flags & TLMessagesBotCallbackAnswer::Url) {
+            skip<QString>();
+        }
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesFilter>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+    case TLValue::InputMessagesFilterPhotos:
+    case TLValue::InputMessagesFilterVideo:
+    case TLValue::InputMessagesFilterPhotoVideo:
+    case TLValue::InputMessagesFilterDocument:
+    case TLValue::InputMessagesFilterUrl:
+    case TLValue::InputMessagesFilterGif:
+    case TLValue::InputMessagesFilterVoice:
+    case TLValue::InputMessagesFilterMusic:
+    case TLValue::InputMessagesFilterChatPhotos:
+    case TLValue::InputMessagesFilterRoundVoice:
+    case TLValue::InputMessagesFilterRoundVideo:
+    case TLValue::InputMessagesFilterMyMentions:
+    case TLValue::InputMessagesFilterGeo:
+    case TLValue::InputMessagesFilterContacts:
+        break;
+    case TLValue::InputMessagesFilterPhoneCalls:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesMessageEditData>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesMessageEditData:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLNotifyPeer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NotifyPeer:
+        skip<TLPeer>();
+        break;
+    case TLValue::NotifyUsers:
+    case TLValue::NotifyChats:
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentRequestedInfo>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentRequestedInfo:
+        *this >> flags;
+        if (flags & TLPaymentRequestedInfo::Name) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentRequestedInfo::Phone) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentRequestedInfo::Email) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentRequestedInfo::ShippingAddress) {
+            skip<TLPostAddress>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentsSavedInfo>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsSavedInfo:
+        *this >> flags;
+        if (flags & TLPaymentsSavedInfo::SavedInfo) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentsValidatedRequestedInfo>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsValidatedRequestedInfo:
+        *this >> flags;
+        if (flags & TLPaymentsValidatedRequestedInfo::Id) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentsValidatedRequestedInfo::ShippingOptions) {
+            skipVector<TLShippingOption>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPeerNotifySettings>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPeerSettings>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerSettings:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhoneCallProtocol>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneCallProtocol:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhoto>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotoEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Photo:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skipVector<TLPhotoSize>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLReplyMarkup>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ReplyKeyboardHide:
+    case TLValue::ReplyKeyboardForceReply:
+        skip<quint32>();
+        break;
+    case TLValue::ReplyKeyboardMarkup:
+        skip<quint32>();
+        skipVector<TLKeyboardButtonRow>();
+        break;
+    case TLValue::ReplyInlineMarkup:
+        skipVector<TLKeyboardButtonRow>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLStickerSet>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerSet:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUser>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::User:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUser::AccessHash) {
+            skip<quint64>();
+        }
+        if (flags & TLUser::FirstName) {
+            skip<QString>();
+        }
+        if (flags & TLUser::LastName) {
+            skip<QString>();
+        }
+        if (flags & TLUser::Username) {
+            skip<QString>();
+        }
+        if (flags & TLUser::Phone) {
+            skip<QString>();
+        }
+        if (flags & TLUser::Photo) {
+            skip<TLUserProfilePhoto>();
+        }
+        if (flags & TLUser::Status) {
+            skip<TLUserStatus>();
+        }
+        if (flags & TLUser::BotInfoVersion) {
+            skip<quint32>();
+        }
+        if (flags & TLUser::RestrictionReason) {
+            skip<QString>();
+        }
+        if (flags & TLUser::BotInlinePlaceholder) {
+            skip<QString>();
+        }
+        if (flags & TLUser::LangCode) {
+            skip<QString>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLWebDocument>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WebDocument:
+        skip<QString>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skipVector<TLDocumentAttribute>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAccountPrivacyRules>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPrivacyRules:
+        skipVector<TLPrivacyRule>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLAuthAuthorization>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthAuthorization:
+        *this >> flags;
+        if (flags & TLAuthAuthorization::TmpSessions) {
+            skip<quint32>();
+        }
+        skip<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLBotInlineMessage>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotInlineMessageMediaAuto:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageText:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLBotInlineMessage::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageMediaGeo:
+        *this >> flags;
+        skip<TLGeoPoint>();
+        skip<quint32>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageMediaVenue:
+        *this >> flags;
+        skip<TLGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageMediaContact:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelsChannelParticipant>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelsChannelParticipant:
+        skip<TLChannelParticipant>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelsChannelParticipants>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelsChannelParticipants:
+        skip<quint32>();
+        skipVector<TLChannelParticipant>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::ChannelsChannelParticipantsNotModified:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChat>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Chat:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLChat::MigratedTo) {
+            skip<TLInputChannel>();
+        }
+        break;
+    case TLValue::ChatForbidden:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::Channel:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLChat::AccessHash) {
+            skip<quint64>();
+        }
+        skip<QString>();
+        if (flags & TLChat::Username) {
+            skip<QString>();
+        }
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLChat::RestrictionReason) {
+            skip<QString>();
+        }
+        if (flags & TLChat::AdminRights) {
+            skip<TLChannelAdminRights>();
+        }
+        if (flags & TLChat::BannedRights) {
+            skip<TLChannelBannedRights>();
+        }
+        break;
+    case TLValue::ChannelForbidden:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint64>();
+        skip<QString>();
+        if (flags & TLChat::UntilDate) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChatFull>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatFull:
+        skip<quint32>();
+        skip<TLChatParticipants>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<TLExportedChatInvite>();
+        skipVector<TLBotInfo>();
+        break;
+    case TLValue::ChannelFull:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLChatFull::ParticipantsCount) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::AdminsCount) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::KickedCount) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::BannedCount) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<TLExportedChatInvite>();
+        skipVector<TLBotInfo>();
+        if (flags & TLChatFull::MigratedFromChatId) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::MigratedFromMaxId) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::PinnedMsgId) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::Stickerset) {
+            skip<TLStickerSet>();
+        }
+        if (flags & TLChatFull::AvailableMinId) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChatInvite>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatInviteAlready:
+        skip<TLChat>();
+        break;
+    case TLValue::ChatInvite:
+        *this >> flags;
+        skip<QString>();
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        if (flags & TLChatInvite::Participants) {
+            skipVector<TLUser>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLConfig>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Config:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        skipVector<TLDcOption>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLConfig::TmpSessions) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLConfig::SuggestedLangCode) {
+            skip<QString>();
+        }
+        if (flags & TLConfig::LangPackVersion) {
+            skip<quint32>();
+        }
+        skipVector<TLDisabledFeature>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactsBlocked>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsBlocked:
+        skipVector<TLContactBlocked>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::ContactsBlockedSlice:
+        skip<quint32>();
+        skipVector<TLContactBlocked>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactsContacts>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        skipVector<TLContact>();
+        skip<quint32>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactsFound>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsFound:
+        skipVector<TLPeer>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactsImportedContacts>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsImportedContacts:
+        skipVector<TLImportedContact>();
+        skipVector<TLPopularContact>();
+        skipVector<quint64>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactsLink>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsLink:
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        skip<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactsResolvedPeer>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsResolvedPeer:
+        skip<TLPeer>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLContactsTopPeers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsTopPeersNotModified:
+        break;
+    case TLValue::ContactsTopPeers:
+        skipVector<TLTopPeerCategoryPeers>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDialog>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Dialog:
+        *this >> flags;
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPeerNotifySettings>();
+        if (flags & TLDialog::Pts) {
+            skip<quint32>();
+        }
+        if (flags & TLDialog::Draft) {
+            skip<TLDraftMessage>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLDocument>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DocumentEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Document:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<TLPhotoSize>();
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLDocumentAttribute>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLFoundGif>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FoundGif:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::FoundGifCached:
+        skip<QString>();
+        skip<TLPhoto>();
+        skip<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLGame>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Game:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<TLPhoto>();
+        if (flags & TLGame::Document) {
+            skip<TLDocument>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHelpSupport>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpSupport:
+        skip<QString>();
+        skip<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputBotInlineMessage>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputBotInlineMessageMediaAuto:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageText:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaGeo:
+        *this >> flags;
+        skip<TLInputGeoPoint>();
+        skip<quint32>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaVenue:
+        *this >> flags;
+        skip<TLInputGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaContact:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageGame:
+        *this >> flags;
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputBotInlineResult>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputBotInlineResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineResult::Title) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::Description) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::Url) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::ThumbUrl) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::ContentUrl) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::ContentType) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::W) {
+            skip<quint32>();
+        }
+        if (flags & TLInputBotInlineResult::H) {
+            skip<quint32>();
+        }
+        if (flags & TLInputBotInlineResult::Duration) {
+            skip<quint32>();
+        }
+        skip<TLInputBotInlineMessage>();
+        break;
+    case TLValue::InputBotInlineResultPhoto:
+        skip<QString>();
+        skip<QString>();
+        skip<TLInputPhoto>();
+        skip<TLInputBotInlineMessage>();
+        break;
+    case TLValue::InputBotInlineResultDocument:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineResult::Title) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::Description) {
+            skip<QString>();
+        }
+        skip<TLInputDocument>();
+        skip<TLInputBotInlineMessage>();
+        break;
+    case TLValue::InputBotInlineResultGame:
+        skip<QString>();
+        skip<QString>();
+        skip<TLInputBotInlineMessage>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLInputMedia>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        *this >> flags;
+        skip<TLInputFile>();
+        skip<QString>();
+        if (flags & TLInputMedia::Stickers) {
+            skipVector<TLInputDocument>();
+        }
+        if (flags & TLInputMedia::TtlSeconds1) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaPhoto:
+        *this >> flags;
+        skip<TLInputPhoto>();
+        skip<QString>();
+        if (flags & TLInputMedia::TtlSeconds0) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaGeoPoint:
+        skip<TLInputGeoPoint>();
+        break;
+    case TLValue::InputMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        *this >> flags;
+        skip<TLInputFile>();
+        if (flags & TLInputMedia::Thumb) {
+            skip<TLInputFile>();
+        }
+        skip<QString>();
+        skipVector<TLDocumentAttribute>();
+        skip<QString>();
+        if (flags & TLInputMedia::Stickers) {
+            skipVector<TLInputDocument>();
+        }
+        if (flags & TLInputMedia::TtlSeconds1) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaDocument:
+        *this >> flags;
+        skip<TLInputDocument>();
+        skip<QString>();
+        if (flags & TLInputMedia::TtlSeconds0) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaVenue:
+        skip<TLInputGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaGifExternal:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaPhotoExternal:
+    case TLValue::InputMediaDocumentExternal:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputMedia::TtlSeconds0) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaGame:
+        skip<TLInputGame>();
+        break;
+    case TLValue::InputMediaInvoice:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputMedia::Photo) {
+            skip<TLInputWebDocument>();
+        }
+        skip<TLInvoice>();
+        skip<QByteArray>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaGeoLive:
+        skip<TLInputGeoPoint>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessageAction>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageActionEmpty:
+    case TLValue::MessageActionChatDeletePhoto:
+    case TLValue::MessageActionPinMessage:
+    case TLValue::MessageActionHistoryClear:
+    case TLValue::MessageActionScreenshotTaken:
+        break;
+    case TLValue::MessageActionChatCreate:
+        skip<QString>();
+        skipVector<quint32>();
+        break;
+    case TLValue::MessageActionChatEditTitle:
+    case TLValue::MessageActionChannelCreate:
+    case TLValue::MessageActionCustomAction:
+        skip<QString>();
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        skip<TLPhoto>();
+        break;
+    case TLValue::MessageActionChatAddUser:
+        skipVector<quint32>();
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+    case TLValue::MessageActionChatJoinedByLink:
+    case TLValue::MessageActionChatMigrateTo:
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionChannelMigrateFrom:
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionGameScore:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionPaymentSentMe:
+        *this >> flags;
+        skip<QString>();
+        skip<quint64>();
+        skip<QByteArray>();
+        if (flags & TLMessageAction::Info) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLMessageAction::ShippingOptionId) {
+            skip<QString>();
+        }
+        skip<TLPaymentCharge>();
+        break;
+    case TLValue::MessageActionPaymentSent:
+        skip<QString>();
+        skip<quint64>();
+        break;
+    case TLValue::MessageActionPhoneCall:
+        *this >> flags;
+        skip<quint64>();
+        if (flags & TLMessageAction::Reason) {
+            skip<TLPhoneCallDiscardReason>();
+        }
+        if (flags & TLMessageAction::Duration) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesAllStickers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        skip<quint32>();
+        skipVector<TLStickerSet>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesChatFull>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesChatFull:
+        skip<TLChatFull>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesChats>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesChats:
+        skipVector<TLChat>();
+        break;
+    case TLValue::MessagesChatsSlice:
+        skip<quint32>();
+        skipVector<TLChat>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesFavedStickers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesFavedStickersNotModified:
+        break;
+    case TLValue::MessagesFavedStickers:
+        skip<quint32>();
+        skipVector<TLStickerPack>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesFoundGifs>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesFoundGifs:
+        skip<quint32>();
+        skipVector<TLFoundGif>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesHighScores>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesHighScores:
+        skipVector<TLHighScore>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesRecentStickers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesRecentStickersNotModified:
+        break;
+    case TLValue::MessagesRecentStickers:
+        skip<quint32>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesSavedGifs>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesSavedGifsNotModified:
+        break;
+    case TLValue::MessagesSavedGifs:
+        skip<quint32>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesStickerSet>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickerSet:
+        skip<TLStickerSet>();
+        skipVector<TLStickerPack>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesStickers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        skip<QString>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPageBlock>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PageBlockUnsupported:
+    case TLValue::PageBlockDivider:
+        break;
+    case TLValue::PageBlockTitle:
+    case TLValue::PageBlockSubtitle:
+    case TLValue::PageBlockHeader:
+    case TLValue::PageBlockSubheader:
+    case TLValue::PageBlockParagraph:
+    case TLValue::PageBlockFooter:
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockAuthorDate:
+        skip<TLRichText>();
+        skip<quint32>();
+        break;
+    case TLValue::PageBlockPreformatted:
+        skip<TLRichText>();
+        skip<QString>();
+        break;
+    case TLValue::PageBlockAnchor:
+        skip<QString>();
+        break;
+    case TLValue::PageBlockList:
+        skip<bool>();
+        skipVector<TLRichText>();
+        break;
+    case TLValue::PageBlockBlockquote:
+    case TLValue::PageBlockPullquote:
+        skip<TLRichText>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockPhoto:
+    case TLValue::PageBlockAudio:
+        skip<quint64>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockVideo:
+        skip<quint32>();
+        skip<quint64>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockCover:
+        skip<TLPageBlock>();
+        break;
+    case TLValue::PageBlockEmbed:
+        *this >> flags;
+        if (flags & TLPageBlock::Url) {
+            skip<QString>();
+        }
+        if (flags & TLPageBlock::Html) {
+            skip<QString>();
+        }
+        if (flags & TLPageBlock::PosterPhotoId) {
+            skip<quint64>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockEmbedPost:
+        skip<QString>();
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<quint32>();
+        skipVector<TLPageBlock>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockCollage:
+    case TLValue::PageBlockSlideshow:
+        skipVector<TLPageBlock>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockChannel:
+        skip<TLChat>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentsPaymentForm>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsPaymentForm:
+        *this >> flags;
+        skip<quint32>();
+        skip<TLInvoice>();
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLPaymentsPaymentForm::NativeProvider) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentsPaymentForm::NativeParams) {
+            skip<TLDataJSON>();
+        }
+        if (flags & TLPaymentsPaymentForm::SavedInfo) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLPaymentsPaymentForm::SavedCredentials) {
+            skip<TLPaymentSavedCredentials>();
+        }
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentsPaymentReceipt>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsPaymentReceipt:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLInvoice>();
+        skip<quint32>();
+        if (flags & TLPaymentsPaymentReceipt::Info) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLPaymentsPaymentReceipt::Shipping) {
+            skip<TLShippingOption>();
+        }
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhoneCall>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneCallEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::PhoneCallWaiting:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPhoneCallProtocol>();
+        if (flags & TLPhoneCall::ReceiveDate) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::PhoneCallRequested:
+    case TLValue::PhoneCallAccepted:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLPhoneCallProtocol>();
+        break;
+    case TLValue::PhoneCall:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint64>();
+        skip<TLPhoneCallProtocol>();
+        skip<TLPhoneConnection>();
+        skipVector<TLPhoneConnection>();
+        skip<quint32>();
+        break;
+    case TLValue::PhoneCallDiscarded:
+        *this >> flags;
+        skip<quint64>();
+        if (flags & TLPhoneCall::Reason) {
+            skip<TLPhoneCallDiscardReason>();
+        }
+        if (flags & TLPhoneCall::Duration) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhonePhoneCall>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhonePhoneCall:
+        skip<TLPhoneCall>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhotosPhoto>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotosPhoto:
+        skip<TLPhoto>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPhotosPhotos>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotosPhotos:
+        skipVector<TLPhoto>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::PhotosPhotosSlice:
+        skip<quint32>();
+        skipVector<TLPhoto>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLStickerSetCovered>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerSetCovered:
+        skip<TLStickerSet>();
+        skip<TLDocument>();
+        break;
+    case TLValue::StickerSetMultiCovered:
+        skip<TLStickerSet>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUserFull>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserFull:
+        *this >> flags;
+        skip<TLUser>();
+        if (flags & TLUserFull::About) {
+            skip<QString>();
+        }
+        skip<TLContactsLink>();
+        if (flags & TLUserFull::ProfilePhoto) {
+            skip<TLPhoto>();
+        }
+        skip<TLPeerNotifySettings>();
+        if (flags & TLUserFull::BotInfo) {
+            skip<TLBotInfo>();
+        }
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLBotInlineResult>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotInlineResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineResult::Title1) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::Description2) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::Url) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::ThumbUrl) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::ContentUrl) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::ContentType) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::W) {
+            skip<quint32>();
+        }
+        if (flags & TLBotInlineResult::H) {
+            skip<quint32>();
+        }
+        if (flags & TLBotInlineResult::Duration) {
+            skip<quint32>();
+        }
+        skip<TLBotInlineMessage>();
+        break;
+    case TLValue::BotInlineMediaResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineResult::Photo) {
+            skip<TLPhoto>();
+        }
+        if (flags & TLBotInlineResult::Document) {
+            skip<TLDocument>();
+        }
+        if (flags & TLBotInlineResult::Title2) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::Description3) {
+            skip<QString>();
+        }
+        skip<TLBotInlineMessage>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesArchivedStickers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesArchivedStickers:
+        skip<quint32>();
+        skipVector<TLStickerSetCovered>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesBotResults>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesBotResults:
+        *this >> flags;
+        skip<quint64>();
+        if (flags & TLMessagesBotResults::NextOffset) {
+            skip<QString>();
+        }
+        if (flags & TLMessagesBotResults::SwitchPm) {
+            skip<TLInlineBotSwitchPM>();
+        }
+        skipVector<TLBotInlineResult>();
+        skip<quint32>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesFeaturedStickers>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesFeaturedStickersNotModified:
+        break;
+    case TLValue::MessagesFeaturedStickers:
+        skip<quint32>();
+        skipVector<TLStickerSetCovered>();
+        skipVector<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesStickerSetInstallResult>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickerSetInstallResultSuccess:
+        break;
+    case TLValue::MessagesStickerSetInstallResultArchive:
+        skipVector<TLStickerSetCovered>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPage>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PagePart:
+    case TLValue::PageFull:
+        skipVector<TLPageBlock>();
+        skipVector<TLPhoto>();
+        skipVector<TLDocument>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLRecentMeUrl>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::RecentMeUrlUnknown:
+        skip<QString>();
+        break;
+    case TLValue::RecentMeUrlUser:
+    case TLValue::RecentMeUrlChat:
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::RecentMeUrlChatInvite:
+        skip<QString>();
+        skip<TLChatInvite>();
+        break;
+    case TLValue::RecentMeUrlStickerSet:
+        skip<QString>();
+        skip<TLStickerSetCovered>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLWebPage>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WebPageEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::WebPagePending:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    case TLValue::WebPage:
+        *this >> flags;
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        if (flags & TLWebPage::Type) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::SiteName) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Title) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Description) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Photo) {
+            skip<TLPhoto>();
+        }
+        if (flags & TLWebPage::EmbedUrl) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::EmbedType) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::EmbedWidth) {
+            skip<quint32>();
+        }
+        if (flags & TLWebPage::EmbedHeight) {
+            skip<quint32>();
+        }
+        if (flags & TLWebPage::Duration) {
+            skip<quint32>();
+        }
+        if (flags & TLWebPage::Author) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Document) {
+            skip<TLDocument>();
+        }
+        if (flags & TLWebPage::CachedPage) {
+            skip<TLPage>();
+        }
+        break;
+    case TLValue::WebPageNotModified:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLHelpRecentMeUrls>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpRecentMeUrls:
+        skipVector<TLRecentMeUrl>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessageMedia>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageMediaEmpty:
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaPhoto:
+        *this >> flags;
+        if (flags & TLMessageMedia::Photo) {
+            skip<TLPhoto>();
+        }
+        if (flags & TLMessageMedia::Caption) {
+            skip<QString>();
+        }
+        if (flags & TLMessageMedia::TtlSeconds) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::MessageMediaGeo:
+        skip<TLGeoPoint>();
+        break;
+    case TLValue::MessageMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageMediaDocument:
+        *this >> flags;
+        if (flags & TLMessageMedia::Document) {
+            skip<TLDocument>();
+        }
+        if (flags & TLMessageMedia::Caption) {
+            skip<QString>();
+        }
+        if (flags & TLMessageMedia::TtlSeconds) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::MessageMediaWebPage:
+        skip<TLWebPage>();
+        break;
+    case TLValue::MessageMediaVenue:
+        skip<TLGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaGame:
+        skip<TLGame>();
+        break;
+    case TLValue::MessageMediaInvoice:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLMessageMedia::WebDocumentPhoto) {
+            skip<TLWebDocument>();
+        }
+        if (flags & TLMessageMedia::ReceiptMsgId) {
+            skip<quint32>();
+        }
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaGeoLive:
+        skip<TLGeoPoint>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessage>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Message:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLMessage::FromId) {
+            skip<quint32>();
+        }
+        skip<TLPeer>();
+        if (flags & TLMessage::FwdFrom) {
+            skip<TLMessageFwdHeader>();
+        }
+        if (flags & TLMessage::ViaBotId) {
+            skip<quint32>();
+        }
+        if (flags & TLMessage::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLMessage::Media) {
+            skip<TLMessageMedia>();
+        }
+        if (flags & TLMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        if (flags & TLMessage::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        if (flags & TLMessage::Views) {
+            skip<quint32>();
+        }
+        if (flags & TLMessage::EditDate) {
+            skip<quint32>();
+        }
+        if (flags & TLMessage::PostAuthor) {
+            skip<QString>();
+        }
+        break;
+    case TLValue::MessageService:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLMessage::FromId) {
+            skip<quint32>();
+        }
+        skip<TLPeer>();
+        if (flags & TLMessage::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<TLMessageAction>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesDialogs>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesDialogs:
+        skipVector<TLDialog>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::MessagesDialogsSlice:
+        skip<quint32>();
+        skipVector<TLDialog>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesMessages>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesMessages:
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::MessagesMessagesSlice:
+        skip<quint32>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::MessagesChannelMessages:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::MessagesMessagesNotModified:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLMessagesPeerDialogs>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesPeerDialogs:
+        skipVector<TLDialog>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        skip<TLUpdatesState>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUpdate>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+    case TLValue::UpdateEditChannelMessage:
+    case TLValue::UpdateEditMessage:
+        skip<TLMessage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateMessageID:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+        skipVector<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateUserTyping:
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatUserTyping:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatParticipants:
+        skip<TLChatParticipants>();
+        break;
+    case TLValue::UpdateUserStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UpdateUserName:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateUserPhoto:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLUserProfilePhoto>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateContactRegistered:
+    case TLValue::UpdateReadChannelInbox:
+    case TLValue::UpdateChannelPinnedMessage:
+    case TLValue::UpdateReadChannelOutbox:
+    case TLValue::UpdateChannelAvailableMessages:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateContactLink:
+        skip<quint32>();
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        skip<TLEncryptedMessage>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+    case TLValue::UpdateChannel:
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryption:
+        skip<TLEncryptedChat>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+    case TLValue::UpdateChatParticipantDelete:
+    case TLValue::UpdateChannelMessageViews:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateDcOptions:
+        skipVector<TLDcOption>();
+        break;
+    case TLValue::UpdateUserBlocked:
+        skip<quint32>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateNotifySettings:
+        skip<TLNotifyPeer>();
+        skip<TLPeerNotifySettings>();
+        break;
+    case TLValue::UpdateServiceNotification:
+        *this >> flags;
+        if (flags & TLUpdate::InboxDate) {
+            skip<quint32>();
+        }
+        skip<QString>();
+        skip<QString>();
+        skip<TLMessageMedia>();
+        skipVector<TLMessageEntity>();
+        break;
+    case TLValue::UpdatePrivacy:
+        skip<TLPrivacyKey>();
+        skipVector<TLPrivacyRule>();
+        break;
+    case TLValue::UpdateUserPhone:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateWebPage:
+        skip<TLWebPage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChannelTooLong:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdate::Pts) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::UpdateDeleteChannelMessages:
+        skip<quint32>();
+        skipVector<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatAdmins:
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateNewStickerSet:
+        skip<TLMessagesStickerSet>();
+        break;
+    case TLValue::UpdateStickerSetsOrder:
+        skip<quint32>();
+        skipVector<quint64>();
+        break;
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+    case TLValue::UpdateReadFeaturedStickers:
+    case TLValue::UpdateRecentStickers:
+    case TLValue::UpdateConfig:
+    case TLValue::UpdatePtsChanged:
+    case TLValue::UpdateLangPackTooLong:
+    case TLValue::UpdateFavedStickers:
+    case TLValue::UpdateContactsReset:
+        break;
+    case TLValue::UpdateBotInlineQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLUpdate::Geo) {
+            skip<TLGeoPoint>();
+        }
+        skip<QString>();
+        break;
+    case TLValue::UpdateBotInlineSend:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLUpdate::Geo) {
+            skip<TLGeoPoint>();
+        }
+        skip<QString>();
+        if (flags & TLUpdate::InputBotInlineMessageIDMsgId) {
+            skip<TLInputBotInlineMessageID>();
+        }
+        break;
+    case TLValue::UpdateBotCallbackQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint64>();
+        if (flags & TLUpdate::ByteArrayData) {
+            skip<QByteArray>();
+        }
+        if (flags & TLUpdate::GameShortName) {
+            skip<QString>();
+        }
+        break;
+    case TLValue::UpdateInlineBotCallbackQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<TLInputBotInlineMessageID>();
+        skip<quint64>();
+        if (flags & TLUpdate::ByteArrayData) {
+            skip<QByteArray>();
+        }
+        if (flags & TLUpdate::GameShortName) {
+            skip<QString>();
+        }
+        break;
+    case TLValue::UpdateDraftMessage:
+        skip<TLPeer>();
+        skip<TLDraftMessage>();
+        break;
+    case TLValue::UpdateChannelWebPage:
+        skip<quint32>();
+        skip<TLWebPage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateDialogPinned:
+        skip<quint32>();
+        skip<TLPeer>();
+        break;
+    case TLValue::UpdatePinnedDialogs:
+        *this >> flags;
+        if (flags & TLUpdate::PeerOrderVector) {
+            skipVector<TLPeer>();
+        }
+        break;
+    case TLValue::UpdateBotWebhookJSON:
+        skip<TLDataJSON>();
+        break;
+    case TLValue::UpdateBotWebhookJSONQuery:
+        skip<quint64>();
+        skip<TLDataJSON>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateBotShippingQuery:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLPostAddress>();
+        break;
+    case TLValue::UpdateBotPrecheckoutQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<QByteArray>();
+        if (flags & TLUpdate::Info) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLUpdate::ShippingOptionId) {
+            skip<QString>();
+        }
+        skip<QString>();
+        skip<quint64>();
+        break;
+    case TLValue::UpdatePhoneCall:
+        skip<TLPhoneCall>();
+        break;
+    case TLValue::UpdateLangPack:
+        skip<TLLangPackDifference>();
+        break;
+    case TLValue::UpdateChannelReadMessagesContents:
+        skip<quint32>();
+        skipVector<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUpdates>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLUpdates::FwdFrom) {
+            skip<TLMessageFwdHeader>();
+        }
+        if (flags & TLUpdates::ViaBotId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLUpdates::FwdFrom) {
+            skip<TLMessageFwdHeader>();
+        }
+        if (flags & TLUpdates::ViaBotId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    case TLValue::UpdateShort:
+        skip<TLUpdate>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesCombined:
+        skipVector<TLUpdate>();
+        skipVector<TLUser>();
+        skipVector<TLChat>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::Updates:
+        skipVector<TLUpdate>();
+        skipVector<TLUser>();
+        skipVector<TLChat>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateShortSentMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLUpdates::Media) {
+            skip<TLMessageMedia>();
+        }
+        if (flags & TLUpdates::Entities) {
+            skipVector<TLMessageEntity>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUpdatesChannelDifference>()
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesChannelDifferenceEmpty:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdatesChannelDifference::Timeout) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::UpdatesChannelDifferenceTooLong:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdatesChannelDifference::Timeout) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skipVector<TLMessage>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    case TLValue::UpdatesChannelDifference:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdatesChannelDifference::Timeout) {
+            skip<quint32>();
+        }
+        skipVector<TLMessage>();
+        skipVector<TLUpdate>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLUpdatesDifference>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesDifference:
+    case TLValue::UpdatesDifferenceSlice:
+        skipVector<TLMessage>();
+        skipVector<TLEncryptedMessage>();
+        skipVector<TLUpdate>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        skip<TLUpdatesState>();
+        break;
+    case TLValue::UpdatesDifferenceTooLong:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelAdminLogEventAction>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminLogEventActionChangeTitle:
+    case TLValue::ChannelAdminLogEventActionChangeAbout:
+    case TLValue::ChannelAdminLogEventActionChangeUsername:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::ChannelAdminLogEventActionChangePhoto:
+        skip<TLChatPhoto>();
+        skip<TLChatPhoto>();
+        break;
+    case TLValue::ChannelAdminLogEventActionToggleInvites:
+    case TLValue::ChannelAdminLogEventActionToggleSignatures:
+    case TLValue::ChannelAdminLogEventActionTogglePreHistoryHidden:
+        skip<bool>();
+        break;
+    case TLValue::ChannelAdminLogEventActionUpdatePinned:
+    case TLValue::ChannelAdminLogEventActionDeleteMessage:
+        skip<TLMessage>();
+        break;
+    case TLValue::ChannelAdminLogEventActionEditMessage:
+        skip<TLMessage>();
+        skip<TLMessage>();
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantJoin:
+    case TLValue::ChannelAdminLogEventActionParticipantLeave:
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantInvite:
+        skip<TLChannelParticipant>();
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantToggleBan:
+    case TLValue::ChannelAdminLogEventActionParticipantToggleAdmin:
+        skip<TLChannelParticipant>();
+        skip<TLChannelParticipant>();
+        break;
+    case TLValue::ChannelAdminLogEventActionChangeStickerSet:
+        skip<TLInputStickerSet>();
+        skip<TLInputStickerSet>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLPaymentsPaymentResult>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsPaymentResult:
+        skip<TLUpdates>();
+        break;
+    case TLValue::PaymentsPaymentVerficationNeeded:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelAdminLogEvent>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminLogEvent:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLChannelAdminLogEventAction>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+template <>
+Stream &Stream::skip<TLChannelsAdminLogResults>()
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelsAdminLogResults:
+        skipVector<TLChannelAdminLogEvent>();
+        skipVector<TLChat>();
+        skipVector<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+// End of generated skip specializations implementation
+
+} // MTProto namespace
+
+} // Telegram namespace
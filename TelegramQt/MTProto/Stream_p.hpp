@@ -19,6 +19,7 @@
 #define TELEGRAM_QT_MTPROTO_STREAM_P_HPP
 
 #include "Stream.hpp"
+#include "DecodeArena.hpp"
 
 namespace Telegram {
 
@@ -34,14 +35,19 @@ Stream &Stream::operator>>(TLVector<T> &v)
     if (result.tlType == TLValue::Vector) {
         quint32 length = 0;
         *this >> length;
-        for (quint32 i = 0; i < length; ++i) {
-            T value;
-            *this >> value;
-            result.append(value);
+        if (Q_UNLIKELY(!isAcceptableVectorLength(length))) {
+            setError(true);
+            length = 0;
+        }
+        result.reserve(getVectorReserve(length));
+        for (quint32 i = 0; (i < length) && !error(); ++i) {
+            // Decode the item in place instead of copying a local value into the vector
+            result.append(T());
+            *this >> result.last();
         }
     }
 
-    v = result;
+    v = std::move(result);
     return *this;
 }
 
@@ -55,15 +61,45 @@ Stream &Stream::operator>>(TLVector<T*> &v)
     if (result.tlType == TLValue::Vector) {
         quint32 length = 0;
         *this >> length;
-        for (quint32 i = 0; i < length; ++i) {
-            T *value = new T;
+        if (Q_UNLIKELY(!isAcceptableVectorLength(length))) {
+            setError(true);
+            length = 0;
+        }
+        result.reserve(getVectorReserve(length));
+        for (quint32 i = 0; (i < length) && !error(); ++i) {
+            T *value = m_arena ? m_arena->create<T>() : new T;
             *this >> *value;
             result.append(value);
         }
     }
 
-    qDeleteAll(v);
-    v = result;
+    // The arena items go away with their arena, whichever stream decoded them
+    if (!v.itemsArena) {
+        qDeleteAll(v);
+    }
+    result.itemsArena = m_arena;
+    v = std::move(result);
+    return *this;
+}
+
+template <typename T>
+Stream &Stream::skipVector()
+{
+    TLValue tlType;
+    *this >> tlType;
+
+    if (tlType == TLValue::Vector) {
+        quint32 length = 0;
+        *this >> length;
+        if (Q_UNLIKELY(!isAcceptableVectorLength(length))) {
+            setError(true);
+            length = 0;
+        }
+        for (quint32 i = 0; (i < length) && !error(); ++i) {
+            skip<T>();
+        }
+    }
+
     return *this;
 }
 
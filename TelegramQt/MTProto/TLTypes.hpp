@@ -30,6 +30,29 @@
 template <typename TL>
 using TLPtr = Telegram::UniqueLazyPointer<TL>;
 
+namespace Telegram {
+
+namespace MTProto {
+
+class DecodeArena;
+
+} // MTProto namespace
+
+} // Telegram namespace
+
+// The items of a pointer vector are owned either by the heap (the default)
+// or by the arena that the vector was decoded into
+template <typename T>
+struct TLVectorItemsOwner
+{
+};
+
+template <typename T>
+struct TLVectorItemsOwner<T*>
+{
+    Telegram::MTProto::DecodeArena *itemsArena = nullptr;
+};
+
 struct TLBool
 {
     constexpr TLBool() = default;
@@ -68,13 +91,14 @@ struct TLBool
 };
 
 template <typename T>
-class TELEGRAMQT_INTERNAL_EXPORT TLVector : public QVector<T>
+class TELEGRAMQT_INTERNAL_EXPORT TLVector : public QVector<T>, public TLVectorItemsOwner<T>
 {
 public:
     TLVector() : QVector<T>(), tlType(TLValue::Vector) { }
     explicit TLVector(int size) : QVector<T>(size), tlType(TLValue::Vector) { }
     TLVector(int size, const T &t) : QVector<T>(size, t), tlType(TLValue::Vector) { }
-    TLVector(const TLVector<T> &v) : QVector<T>(v), tlType(v.tlType) { }
+    TLVector(const TLVector<T> &v) : QVector<T>(v), TLVectorItemsOwner<T>(v), tlType(v.tlType) { }
+    TLVector(TLVector<T> &&v) : QVector<T>(std::move(v)), TLVectorItemsOwner<T>(v), tlType(v.tlType) { }
     TLVector(const QVector<T> &v) : QVector<T>(v), tlType(TLValue::Vector) { }
     TLVector(std::initializer_list<T> args) : QVector<T>(args), tlType(TLValue::Vector) { }
 
@@ -103,6 +127,14 @@ public:
     TLVector &operator=(const TLVector &v) {
         tlType = v.tlType;
         QVector<T>::operator =(v);
+        TLVectorItemsOwner<T>::operator =(v);
+        return *this;
+    }
+
+    TLVector &operator=(TLVector &&v) {
+        tlType = v.tlType;
+        QVector<T>::operator =(std::move(v));
+        TLVectorItemsOwner<T>::operator =(v);
         return *this;
     }
 
@@ -3727,7 +3759,7 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLChatInvite {
     bool broadcast() const { return flags & Broadcast; }
     bool isPublic() const { return flags & IsPublic; }
     bool megagroup() const { return flags & Megagroup; }
-    TLChat chat;
+    TLPtr<TLChat> chat;
     quint32 flags = 0;
     QString title;
     TLChatPhoto photo;
@@ -4506,7 +4538,7 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLPageBlock {
     quint32 date = 0;
     TLVector<TLPageBlock*> blocks;
     TLVector<TLPageBlock*> pageBlockItemsVector;
-    TLChat channel;
+    TLPtr<TLChat> channel;
     quint64 audioId = 0;
     TLValue tlType = TLValue::PageBlockUnsupported;
 };
@@ -4893,8 +4925,8 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLRecentMeUrl {
     QString url;
     quint32 userId = 0;
     quint32 chatId = 0;
-    TLChatInvite chatInvite;
-    TLStickerSetCovered set;
+    TLPtr<TLChatInvite> chatInvite;
+    TLPtr<TLStickerSetCovered> set;
     TLValue tlType = TLValue::RecentMeUrlUnknown;
 };
 
@@ -5012,13 +5044,13 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLMessageMedia {
     QString lastName;
     quint32 userId = 0;
     TLDocument document;
-    TLWebPage webpage;
+    TLPtr<TLWebPage> webpage;
     QString title;
     QString address;
     QString provider;
     QString venueId;
     QString venueType;
-    TLGame game;
+    TLPtr<TLGame> game;
     QString description;
     TLWebDocument webDocumentPhoto;
     quint32 receiptMsgId = 0;
@@ -5074,13 +5106,13 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLMessage {
     quint32 replyToMsgId = 0;
     quint32 date = 0;
     QString message;
-    TLMessageMedia media;
+    TLPtr<TLMessageMedia> media;
     TLReplyMarkup replyMarkup;
     TLVector<TLMessageEntity> entities;
     quint32 views = 0;
     quint32 editDate = 0;
     QString postAuthor;
-    TLMessageAction action;
+    TLPtr<TLMessageAction> action;
     TLValue tlType = TLValue::MessageEmpty;
 };
 
@@ -5243,7 +5275,7 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
     bool popup() const { return flags & Popup; }
     bool masks() const { return flags & Masks; }
     bool pinned() const { return flags & Pinned; }
-    TLMessage message;
+    TLPtr<TLMessage> message;
     quint32 pts = 0;
     quint32 ptsCount = 0;
     quint32 quint32Id = 0;
@@ -5276,14 +5308,14 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
     quint32 inboxDate = 0;
     QString type;
     QString stringMessage;
-    TLMessageMedia media;
+    TLPtr<TLMessageMedia> media;
     TLVector<TLMessageEntity> entities;
     TLPrivacyKey key;
     TLVector<TLPrivacyRule> rules;
     QString phone;
     TLPeer peer;
     quint32 maxId = 0;
-    TLWebPage webpage;
+    TLPtr<TLWebPage> webpage;
     quint32 channelId = 0;
     quint32 views = 0;
     bool enabled = false;
@@ -5310,7 +5342,7 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
     QString shippingOptionId;
     QString currency;
     quint64 totalAmount = 0;
-    TLPhoneCall phoneCall;
+    TLPtr<TLPhoneCall> phoneCall;
     TLLangPackDifference difference;
     quint32 availableMinId = 0;
     TLValue tlType = TLValue::UpdateNewMessage;
@@ -5362,13 +5394,13 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdates {
     TLVector<TLMessageEntity> entities;
     quint32 fromId = 0;
     quint32 chatId = 0;
-    TLUpdate update;
+    TLPtr<TLUpdate> update;
     TLVector<TLUpdate> updates;
     TLVector<TLUser> users;
     TLVector<TLChat> chats;
     quint32 seqStart = 0;
     quint32 seq = 0;
-    TLMessageMedia media;
+    TLPtr<TLMessageMedia> media;
     TLValue tlType = TLValue::UpdatesTooLong;
 };
 
@@ -5467,9 +5499,9 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLChannelAdminLogEventAction {
     TLChatPhoto prevPhoto;
     TLChatPhoto newPhoto;
     bool boolNewValue = false;
-    TLMessage message;
-    TLMessage prevMessage;
-    TLMessage newMessage;
+    TLPtr<TLMessage> message;
+    TLPtr<TLMessage> prevMessage;
+    TLPtr<TLMessage> newMessage;
     TLChannelParticipant participant;
     TLChannelParticipant prevParticipant;
     TLChannelParticipant newParticipant;
@@ -5491,7 +5523,7 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLPaymentsPaymentResult {
             return false;
         };
     }
-    TLUpdates updates;
+    TLPtr<TLUpdates> updates;
     QString url;
     TLValue tlType = TLValue::PaymentsPaymentResult;
 };
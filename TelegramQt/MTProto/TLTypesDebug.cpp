@@ -5138,7 +5138,7 @@ QDebug operator<<(QDebug d, const TLChatInvite &type)
     switch (type.tlType) {
     case TLValue::ChatInviteAlready:
         d << "\n";
-        d << spacer.innerSpaces() << "chat: " << type.chat <<"\n";
+        d << spacer.innerSpaces() << "chat: " << *type.chat <<"\n";
         break;
     case TLValue::ChatInvite:
         d << "\n";
@@ -6204,7 +6204,7 @@ QDebug operator<<(QDebug d, const TLPageBlock &type)
         break;
     case TLValue::PageBlockChannel:
         d << "\n";
-        d << spacer.innerSpaces() << "channel: " << type.channel <<"\n";
+        d << spacer.innerSpaces() << "channel: " << *type.channel <<"\n";
         break;
     case TLValue::PageBlockAudio:
         d << "\n";
@@ -6701,12 +6701,12 @@ QDebug operator<<(QDebug d, const TLRecentMeUrl &type)
     case TLValue::RecentMeUrlChatInvite:
         d << "\n";
         d << spacer.innerSpaces() << "url: " << type.url <<"\n";
-        d << spacer.innerSpaces() << "chatInvite: " << type.chatInvite <<"\n";
+        d << spacer.innerSpaces() << "chatInvite: " << *type.chatInvite <<"\n";
         break;
     case TLValue::RecentMeUrlStickerSet:
         d << "\n";
         d << spacer.innerSpaces() << "url: " << type.url <<"\n";
-        d << spacer.innerSpaces() << "set: " << type.set <<"\n";
+        d << spacer.innerSpaces() << "set: " << *type.set <<"\n";
         break;
     default:
         break;
@@ -6861,7 +6861,7 @@ QDebug operator<<(QDebug d, const TLMessageMedia &type)
         break;
     case TLValue::MessageMediaWebPage:
         d << "\n";
-        d << spacer.innerSpaces() << "webpage: " << type.webpage <<"\n";
+        d << spacer.innerSpaces() << "webpage: " << *type.webpage <<"\n";
         break;
     case TLValue::MessageMediaVenue:
         d << "\n";
@@ -6874,7 +6874,7 @@ QDebug operator<<(QDebug d, const TLMessageMedia &type)
         break;
     case TLValue::MessageMediaGame:
         d << "\n";
-        d << spacer.innerSpaces() << "game: " << type.game <<"\n";
+        d << spacer.innerSpaces() << "game: " << *type.game <<"\n";
         break;
     case TLValue::MessageMediaInvoice:
         d << "\n";
@@ -6937,7 +6937,7 @@ QDebug operator<<(QDebug d, const TLMessage &type)
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
         d << spacer.innerSpaces() << "message: " << type.message <<"\n";
         if (type.flags & 1 << 9) {
-            d << spacer.innerSpaces() << "media: " << type.media <<"\n";
+            d << spacer.innerSpaces() << "media: " << *type.media <<"\n";
         }
         if (type.flags & 1 << 6) {
             d << spacer.innerSpaces() << "replyMarkup: " << type.replyMarkup <<"\n";
@@ -6968,7 +6968,7 @@ QDebug operator<<(QDebug d, const TLMessage &type)
             d << spacer.innerSpaces() << "replyToMsgId: " << type.replyToMsgId <<"\n";
         }
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
-        d << spacer.innerSpaces() << "action: " << type.action <<"\n";
+        d << spacer.innerSpaces() << "action: " << *type.action <<"\n";
         break;
     default:
         break;
@@ -7084,7 +7084,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
     case TLValue::UpdateEditChannelMessage:
     case TLValue::UpdateEditMessage:
         d << "\n";
-        d << spacer.innerSpaces() << "message: " << type.message <<"\n";
+        d << spacer.innerSpaces() << "message: " << *type.message <<"\n";
         d << spacer.innerSpaces() << "pts: " << type.pts <<"\n";
         d << spacer.innerSpaces() << "ptsCount: " << type.ptsCount <<"\n";
         break;
@@ -7202,7 +7202,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         }
         d << spacer.innerSpaces() << "type: " << type.type <<"\n";
         d << spacer.innerSpaces() << "stringMessage: " << type.stringMessage <<"\n";
-        d << spacer.innerSpaces() << "media: " << type.media <<"\n";
+        d << spacer.innerSpaces() << "media: " << *type.media <<"\n";
         d << spacer.innerSpaces() << "entities: " << type.entities <<"\n";
         break;
     case TLValue::UpdatePrivacy:
@@ -7225,7 +7225,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdateWebPage:
         d << "\n";
-        d << spacer.innerSpaces() << "webpage: " << type.webpage <<"\n";
+        d << spacer.innerSpaces() << "webpage: " << *type.webpage <<"\n";
         d << spacer.innerSpaces() << "pts: " << type.pts <<"\n";
         d << spacer.innerSpaces() << "ptsCount: " << type.ptsCount <<"\n";
         break;
@@ -7360,7 +7360,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
     case TLValue::UpdateChannelWebPage:
         d << "\n";
         d << spacer.innerSpaces() << "channelId: " << type.channelId <<"\n";
-        d << spacer.innerSpaces() << "webpage: " << type.webpage <<"\n";
+        d << spacer.innerSpaces() << "webpage: " << *type.webpage <<"\n";
         d << spacer.innerSpaces() << "pts: " << type.pts <<"\n";
         d << spacer.innerSpaces() << "ptsCount: " << type.ptsCount <<"\n";
         break;
@@ -7411,7 +7411,7 @@ QDebug operator<<(QDebug d, const TLUpdate &type)
         break;
     case TLValue::UpdatePhoneCall:
         d << "\n";
-        d << spacer.innerSpaces() << "phoneCall: " << type.phoneCall <<"\n";
+        d << spacer.innerSpaces() << "phoneCall: " << *type.phoneCall <<"\n";
         break;
     case TLValue::UpdateLangPack:
         d << "\n";
@@ -7494,7 +7494,7 @@ QDebug operator<<(QDebug d, const TLUpdates &type)
         break;
     case TLValue::UpdateShort:
         d << "\n";
-        d << spacer.innerSpaces() << "update: " << type.update <<"\n";
+        d << spacer.innerSpaces() << "update: " << *type.update <<"\n";
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
         break;
     case TLValue::UpdatesCombined:
@@ -7523,7 +7523,7 @@ QDebug operator<<(QDebug d, const TLUpdates &type)
         d << spacer.innerSpaces() << "ptsCount: " << type.ptsCount <<"\n";
         d << spacer.innerSpaces() << "date: " << type.date <<"\n";
         if (type.flags & 1 << 9) {
-            d << spacer.innerSpaces() << "media: " << type.media <<"\n";
+            d << spacer.innerSpaces() << "media: " << *type.media <<"\n";
         }
         if (type.flags & 1 << 7) {
             d << spacer.innerSpaces() << "entities: " << type.entities <<"\n";
@@ -7661,12 +7661,12 @@ QDebug operator<<(QDebug d, const TLChannelAdminLogEventAction &type)
     case TLValue::ChannelAdminLogEventActionUpdatePinned:
     case TLValue::ChannelAdminLogEventActionDeleteMessage:
         d << "\n";
-        d << spacer.innerSpaces() << "message: " << type.message <<"\n";
+        d << spacer.innerSpaces() << "message: " << *type.message <<"\n";
         break;
     case TLValue::ChannelAdminLogEventActionEditMessage:
         d << "\n";
-        d << spacer.innerSpaces() << "prevMessage: " << type.prevMessage <<"\n";
-        d << spacer.innerSpaces() << "newMessage: " << type.newMessage <<"\n";
+        d << spacer.innerSpaces() << "prevMessage: " << *type.prevMessage <<"\n";
+        d << spacer.innerSpaces() << "newMessage: " << *type.newMessage <<"\n";
         break;
     case TLValue::ChannelAdminLogEventActionParticipantJoin:
     case TLValue::ChannelAdminLogEventActionParticipantLeave:
@@ -7704,7 +7704,7 @@ QDebug operator<<(QDebug d, const TLPaymentsPaymentResult &type)
     switch (type.tlType) {
     case TLValue::PaymentsPaymentResult:
         d << "\n";
-        d << spacer.innerSpaces() << "updates: " << type.updates <<"\n";
+        d << spacer.innerSpaces() << "updates: " << *type.updates <<"\n";
         break;
     case TLValue::PaymentsPaymentVerficationNeeded:
         d << "\n";
@@ -27,15 +27,33 @@ PendingRpcOperation::~PendingRpcOperation()
     }
 }
 
+QByteArray PendingRpcOperation::replyData() const
+{
+    if ((m_replyOffset == 0) && (m_replySize == m_replyData.size())) {
+        return m_replyData;
+    }
+    return m_replyData.mid(m_replyOffset, m_replySize);
+}
+
 void PendingRpcOperation::setFinishedWithReplyData(const QByteArray &data)
 {
-    m_replyData = data;
-    TLValue answerValue = TLValue::firstFromArray(data);
+    setFinishedWithReplyData(data, 0, data.size());
+}
+
+void PendingRpcOperation::setFinishedWithReplyData(const QByteArray &buffer, int offset, int size)
+{
+    m_replyData = buffer;
+    m_replyOffset = offset;
+    m_replySize = size;
+    TLValue answerValue;
+    if (size >= 4) {
+        answerValue = TLValue::firstFromArray(QByteArray::fromRawData(buffer.constData() + offset, size));
+    }
     if (answerValue == TLValue::RpcError) {
         if (!m_error) {
             m_error = new RpcError();
         }
-        RawStreamEx stream(data);
+        RawStreamEx stream(buffer, offset, size);
         stream >> *m_error;
         setFinishedWithError({
                                  {QStringLiteral("RpcRequestType"), TLValue::firstFromArray(m_requestData).toString() },
@@ -50,6 +68,8 @@ void PendingRpcOperation::setFinishedWithReplyData(const QByteArray &data)
 void PendingRpcOperation::clearResult()
 {
     m_replyData.clear();
+    m_replyOffset = 0;
+    m_replySize = 0;
     m_contentRelated = true;
     if (m_error) {
         delete m_error;
@@ -10,7 +10,7 @@ class BaseConnection;
 
 namespace Client {
 
-class PendingRpcOperation : public PendingOperation
+class TELEGRAMQT_INTERNAL_EXPORT PendingRpcOperation : public PendingOperation
 {
     Q_OBJECT
 public:
@@ -20,9 +20,25 @@ public:
 
     bool isContentRelated() const { return m_contentRelated; }
     void setContentRelated(bool related) { m_contentRelated = related; }
+
+    // The RpcLayer sends the requests of a higher priority first
+    enum class Priority : quint8 {
+        Interactive,
+        Normal,
+        Bulk,
+        Default, // Chosen by the RpcLayer for the request method
+    };
+    Priority priority() const { return m_priority; }
+    void setPriority(Priority priority) { m_priority = priority; }
+
     QByteArray requestData() const { return m_requestData; }
-    QByteArray replyData() const { return m_replyData; }
+    // The reply is kept as a span of the received packet data, so replyData() copies a part of it
+    QByteArray replyData() const;
+    const QByteArray &replyBuffer() const { return m_replyData; }
+    int replyOffset() const { return m_replyOffset; }
+    int replySize() const { return m_replySize; }
     void setFinishedWithReplyData(const QByteArray &data);
+    void setFinishedWithReplyData(const QByteArray &buffer, int offset, int size);
     void clearResult() override;
     void reuse(const QByteArray &requestData);
 
@@ -40,10 +56,13 @@ protected:
 
     // The class is private, don't care about ABI
     QByteArray m_replyData;
+    int m_replyOffset = 0;
+    int m_replySize = 0;
     QByteArray m_requestData;
     RpcError *m_error = nullptr;
     BaseConnection *m_connection = nullptr;
     bool m_contentRelated = true;
+    Priority m_priority = Priority::Default;
 };
 
 } // Client namespace
@@ -19,20 +19,48 @@
 #include "AbridgedLength.hpp"
 
 #include <QIODevice>
-#include <QBuffer>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TELEGRAMQT_USE_SSE2
+#include <emmintrin.h>
+#endif
 
 static const char s_nulls[4] = { 0, 0, 0, 0 };
 
+// Widens the ASCII input into the UTF-16 output in the same pass as the check.
+// Returns false on the first non-ASCII byte (the output is partially written then).
+static bool widenAscii(ushort *output, const char *input, int size)
+{
+    int i = 0;
+#ifdef TELEGRAMQT_USE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        if (_mm_movemask_epi8(chunk)) {
+            return false;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i + 8), _mm_unpackhi_epi8(chunk, zero));
+    }
+#endif
+    for (; i < size; ++i) {
+        const uchar c = static_cast<uchar>(input[i]);
+        if (c >= 0x80) {
+            return false;
+        }
+        output[i] = c;
+    }
+    return true;
+}
+
 namespace Telegram {
 
-RawStream::RawStream(QByteArray *data, bool write) :
-    m_ownDevice(true)
+RawStream::RawStream(QByteArray *data, bool write)
 {
-    setDevice(new QBuffer(data));
     if (write) {
-        m_device->open(QIODevice::Append);
+        m_writeBuffer = data;
     } else {
-        m_device->open(QIODevice::ReadOnly);
+        setData(*data);
     }
 }
 
@@ -41,16 +69,18 @@ RawStream::RawStream(const QByteArray &data)
     setData(data);
 }
 
-RawStream::RawStream(Mode m, quint32 reserveBytes) :
-    m_ownDevice(true)
+RawStream::RawStream(const QByteArray &data, int offset, int size)
+{
+    setData(data, offset, size);
+}
+
+RawStream::RawStream(Mode m, quint32 reserveBytes)
 {
     Q_UNUSED(m)
-    QBuffer *buffer = new QBuffer();
     if (reserveBytes) {
-        buffer->buffer().reserve(static_cast<int>(reserveBytes));
+        m_data.reserve(static_cast<int>(reserveBytes));
     }
-    setDevice(buffer);
-    m_device->open(QIODevice::WriteOnly);
+    m_writeBuffer = &m_data;
 }
 
 RawStream::RawStream(QIODevice *d)
@@ -60,38 +90,50 @@ RawStream::RawStream(QIODevice *d)
 
 RawStream::~RawStream()
 {
-    if (m_device && m_ownDevice) {
-        delete m_device;
-    }
+}
+
+void RawStream::resetBackend()
+{
+    m_device = nullptr;
+    m_data.clear();
+    m_writeBuffer = nullptr;
+    m_readData = nullptr;
+    m_readSize = 0;
+    m_readPosition = 0;
 }
 
 void RawStream::setData(const QByteArray &data)
 {
-    QBuffer *buffer = new QBuffer();
-    buffer->setData(data);
-    setDevice(buffer);
-    m_device->open(QIODevice::ReadOnly);
-    m_ownDevice = true;
+    resetBackend();
+    // The data is implicitly shared, so the span stays valid for the stream lifetime
+    m_data = data;
+    m_readData = m_data.constData();
+    m_readSize = m_data.size();
+}
+
+void RawStream::setData(const QByteArray &data, int offset, int size)
+{
+    setData(data);
+    // The span is clamped to the data, so the reads past it fail as usual
+    const int begin = qBound(0, offset, m_readSize);
+    m_readData += begin;
+    m_readSize = qBound(0, size, m_readSize - begin);
 }
 
 QByteArray RawStream::getData() const
 {
-    if (m_ownDevice) {
-        QBuffer *buffer = static_cast<QBuffer*>(m_device);
-        return buffer->data();
+    if (m_writeBuffer) {
+        return *m_writeBuffer;
     }
-    return QByteArray();
+    if (m_readData && (m_readSize != m_data.size())) {
+        return QByteArray(m_readData, m_readSize); // The span of the data
+    }
+    return m_data;
 }
 
 void RawStream::setDevice(QIODevice *newDevice)
 {
-    if (m_device) {
-        if (m_ownDevice) {
-            delete m_device;
-            m_ownDevice = false;
-        }
-    }
-
+    resetBackend();
     m_device = newDevice;
 }
 
@@ -102,32 +144,53 @@ void RawStream::unsetDevice()
 
 bool RawStream::atEnd() const
 {
+    if (m_readData) {
+        return m_readPosition >= m_readSize;
+    }
     return m_device ? m_device->atEnd() : true;
 }
 
 int RawStream::bytesAvailable() const
 {
+    if (m_readData) {
+        return m_readSize - m_readPosition;
+    }
     return m_device ? static_cast<int>(m_device->bytesAvailable()) : 0;
 }
 
 bool RawStream::writeBytes(const QByteArray &data)
 {
-    m_error = m_error || m_device->write(data) != data.size();
-    return m_error;
+    return write(data.constData(), data.size());
 }
 
 bool RawStream::read(void *data, qint64 size)
 {
-    if (size) {
-        m_error = m_error || m_device->read(static_cast<char *>(data), size) != size;
+    if (!size || m_error) {
+        return m_error;
+    }
+    if (m_readData) {
+        if (m_readSize - m_readPosition < size) {
+            m_readPosition = m_readSize;
+            m_error = true;
+        } else {
+            memcpy(data, m_readData + m_readPosition, static_cast<size_t>(size));
+            m_readPosition += static_cast<int>(size);
+        }
+    } else {
+        m_error = !m_device || m_device->read(static_cast<char *>(data), size) != size;
     }
     return m_error;
 }
 
 bool RawStream::write(const void *data, qint64 size)
 {
-    if (size) {
-        m_error = m_error || m_device->write(static_cast<const char *>(data), size) != size;
+    if (!size || m_error) {
+        return m_error;
+    }
+    if (m_writeBuffer) {
+        m_writeBuffer->append(static_cast<const char *>(data), static_cast<int>(size));
+    } else {
+        m_error = !m_device || m_device->write(static_cast<const char *>(data), size) != size;
     }
     return m_error;
 }
@@ -139,75 +202,67 @@ void RawStream::setError(bool error)
 
 QByteArray RawStream::readBytes(int count)
 {
+    if (m_readData) {
+        const int available = qMin(count, m_readSize - m_readPosition);
+        QByteArray result;
+        if ((m_readData + m_readPosition == m_data.constData()) && (available == m_data.size())) {
+            result = m_data;
+        } else if (available > 0) {
+            if (m_bytesSharing) {
+                result = QByteArray::fromRawData(m_readData + m_readPosition, available);
+            } else {
+                result = QByteArray(m_readData + m_readPosition, available);
+            }
+        }
+        m_readPosition += qMax(available, 0);
+        m_error = m_error || available != count;
+        return result;
+    }
+    if (!m_device) {
+        m_error = m_error || count != 0;
+        return QByteArray();
+    }
     QByteArray result = m_device->read(count);
     m_error = m_error || result.size() != count;
     return result;
 }
 
-RawStream &RawStream::operator>>(qint8 &i)
+void RawStream::readUtf8(QString *str, int size)
 {
-    return protectedRead(i);
-}
-
-RawStream &RawStream::operator>>(qint16 &i)
-{
-    return protectedRead(i);
-}
-
-RawStream &RawStream::operator>>(qint32 &i)
-{
-    return protectedRead(i);
-}
-
-RawStream &RawStream::operator>>(qint64 &i)
-{
-    return protectedRead(i);
-}
-
-template<typename Int>
-RawStream &RawStream::protectedRead(Int &i)
-{
-    read(&i, sizeof(Int));
-    return *this;
-}
-
-RawStream &RawStream::operator<<(qint8 i)
-{
-    return protectedWrite(i);
-}
-
-RawStream &RawStream::operator<<(qint16 i)
-{
-    return protectedWrite(i);
-}
-
-RawStream &RawStream::operator<<(qint32 i)
-{
-    return protectedWrite(i);
-}
-
-RawStream &RawStream::operator<<(qint64 i)
-{
-    return protectedWrite(i);
-}
-
-template<typename Int>
-RawStream &RawStream::protectedWrite(Int i)
-{
-    write(&i, sizeof(Int));
-    return *this;
-}
-
-RawStream &RawStream::operator>>(double &d)
-{
-    read(&d, 8);
-    return *this;
+    if (m_readData && !m_error && (size >= 0) && (m_readSize - m_readPosition >= size)) {
+        const char *input = m_readData + m_readPosition;
+        m_readPosition += size;
+        // Most of the strings (names, usernames, links) are ASCII
+        str->resize(size);
+        if (!widenAscii(reinterpret_cast<ushort *>(str->data()), input, size)) {
+            *str = QString::fromUtf8(input, size);
+        }
+        return;
+    }
+    *str = QString::fromUtf8(readBytes(size));
 }
 
-RawStream &RawStream::operator<<(const double &d)
+void RawStream::skipBytes(int count)
 {
-    write(&d, 8);
-    return *this;
+    if (m_error || (count <= 0)) {
+        m_error = m_error || count < 0;
+        return;
+    }
+    if (m_readData) {
+        if (m_readSize - m_readPosition < count) {
+            m_readPosition = m_readSize;
+            m_error = true;
+        } else {
+            m_readPosition += count;
+        }
+        return;
+    }
+    if (!m_device) {
+        m_error = true;
+        return;
+    }
+    // QIODevice::skip() needs Qt 5.10
+    m_error = m_device->read(count).size() != count;
 }
 
 RawStream &RawStream::operator<<(const QByteArray &data)
@@ -244,12 +299,48 @@ RawStreamEx &RawStreamEx::operator>>(QByteArray &data)
 {
     Telegram::AbridgedLength length;
     *this >> length;
-    data.resize(static_cast<int>(length));
-    read(data.data(), data.size());
-    readBytes(length.paddingForAlignment(4));
+    // Check the length against the input before the allocation, so a malformed
+    // length fails fast instead of allocating up to 16 Mb
+    if (Q_UNLIKELY(error() || (static_cast<quint32>(length) > static_cast<quint32>(bytesAvailable())))) {
+        setError(true);
+        data.clear();
+        return *this;
+    }
+    if (isBytesSharingEnabled()) {
+        data = readBytes(static_cast<int>(length));
+    } else {
+        data.resize(static_cast<int>(length));
+        read(data.data(), data.size());
+    }
+    char padding[4];
+    read(padding, length.paddingForAlignment(4));
     return *this;
 }
 
+void RawStreamEx::skipByteArray()
+{
+    Telegram::AbridgedLength length;
+    *this >> length;
+    if (Q_UNLIKELY(error() || (static_cast<quint32>(length) > static_cast<quint32>(bytesAvailable())))) {
+        setError(true);
+        return;
+    }
+    skipBytes(static_cast<int>(length) + length.paddingForAlignment(4));
+}
+
+void RawStreamEx::readString(QString &str)
+{
+    Telegram::AbridgedLength length;
+    *this >> length;
+    if (Q_UNLIKELY(error() || (static_cast<quint32>(length) > static_cast<quint32>(bytesAvailable())))) {
+        setError(true);
+        str.clear();
+        return;
+    }
+    readUtf8(&str, static_cast<int>(length));
+    skipBytes(length.paddingForAlignment(4));
+}
+
 RawStreamEx &RawStreamEx::operator<<(const QByteArray &data)
 {
     Telegram::AbridgedLength length(static_cast<quint32>(data.size()));
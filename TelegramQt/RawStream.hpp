@@ -21,6 +21,7 @@
 #include "telegramqt_global.h"
 
 #include <QByteArray>
+#include <QString>
 
 QT_FORWARD_DECLARE_CLASS(QIODevice)
 
@@ -28,6 +29,9 @@ namespace Telegram {
 
 class AbridgedLength;
 
+// The stream works on a memory span (reading), on a growable buffer (writing)
+// or on a QIODevice (e.g. a file). The fixed-size values of the in-memory modes
+// are read and written inline, without the QIODevice virtual calls.
 class TELEGRAMQT_INTERNAL_EXPORT RawStream
 {
 public:
@@ -36,6 +40,8 @@ public:
     };
     explicit RawStream(QByteArray *data, bool write);
     explicit RawStream(const QByteArray &data);
+    // Reads the size bytes at the offset of the data (without a copy)
+    explicit RawStream(const QByteArray &data, int offset, int size);
     explicit RawStream(Mode mode, quint32 reserveBytes = 0);
     explicit RawStream(QIODevice *d = nullptr);
 
@@ -43,6 +49,7 @@ public:
 
     QByteArray getData() const;
     void setData(const QByteArray &data);
+    void setData(const QByteArray &data, int offset, int size);
     QIODevice *device() const { return m_device; }
     void setDevice(QIODevice *newDevice);
     void unsetDevice();
@@ -50,11 +57,21 @@ public:
     bool error() const { return m_error; }
     void resetError();
 
+    // In the bytes sharing mode the bytes values read from the in-memory stream
+    // reference the stream data (via QByteArray::fromRawData()) instead of a copy.
+    // The caller must keep the data given to the stream alive and unchanged while
+    // the values are in use. A modification of such value detaches it.
+    bool isBytesSharingEnabled() const { return m_bytesSharing; }
+    void setBytesSharingEnabled(bool enabled) { m_bytesSharing = enabled; }
+
     bool atEnd() const;
     int bytesAvailable() const;
+    // The read position in the data of the in-memory stream
+    int position() const { return m_readPosition; }
 
     bool writeBytes(const QByteArray &bytes);
     QByteArray readBytes(int count);
+    void skipBytes(int count);
 
     QByteArray readAll();
 
@@ -94,10 +111,29 @@ protected:
 
     void setError(bool error);
 
+    // Decodes the UTF-8 data right from the input span
+    void readUtf8(QString *str, int size);
+
+    // The whole data of the in-memory stream and the offset of the input span in it
+    const QByteArray &spanData() const { return m_data; }
+    int spanOffset() const { return m_readData ? static_cast<int>(m_readData - m_data.constData()) : 0; }
+
 private:
+    void resetBackend();
+
     QIODevice *m_device = nullptr;
-    bool m_ownDevice = false;
+
+    // The source of the span reader or the own buffer of the writer
+    QByteArray m_data;
+    // The buffer of the writer (m_data or an external one)
+    QByteArray *m_writeBuffer = nullptr;
+    // The span reader
+    const char *m_readData = nullptr;
+    int m_readSize = 0;
+    int m_readPosition = 0;
+
     bool m_error = false;
+    bool m_bytesSharing = false;
 
 };
 
@@ -110,6 +146,10 @@ public:
 
     RawStreamEx &operator>>(QByteArray &data);
     RawStreamEx &operator<<(const QByteArray &data);
+    // Advances past an encoded bytes (or string) value without a copy
+    void skipByteArray();
+    // Reads an encoded string without the intermediate QByteArray
+    void readString(QString &str);
 
     RawStreamEx &operator>>(Telegram::AbridgedLength &data);
     RawStreamEx &operator<<(const Telegram::AbridgedLength &data);
@@ -125,44 +165,117 @@ inline QByteArray RawStream::readAll()
     return readBytes(bytesAvailable());
 }
 
+template<typename Int>
+inline RawStream &RawStream::protectedRead(Int &i)
+{
+    if (Q_LIKELY(m_readData && !m_error && (m_readSize - m_readPosition >= int(sizeof(Int))))) {
+        memcpy(&i, m_readData + m_readPosition, sizeof(Int));
+        m_readPosition += int(sizeof(Int));
+    } else {
+        read(&i, sizeof(Int));
+    }
+    return *this;
+}
+
+template<typename Int>
+inline RawStream &RawStream::protectedWrite(Int i)
+{
+    if (Q_LIKELY(m_writeBuffer && !m_error)) {
+        m_writeBuffer->append(reinterpret_cast<const char *>(&i), int(sizeof(Int)));
+    } else {
+        write(&i, sizeof(Int));
+    }
+    return *this;
+}
+
+inline RawStream &RawStream::operator>>(qint8 &i)
+{
+    return protectedRead(i);
+}
+
+inline RawStream &RawStream::operator>>(qint16 &i)
+{
+    return protectedRead(i);
+}
+
+inline RawStream &RawStream::operator>>(qint32 &i)
+{
+    return protectedRead(i);
+}
+
+inline RawStream &RawStream::operator>>(qint64 &i)
+{
+    return protectedRead(i);
+}
+
 inline RawStream &RawStream::operator>>(quint8 &i)
 {
-    return *this >> reinterpret_cast<qint8&>(i);
+    return protectedRead(i);
 }
 
 inline RawStream &RawStream::operator>>(quint16 &i)
 {
-    return *this >> reinterpret_cast<qint16&>(i);
+    return protectedRead(i);
 }
 
 inline RawStream &RawStream::operator>>(quint32 &i)
 {
-    return *this >> reinterpret_cast<qint32&>(i);
+    return protectedRead(i);
 }
 
 inline RawStream &RawStream::operator>>(quint64 &i)
 {
-    return *this >> reinterpret_cast<qint64&>(i);
+    return protectedRead(i);
+}
+
+inline RawStream &RawStream::operator>>(double &d)
+{
+    return protectedRead(d);
+}
+
+inline RawStream &RawStream::operator<<(qint8 i)
+{
+    return protectedWrite(i);
+}
+
+inline RawStream &RawStream::operator<<(qint16 i)
+{
+    return protectedWrite(i);
+}
+
+inline RawStream &RawStream::operator<<(qint32 i)
+{
+    return protectedWrite(i);
+}
+
+inline RawStream &RawStream::operator<<(qint64 i)
+{
+    return protectedWrite(i);
 }
 
 inline RawStream &RawStream::operator<<(quint8 i)
 {
-    return *this << qint8(i);
+    return protectedWrite(i);
 }
 
 inline RawStream &RawStream::operator<<(quint16 i)
 {
-    return *this << qint16(i);
+    return protectedWrite(i);
 }
 
 inline RawStream &RawStream::operator<<(quint32 i)
 {
-    return *this << qint32(i);
+    return protectedWrite(i);
 }
 
 inline RawStream &RawStream::operator<<(quint64 i)
 {
-    return *this << qint64(i);
+    return protectedWrite(i);
+}
+
+inline RawStream &RawStream::operator<<(const double &d)
+{
+    return protectedWrite(d);
 }
 
 } // Telegram namespace
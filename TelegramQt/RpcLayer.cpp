@@ -31,14 +31,46 @@
 
 #include <QLoggingCategory>
 
+#include <openssl/sha.h>
+
+#include <initializer_list>
+
 Q_LOGGING_CATEGORY(c_baseRpcLayerCategory, "telegram.base.rpclayer", QtWarningMsg)
 Q_LOGGING_CATEGORY(c_baseRpcLayerCategoryIn, "telegram.base.rpclayer.in", QtWarningMsg)
 Q_LOGGING_CATEGORY(c_baseRpcLayerCategoryOut, "telegram.base.rpclayer.out", QtWarningMsg)
 
 namespace Telegram {
 
+namespace {
+
+struct ByteSpan {
+    const char *data;
+    int size;
+};
+
+} // anonymous namespace
+
+// The same bytes as QByteArray::mid(offset, size) returns, but without a copy
+static ByteSpan getByteSpan(const QByteArray &array, int offset, int size)
+{
+    const int available = qBound(0, array.size() - offset, size);
+    return { available ? array.constData() + offset : nullptr, available };
+}
+
+// Streaming SHA-256 of the concatenated parts, written to a 32 bytes output
+static void sha256(std::initializer_list<ByteSpan> parts, uchar *output)
+{
+    SHA256_CTX context;
+    SHA256_Init(&context);
+    for (const ByteSpan &part : parts) {
+        SHA256_Update(&context, part.data, static_cast<size_t>(part.size));
+    }
+    SHA256_Final(output, &context);
+}
+
 BaseRpcLayer::BaseRpcLayer(QObject *parent) :
-    QObject(parent)
+    QObject(parent),
+    m_compressionLevel(Utils::c_gzipDefaultCompressionLevel)
 {
 }
 
@@ -47,7 +79,28 @@ void BaseRpcLayer::setSendHelper(BaseMTProtoSendHelper *helper)
     m_sendHelper = helper;
 }
 
+BaseRpcLayer::CryptoContext BaseRpcLayer::cryptoContext() const
+{
+    CryptoContext context;
+    context.authKey = m_sendHelper->authKey();
+    context.authId = m_sendHelper->authId();
+    context.outgoingDirection = outgoingDirection();
+    context.incomingDirection = context.outgoingDirection == ClientToServer ? ServerToClient : ClientToServer;
+    return context;
+}
+
 bool BaseRpcLayer::processPacket(const QByteArray &package)
+{
+    MTProto::FullMessageHeader messageHeader;
+    MTProto::Message message;
+    if (!decryptPacket(cryptoContext(), package, &messageHeader, &message)) {
+        return false;
+    }
+    return processDecryptedMessage(messageHeader, message);
+}
+
+bool BaseRpcLayer::decryptPacket(const CryptoContext &context, const QByteArray &package,
+                                 MTProto::FullMessageHeader *header, MTProto::Message *message)
 {
     if (package.size() < 24) {
         qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO
@@ -60,31 +113,32 @@ bool BaseRpcLayer::processPacket(const QByteArray &package)
 #ifdef BASE_RPC_IO_DEBUG
     const quint64 *authKeyIdBytes = reinterpret_cast<const quint64*>(package.constData());
 #endif
-    const QByteArray messageKey = package.mid(8, 16);
-    const QByteArray encryptedData = package.mid(24);
-    const Crypto::AesKey key = getDecryptionAesKey(messageKey);
-    const QByteArray decryptedData = Crypto::aesDecrypt(encryptedData, key).left(encryptedData.length());
+    const char *messageKey = package.constData() + 8;
+    // The only copy of the encrypted data; it is decrypted in place
+    QByteArray decryptedData = package.mid(24);
+    const Crypto::AesKey key = generateAesKey(context.authKey, messageKey, context.incomingDirection);
+#ifdef BASE_RPC_IO_DEBUG
+    qCDebug(c_baseRpcLayerCategoryIn) << "encryptedData:" << decryptedData.toHex();
+#endif
+    if (!Crypto::aesIgeDecrypt(decryptedData.data(), decryptedData.size(), key)) {
+        qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Unable to decrypt the packet";
+        return false;
+    }
 #ifdef BASE_RPC_IO_DEBUG
     qCDebug(c_baseRpcLayerCategoryIn) << "authKeyId:" << hex << showbase << *authKeyIdBytes;
-    qCDebug(c_baseRpcLayerCategoryIn) << "messageKey:" << messageKey.toHex();
-    qCDebug(c_baseRpcLayerCategoryIn) << "encryptedData:" << encryptedData.toHex();
+    qCDebug(c_baseRpcLayerCategoryIn) << "messageKey:" << QByteArray(messageKey, MessageKeySize).toHex();
     qCDebug(c_baseRpcLayerCategoryIn) << "decryptedData:" << decryptedData.toHex();
 #endif
     RawStream decryptedStream(decryptedData);
 
-    MTProto::FullMessageHeader messageHeader;
+    MTProto::FullMessageHeader &messageHeader = *header;
     decryptedStream >> messageHeader;
 
 #ifdef DEVELOPER_BUILD
     qCDebug(c_baseRpcLayerCategoryIn) << CALL_INFO << messageHeader;
 #endif
 
-    if (!processMessageHeader(messageHeader)) {
-        qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Unable to process message header";
-        return false;
-    }
-
-    if (int(messageHeader.contentLength) > decryptedStream.bytesAvailable()) {
+    if (messageHeader.contentLength > static_cast<quint32>(decryptedStream.bytesAvailable())) {
         qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Expected more data than actually available."
                                             << "Actual:" << decryptedStream.bytesAvailable()
                                             << "Expected:" << messageHeader.contentLength;
@@ -93,53 +147,89 @@ bool BaseRpcLayer::processPacket(const QByteArray &package)
 #ifdef USE_MTProto_V1
     QByteArray expectedMessageKey = Utils::sha1(
                 decryptedData.left(MTProto::FullMessageHeader::headerLength + messageHeader.contentLength)).mid(4);
+    const bool messageKeyIsValid = memcmp(messageKey, expectedMessageKey.constData(), MessageKeySize) == 0;
 #else // MTProto_V2
-    QByteArray expectedMessageKey = Utils::sha256(getVerificationKeyPart() + decryptedData).mid(8, 16);
+    char expectedMessageKey[MessageKeySize];
+    getMessageKey(context.authKey, context.incomingDirection,
+                  decryptedData.constData(), decryptedData.size(), expectedMessageKey);
+    const bool messageKeyIsValid = memcmp(messageKey, expectedMessageKey, MessageKeySize) == 0;
 #endif
 
-    if (messageKey != expectedMessageKey) {
+    if (!messageKeyIsValid) {
         qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Invalid message key";
         return false;
     }
 
-    QByteArray innerData = decryptedStream.readBytes(messageHeader.contentLength);
-    if (decryptedStream.error()) {
-        qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Decrypted content read error";
-        return false;
+    // The message references the content in the decrypted data
+    *message = MTProto::Message(messageHeader, decryptedData, decryptedStream.position(),
+                                static_cast<int>(messageHeader.contentLength));
+    unpackMessage(message);
+    return true;
+}
+
+void BaseRpcLayer::unpackMessage(MTProto::Message *message)
+{
+    if (message->firstValue() != TLValue::GzipPacked) {
+        return;
     }
-    MTProto::Message message(messageHeader, innerData);
-    if (message.firstValue() == TLValue::GzipPacked) {
-        qCDebug(c_baseRpcLayerCategoryIn) << CALL_INFO << "message is GzipPacked";
-        QByteArray data;
-        MTProto::Stream packedStream(innerData);
-        TLValue gzipValue;
-        packedStream >> gzipValue;
-        packedStream >> data;
-        data = Utils::unpackGZip(data);
-        message.setData(data);
+    qCDebug(c_baseRpcLayerCategoryIn) << CALL_INFO << "message is GzipPacked";
+    QByteArray data;
+    MTProto::Stream packedStream(message->data, message->dataOffset, message->dataSize);
+    packedStream.setBytesSharingEnabled(true); // The packed bytes are needed only for the unpacking
+    TLValue gzipValue;
+    packedStream >> gzipValue;
+    packedStream >> data;
+    data = Utils::unpackGZip(data);
+    message->setData(data);
+}
+
+bool BaseRpcLayer::processDecryptedMessage(const MTProto::FullMessageHeader &header, const MTProto::Message &message)
+{
+    if (!processMessageHeader(header)) {
+        qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Unable to process message header";
+        return false;
     }
     return processMTProtoMessage(message);
 }
 
-Crypto::AesKey BaseRpcLayer::generateAesKey(const QByteArray &messageKey, int x) const
+Crypto::AesKey BaseRpcLayer::generateAesKey(const QByteArray &authKey, const char *messageKey, int x)
 {
-    const QByteArray authKey = m_sendHelper->authKey();
 #ifdef USE_MTProto_V1
-    QByteArray sha1_a = Utils::sha1(messageKey + authKey.mid(x, 32));
-    QByteArray sha1_b = Utils::sha1(authKey.mid(32 + x, 16) + messageKey + authKey.mid(48 + x, 16));
-    QByteArray sha1_c = Utils::sha1(authKey.mid(64 + x, 32) + messageKey);
-    QByteArray sha1_d = Utils::sha1(messageKey + authKey.mid(96 + x, 32));
+    const QByteArray msgKey = QByteArray::fromRawData(messageKey, MessageKeySize);
+    QByteArray sha1_a = Utils::sha1(msgKey + authKey.mid(x, 32));
+    QByteArray sha1_b = Utils::sha1(authKey.mid(32 + x, 16) + msgKey + authKey.mid(48 + x, 16));
+    QByteArray sha1_c = Utils::sha1(authKey.mid(64 + x, 32) + msgKey);
+    QByteArray sha1_d = Utils::sha1(msgKey + authKey.mid(96 + x, 32));
 
     const QByteArray key = sha1_a.mid(0, 8) + sha1_b.mid(8, 12) + sha1_c.mid(4, 12);
     const QByteArray iv  = sha1_a.mid(8, 12) + sha1_b.left(8) + sha1_c.mid(16, 4) + sha1_d.left(8);
+    return Crypto::AesKey(key, iv);
 #else // MTProto_V2
-    QByteArray sha256_a = Utils::sha256(messageKey + authKey.mid(x, 36));
-    QByteArray sha256_b = Utils::sha256(authKey.mid(40 + x, 36) + messageKey);
-    const QByteArray key = sha256_a.left(8) + sha256_b.mid(8, 16) + sha256_a.mid(24, 8);
-    const QByteArray iv  = sha256_b.left(8) + sha256_a.mid(8, 16) + sha256_b.mid(24, 8);
+    const ByteSpan messageKeySpan = { messageKey, MessageKeySize };
+    uchar sha256_a[SHA256_DIGEST_LENGTH];
+    uchar sha256_b[SHA256_DIGEST_LENGTH];
+    sha256({ messageKeySpan, getByteSpan(authKey, x, 36) }, sha256_a);
+    sha256({ getByteSpan(authKey, 40 + x, 36), messageKeySpan }, sha256_b);
+
+    Crypto::AesKey result;
+    // key = sha256_a[0:8] + sha256_b[8:24] + sha256_a[24:32]
+    memcpy(result.key, sha256_a, 8);
+    memcpy(result.key + 8, sha256_b + 8, 16);
+    memcpy(result.key + 24, sha256_a + 24, 8);
+    // iv = sha256_b[0:8] + sha256_a[8:24] + sha256_b[24:32]
+    memcpy(result.iv, sha256_b, 8);
+    memcpy(result.iv + 8, sha256_a + 8, 16);
+    memcpy(result.iv + 24, sha256_b + 24, 8);
+    return result;
 #endif
+}
 
-    return Crypto::AesKey(key, iv);
+void BaseRpcLayer::getMessageKey(const QByteArray &authKey, int x, const char *data, int size, char *messageKey)
+{
+    // msg_key = SHA256(authKey[88+x:120+x] + plaintext)[8:24]
+    uchar digest[SHA256_DIGEST_LENGTH];
+    sha256({ getByteSpan(authKey, 88 + x, 32), ByteSpan { data, size } }, digest);
+    memcpy(messageKey, digest + 8, MessageKeySize);
 }
 
 quint32 BaseRpcLayer::contentRelatedMessagesNumber() const
@@ -147,6 +237,11 @@ quint32 BaseRpcLayer::contentRelatedMessagesNumber() const
     return m_contentRelatedMessages;
 }
 
+void BaseRpcLayer::setCompressionLevel(int level)
+{
+    m_compressionLevel = qBound(0, level, 9); // From no compression to the best compression
+}
+
 quint32 BaseRpcLayer::getNextMessageSequenceNumber(MessageType messageType)
 {
     // https://core.telegram.org/mtproto/description#message-sequence-number-msg-seqno
@@ -160,65 +255,86 @@ quint32 BaseRpcLayer::getNextMessageSequenceNumber(MessageType messageType)
 
 bool BaseRpcLayer::sendPacket(const MTProto::Message &message)
 {
-    if (!m_sendHelper->authId()) {
+    const QByteArray packet = encryptPacket(cryptoContext(), message, serverSalt(), sessionId());
+    if (packet.isEmpty()) {
+        return false;
+    }
+    m_sendHelper->sendPacket(packet);
+    return true;
+}
+
+QByteArray BaseRpcLayer::encryptPacket(const CryptoContext &context, const MTProto::Message &message,
+                                       quint64 serverSalt, quint64 sessionId)
+{
+    Crypto::AesKey key;
+    QByteArray packet = preparePacket(context, message, serverSalt, sessionId, &key);
+    if (packet.isEmpty()) {
+        return QByteArray();
+    }
+    // Encrypt the data in place, after the auth key id and the message key
+    if (!Crypto::aesIgeEncrypt(packet.data() + EncryptedDataOffset,
+                               packet.size() - EncryptedDataOffset, key)) {
+        qCWarning(c_baseRpcLayerCategoryOut) << CALL_INFO << "Unable to encrypt the packet";
+        return QByteArray();
+    }
+    return packet;
+}
+
+QByteArray BaseRpcLayer::preparePacket(const CryptoContext &context, const MTProto::Message &message,
+                                       quint64 serverSalt, quint64 sessionId, Crypto::AesKey *key)
+{
+    if (!context.authId) {
         qCCritical(c_baseRpcLayerCategoryOut) << CALL_INFO << "Auth key is not set!";
-        return 0;
+        return QByteArray();
     }
-    QByteArray encryptedPackage;
-    QByteArray messageKey;
+    char messageKey[MessageKeySize];
     constexpr int c_alignment = 16;
     constexpr int c_v2_minimumPadding = 12;
-    {
-        const MTProto::FullMessageHeader messageHeader(message, serverSalt(), sessionId());
+    // The message can be a span of a bigger buffer; only the content goes to the packet
+    MTProto::FullMessageHeader messageHeader(message, serverSalt, sessionId);
+    messageHeader.contentLength = static_cast<quint32>(message.dataSize);
 #ifdef DEVELOPER_BUILD
-        qCDebug(c_baseRpcLayerCategoryOut) << "RpcLayer::sendPackage():" << messageHeader;
+    qCDebug(c_baseRpcLayerCategoryOut) << "RpcLayer::sendPackage():" << messageHeader;
 #endif
-        RawStream stream(RawStream::WriteOnly);
-        stream << messageHeader;
-        stream.writeBytes(message.data);
+    const int packageLength = MTProto::FullMessageHeader::headerLength + message.dataSize;
+    int padding = AbridgedLength::paddingForAlignment(c_alignment, packageLength);
+#ifndef USE_MTProto_V1
+    if (padding < c_v2_minimumPadding) {
+        padding += c_alignment;
+    }
+#endif
+    const int encryptedLength = packageLength + padding;
 
-        int packageLength = stream.getData().length();
-        int padding = AbridgedLength::paddingForAlignment(c_alignment, packageLength);
+    // The packet is written once into a buffer of the exact size:
+    // keyId, messageKey (filled in below), header, data and random padding
+    QByteArray packet;
+    packet.reserve(EncryptedDataOffset + encryptedLength);
+    {
+        RawStream output(&packet, /* write */ true);
+        output << context.authId; // keyId
+        output << quint64(0) << quint64(0); // messageKey
+        output << messageHeader;
+        output.writeBytes(QByteArray::fromRawData(message.contentData(), message.dataSize));
+    }
+    packet.resize(EncryptedDataOffset + encryptedLength);
+    RandomGenerator::instance()->generate(packet.data() + EncryptedDataOffset + packageLength, padding);
+
+    const char *decryptedData = packet.constData() + EncryptedDataOffset;
 #ifdef USE_MTProto_V1
-        if (padding) {
-            QByteArray randomPadding(padding, Qt::Uninitialized);
-             RandomGenerator::instance()->generate(&randomPadding);
-            stream << randomPadding;
-            packageLength += padding;
-        }
-        const QByteArray data = stream.getData();
-        messageKey = Utils::sha1(data).mid(4);
+    memcpy(messageKey, Utils::sha1(QByteArray::fromRawData(decryptedData, encryptedLength)).constData() + 4, MessageKeySize);
 #else // MTProto_V2
-        if (padding < c_v2_minimumPadding) {
-            padding += c_alignment;
-        }
-        {
-            QByteArray randomPadding(padding, Qt::Uninitialized);
-            RandomGenerator::instance()->generate(&randomPadding);
-            stream << randomPadding;
-            packageLength += padding;
-        }
-        const QByteArray decryptedData = stream.getData();
-        messageKey = Utils::sha256(getEncryptionKeyPart() + decryptedData).mid(8, 16);
+    getMessageKey(context.authKey, context.outgoingDirection, decryptedData, encryptedLength, messageKey);
 #endif
-        const Crypto::AesKey key = getEncryptionAesKey(messageKey);
-        encryptedPackage = Crypto::aesEncrypt(decryptedData, key).left(packageLength);
+    memcpy(packet.data() + sizeof(context.authId), messageKey, MessageKeySize);
+    *key = generateAesKey(context.authKey, messageKey, context.outgoingDirection);
 
 #ifdef BASE_RPC_IO_DEBUG
-        qCDebug(c_baseRpcLayerCategoryOut) << "authKeyId:"
-                                           << hex << showbase << m_sendHelper->authId();
-        qCDebug(c_baseRpcLayerCategoryOut) << "messageKey:" << messageKey.toHex();
-        qCDebug(c_baseRpcLayerCategoryOut) << "encryptedData:" << encryptedPackage.toHex();
-        qCDebug(c_baseRpcLayerCategoryOut) << "decryptedData:" << decryptedData.toHex();
+    qCDebug(c_baseRpcLayerCategoryOut) << "authKeyId:"
+                                       << hex << showbase << context.authId;
+    qCDebug(c_baseRpcLayerCategoryOut) << "messageKey:" << QByteArray(messageKey, MessageKeySize).toHex();
+    qCDebug(c_baseRpcLayerCategoryOut) << "decryptedData:" << packet.mid(EncryptedDataOffset).toHex();
 #endif
-    }
-
-    RawStream output(RawStream::WriteOnly);
-    output << m_sendHelper->authId(); // keyId
-    output << messageKey;
-    output << encryptedPackage;
-    m_sendHelper->sendPacket(output.getData());
-    return true;
+    return packet;
 }
 
 static QLatin1String getModeText(SendMode mode)
@@ -235,24 +351,31 @@ static QLatin1String getModeText(SendMode mode)
     return QLatin1String("Invalid");
 }
 
-quint64 BaseRpcLayer::sendPacket(const QByteArray &buffer, SendMode mode, MessageType messageType)
+quint64 BaseRpcLayer::prepareMessage(MTProto::Message *message, SendMode mode, MessageType messageType)
 {
-    MTProto::Message message;
-    message.setData(buffer);
-
     if (!m_sendHelper->authId()) {
         qCCritical(c_baseRpcLayerCategoryOut) << CALL_INFO
                                               << "Auth key is not set!";
         return 0;
     }
-    message.messageId = m_sendHelper->newMessageId(mode);
-    message.sequenceNumber = getNextMessageSequenceNumber(messageType);
+    message->messageId = m_sendHelper->newMessageId(mode);
+    message->sequenceNumber = getNextMessageSequenceNumber(messageType);
 
     qCDebug(c_baseRpcLayerCategoryOut) << CALL_INFO
             << "(" << getModeText(mode) << "):"
-            << "message" << message.firstValue()
-            << "with id" << message.messageId;
+            << "message" << message->firstValue()
+            << "with id" << message->messageId;
+    return message->messageId;
+}
+
+quint64 BaseRpcLayer::sendPacket(const QByteArray &buffer, SendMode mode, MessageType messageType)
+{
+    MTProto::Message message;
+    message.setData(buffer);
 
+    if (!prepareMessage(&message, mode, messageType)) {
+        return 0;
+    }
     if (!sendPacket(message)) {
         return 0;
     }
@@ -263,7 +386,7 @@ bool BaseRpcLayer::processMsgContainer(const MTProto::Message &message)
 {
     // https://core.telegram.org/mtproto/service_messages#simple-container
     quint32 itemsCount;
-    RawStream stream(message.data);
+    RawStream stream(message.data, message.dataOffset, message.dataSize);
     stream >> itemsCount;
     qCDebug(c_baseRpcLayerCategoryIn) << CALL_INFO << itemsCount << "items";
 
@@ -271,8 +394,15 @@ bool BaseRpcLayer::processMsgContainer(const MTProto::Message &message)
     for (quint32 i = 0; i < itemsCount; ++i) {
         MTProto::MessageHeader header;
         stream >> header;
-        QByteArray innerData = stream.readBytes(header.contentLength);
-        MTProto::Message innerMessage(header, innerData);
+        if (stream.error() || (header.contentLength > static_cast<quint32>(stream.bytesAvailable()))) {
+            qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Unexpected end of the container";
+            return false;
+        }
+        // The inner message references the container data
+        const int innerSize = static_cast<int>(header.contentLength);
+        MTProto::Message innerMessage(header, message.data, message.dataOffset + stream.position(), innerSize);
+        stream.skipBytes(innerSize);
+        unpackMessage(&innerMessage);
 
         // There is no break and the 'processed' variable goes last,
         // so we process next messages even if something fails.
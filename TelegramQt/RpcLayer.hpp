@@ -47,12 +47,48 @@ public:
     };
     explicit BaseRpcLayer(QObject *parent = nullptr);
 
+    static constexpr int MessageKeySize = 16;
+
+    // MTProto 2.0 auth key offsets ("x") of the message directions
+    enum MessageDirection {
+        ClientToServer = 0,
+        ServerToClient = 8,
+    };
+
+    // The keys of the packet crypto; the auth key data is implicitly shared (not copied)
+    struct CryptoContext {
+        QByteArray authKey;
+        quint64 authId = 0;
+        MessageDirection outgoingDirection = ClientToServer;
+        MessageDirection incomingDirection = ServerToClient;
+    };
+
     virtual quint64 sessionId() const = 0;
     virtual quint64 serverSalt() const = 0;
     quint32 contentRelatedMessagesNumber() const;
     void setSendHelper(BaseMTProtoSendHelper *helper);
 
-    bool processPacket(const QByteArray &package);
+    CryptoContext cryptoContext() const;
+
+    // The zlib level (0-9) of the outgoing gzip_packed data
+    int compressionLevel() const { return m_compressionLevel; }
+    void setCompressionLevel(int level);
+
+    // The crypto and compression stages of the packets processing.
+    // The stages use only the arguments, so they can run in any thread.
+    static bool decryptPacket(const CryptoContext &context, const QByteArray &package,
+                              MTProto::FullMessageHeader *header, MTProto::Message *message);
+    static QByteArray encryptPacket(const CryptoContext &context, const MTProto::Message &message,
+                                    quint64 serverSalt, quint64 sessionId);
+
+    // The encryptPacket() without the AES step: the returned packet is plain after
+    // EncryptedDataOffset and the key encrypts it in place (e.g. in a batch of packets)
+    static QByteArray preparePacket(const CryptoContext &context, const MTProto::Message &message,
+                                    quint64 serverSalt, quint64 sessionId, Crypto::AesKey *key);
+    static constexpr int EncryptedDataOffset = 24;
+
+    virtual bool processPacket(const QByteArray &package);
+    bool processDecryptedMessage(const MTProto::FullMessageHeader &header, const MTProto::Message &message);
     virtual bool processMessageHeader(const MTProto::FullMessageHeader &header) = 0;
     virtual bool processMTProtoMessage(const MTProto::Message &message) = 0;
 
@@ -61,22 +97,23 @@ public:
     virtual void onConnectionLost(const QVariantHash &details);
 
 protected:
-    Crypto::AesKey generateAesKey(const QByteArray &messageKey, int x) const;
-    Crypto::AesKey generateClientToServerAesKey(const QByteArray &messageKey) const { return generateAesKey(messageKey, 0); }
-    Crypto::AesKey generateServerToClientAesKey(const QByteArray &messageKey) const { return generateAesKey(messageKey, 8); }
-    virtual Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const = 0;
-    virtual Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const = 0;
-
-    virtual QByteArray getEncryptionKeyPart() const = 0;
-    virtual QByteArray getVerificationKeyPart() const = 0;
+    virtual MessageDirection outgoingDirection() const = 0;
+
+    static Crypto::AesKey generateAesKey(const QByteArray &authKey, const char *messageKey, int x);
+    static void getMessageKey(const QByteArray &authKey, int x, const char *data, int size, char *messageKey);
+    static void unpackMessage(MTProto::Message *message); // Replaces gzip_packed data with the unpacked one
     quint32 getNextMessageSequenceNumber(MessageType messageType);
 
-    bool sendPacket(const MTProto::Message &message);
+    // Assigns the message id and the sequence number; returns the message id or 0 on failure
+    quint64 prepareMessage(MTProto::Message *message, SendMode mode, MessageType messageType);
+
+    virtual bool sendPacket(const MTProto::Message &message);
     quint64 sendPacket(const QByteArray &buffer, SendMode mode, MessageType messageType);
 
     BaseMTProtoSendHelper *m_sendHelper = nullptr;
     quint32 m_sequenceNumber = 0;
     quint32 m_contentRelatedMessages = 0;
+    int m_compressionLevel;
 };
 
 } // Telegram namespace
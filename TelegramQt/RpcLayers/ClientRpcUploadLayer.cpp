@@ -35,6 +35,9 @@ template bool BaseRpcLayerExtension::processReply(PendingRpcOperation *operation
 template bool BaseRpcLayerExtension::processReply(PendingRpcOperation *operation, TLUploadWebFile *output);
 // End of generated Telegram API reply template specializations
 
+// Used to avoid the copy of the downloaded file chunks
+template bool BaseRpcLayerExtension::processReplySharingBytes(PendingRpcOperation *operation, TLUploadFile *output);
+
 UploadRpcLayer::UploadRpcLayer(QObject *parent) :
     BaseRpcLayerExtension(parent)
 {
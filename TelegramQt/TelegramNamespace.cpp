@@ -528,7 +528,7 @@ QString MessageMediaInfo::url() const
     if (d->tlType != TLValue::MessageMediaWebPage) {
         return QString();
     }
-    return d->webpage.url;
+    return d->webpage->url;
 }
 
 QString MessageMediaInfo::displayUrl() const
@@ -536,7 +536,7 @@ QString MessageMediaInfo::displayUrl() const
     if (d->tlType != TLValue::MessageMediaWebPage) {
         return QString();
     }
-    return d->webpage.displayUrl;
+    return d->webpage->displayUrl;
 }
 
 QString MessageMediaInfo::siteName() const
@@ -545,7 +545,7 @@ QString MessageMediaInfo::siteName() const
         return QString();
     }
 
-    return d->webpage.siteName;
+    return d->webpage->siteName;
 }
 
 QString MessageMediaInfo::title() const
@@ -554,7 +554,7 @@ QString MessageMediaInfo::title() const
         return QString();
     }
 
-    return d->webpage.title;
+    return d->webpage->title;
 }
 
 QString MessageMediaInfo::description() const
@@ -563,7 +563,7 @@ QString MessageMediaInfo::description() const
         return QString();
     }
 
-    return d->webpage.description;
+    return d->webpage->description;
 }
 
 Telegram::FileInfo::Private FileInfo::Private::fromFileId(const QString &fileId)
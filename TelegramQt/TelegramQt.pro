@@ -77,6 +77,7 @@ SOURCES += \
     CClientTcpTransport.cpp \
     TelegramNamespace.cpp \
     LegacySecretReader.cpp \
+    LoopbackTransport.cpp \
     MessagingApi.cpp \
     PendingOperation.cpp \
     PendingRpcOperation.cpp \
@@ -162,6 +163,7 @@ HEADERS += \
     TLNumbers.hpp \
     crypto-rsa.hpp \
     LegacySecretReader.hpp \
+    LoopbackTransport.hpp \
     PendingOperation.hpp \
     PendingOperation_p.hpp \
     PendingRpcOperation.hpp \
@@ -180,14 +182,20 @@ include(Operations/operations.pri)
 SOURCES += \
     MTProto/CTelegramStream.cpp \
     MTProto/CTelegramStreamExtraOperators.cpp \
+    MTProto/DecodeArena.cpp \
     MTProto/MessageHeader.cpp \
+    MTProto/SerializedSize.cpp \
+    MTProto/StreamSkip.cpp \
     MTProto/TLValues.cpp \
 
 HEADERS += \
     MTProto/CTelegramStream.hpp \
     MTProto/CTelegramStreamExtraOperators.hpp \
     MTProto/CTelegramStream_p.hpp \
+    MTProto/DecodeArena.hpp \
+    MTProto/LazyVector.hpp \
     MTProto/MessageHeader.hpp \
+    MTProto/SerializedSize.hpp \
     MTProto/Stream.hpp \
     MTProto/TLValues.hpp \
 
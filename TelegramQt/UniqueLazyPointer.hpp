@@ -73,10 +73,11 @@ struct UniqueLazyPointer
     constexpr operator bool() const { return data; }
     constexpr bool isNull() const { return !data; }
 
+    // Const access to a null pointer yields a default-constructed value
+    // so the lazily allocated members read the same way as plain ones.
     const TL &operator*() const
     {
-        Q_ASSERT(data);
-        return *data;
+        return data ? *data : defaultValue();
     }
 
     TL &operator*()
@@ -88,8 +89,7 @@ struct UniqueLazyPointer
     }
     const TL *operator->() const
     {
-        Q_ASSERT(data);
-        return data;
+        return data ? data : &defaultValue();
     }
     TL *operator->()
     {
@@ -107,6 +107,12 @@ protected:
         delete data;
         data = nullptr;
     }
+
+    static const TL &defaultValue()
+    {
+        static const TL value;
+        return value;
+    }
 };
 
 } // Telegram namespace
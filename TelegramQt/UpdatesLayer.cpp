@@ -49,20 +49,20 @@ bool UpdatesInternalApi::processUpdates(const TLUpdates &updates)
         // Reconstruct full update from this short update.
         TLUpdate update;
 
-        if (update.message.toId.channelId) {
+        if (update.message->toId.channelId) {
             update.tlType = TLValue::UpdateNewChannelMessage;
         } else {
             update.tlType = TLValue::UpdateNewMessage;
         }
         update.pts = updates.pts;
         update.ptsCount = updates.ptsCount;
-        TLMessage &shortMessage = update.message;
+        TLMessage &shortMessage = *update.message;
         shortMessage.tlType = TLValue::Message;
         shortMessage.id = updates.id;
         shortMessage.flags = updates.flags;
         shortMessage.message = updates.message;
         shortMessage.date = updates.date;
-        shortMessage.media.tlType = TLValue::MessageMediaEmpty;
+        shortMessage.media->tlType = TLValue::MessageMediaEmpty;
         shortMessage.fwdFrom = updates.fwdFrom;
         shortMessage.replyToMsgId = updates.replyToMsgId;
 
@@ -87,7 +87,7 @@ bool UpdatesInternalApi::processUpdates(const TLUpdates &updates)
     }
         break;
     case TLValue::UpdateShort:
-        processUpdate(updates.update);
+        processUpdate(*updates.update);
         break;
     case TLValue::UpdatesCombined:
         internal->processData(updates.users);
@@ -149,8 +149,8 @@ bool UpdatesInternalApi::processUpdate(const TLUpdate &update)
         return true;
     case TLValue::UpdateNewMessage:
     case TLValue::UpdateNewChannelMessage:
-        if (dataInternalApi()->processNewMessage(update.message, update.pts)) {
-            messagingApi()->onMessageReceived(update.message);
+        if (dataInternalApi()->processNewMessage(*update.message, update.pts)) {
+            messagingApi()->onMessageReceived(*update.message);
         }
         return true;
     case TLValue::UpdateReadHistoryInbox:
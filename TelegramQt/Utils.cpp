@@ -23,6 +23,7 @@
 #include <QCryptographicHash>
 #include <QDebug>
 #include <QFileInfo>
+#include <QtEndian>
 
 #include "RandomGenerator.hpp"
 
@@ -134,38 +135,119 @@ QByteArray Utils::binaryNumberModExp(const QByteArray &data, const QByteArray &m
     return resultNum.toByteArray();
 }
 
-QByteArray Utils::packGZip(const QByteArray &data)
+namespace {
+
+// The uncompressed size from the gzip trailer is not trusted: it only presizes the output
+constexpr quint32 c_gzipMaxSizeHint = 16 * 1024 * 1024;
+constexpr quint32 c_deflateMaxRatio = 1032;
+
+// deflateInit2() allocates about 256 Kb (and inflateInit2() about 7 Kb plus the
+// window on the first use), so each thread keeps the zlib streams for the reuse
+class GZipContext
 {
-    z_stream stream;
-    stream.zalloc = nullptr;
-    stream.zfree = nullptr;
-    stream.opaque = nullptr;
-    stream.avail_in = static_cast<uInt>(data.size());
-    stream.next_in = reinterpret_cast<z_const Bytef*>(data.constData());
-
-    constexpr int compressionLevel = 6; // It seems that Telegram uses this compression level
-    int deflateResult = deflateInit2(&stream,
-                                     compressionLevel,
-                                     Z_DEFLATED,
-                                     MAX_WBITS + 16, // (8 to 15) + 16 for gzip
-                                     MAX_MEM_LEVEL,
-                                     Z_DEFAULT_STRATEGY);
-    if (deflateResult != Z_OK) {
-        return QByteArray(); // deflate init failed
+public:
+    ~GZipContext()
+    {
+        if (m_deflateReady) {
+            deflateEnd(&m_deflate);
+        }
+        if (m_inflateReady) {
+            inflateEnd(&m_inflate);
+        }
+    }
+
+    z_stream *deflateStream(int compressionLevel)
+    {
+        if (!m_deflateReady) {
+            m_deflate = z_stream();
+            const int result = deflateInit2(&m_deflate,
+                                            compressionLevel,
+                                            Z_DEFLATED,
+                                            MAX_WBITS + 16, // (8 to 15) + 16 for gzip
+                                            MAX_MEM_LEVEL,
+                                            Z_DEFAULT_STRATEGY);
+            if (result != Z_OK) {
+                return nullptr;
+            }
+            m_deflateReady = true;
+            m_compressionLevel = compressionLevel;
+            return &m_deflate;
+        }
+        if (deflateReset(&m_deflate) != Z_OK) {
+            return nullptr;
+        }
+        if (m_compressionLevel != compressionLevel) {
+            // There is no pending input after the reset, so the change takes effect right away
+            if (deflateParams(&m_deflate, compressionLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+                return nullptr;
+            }
+            m_compressionLevel = compressionLevel;
+        }
+        return &m_deflate;
+    }
+
+    z_stream *inflateStream()
+    {
+        if (!m_inflateReady) {
+            m_inflate = z_stream();
+            if (inflateInit2(&m_inflate, MAX_WBITS + 32) != Z_OK) { // gzip decoding
+                return nullptr;
+            }
+            m_inflateReady = true;
+            return &m_inflate;
+        }
+        if (inflateReset(&m_inflate) != Z_OK) {
+            return nullptr;
+        }
+        return &m_inflate;
     }
 
-    char buffer[c_gzipBufferSize];
-    QByteArray result;
+private:
+    z_stream m_deflate;
+    z_stream m_inflate;
+    int m_compressionLevel = 0;
+    bool m_deflateReady = false;
+    bool m_inflateReady = false;
+};
 
-    do {
-        stream.avail_out = c_gzipBufferSize;
-        stream.next_out = reinterpret_cast<Bytef*>(buffer);
-        deflate(&stream, Z_FINISH); // Z_FINISH
-        result.append(buffer, static_cast<int>(c_gzipBufferSize - stream.avail_out));
-    } while (stream.avail_out == 0);
+thread_local GZipContext s_gzipContext;
 
-    deflateEnd(&stream);
+// Grows the output by a half of the current size (at least by the buffer size)
+void growOutput(QByteArray *output, z_stream *stream)
+{
+    const int used = output->size() - static_cast<int>(stream->avail_out);
+    output->resize(output->size() + qMax(output->size() / 2, static_cast<int>(Utils::c_gzipBufferSize)));
+    stream->next_out = reinterpret_cast<Bytef*>(output->data()) + used;
+    stream->avail_out = static_cast<uInt>(output->size() - used);
+}
+
+} // namespace
 
+QByteArray Utils::packGZip(const QByteArray &data, int compressionLevel)
+{
+    z_stream *stream = s_gzipContext.deflateStream(compressionLevel);
+    if (!stream) {
+        return QByteArray(); // deflate init failed
+    }
+    stream->avail_in = static_cast<uInt>(data.size());
+    stream->next_in = reinterpret_cast<z_const Bytef*>(data.constData());
+
+    // The output is compressed right into the result of the worst case size
+    QByteArray result(static_cast<int>(deflateBound(stream, static_cast<uLong>(data.size()))), Qt::Uninitialized);
+    stream->avail_out = static_cast<uInt>(result.size());
+    stream->next_out = reinterpret_cast<Bytef*>(result.data());
+
+    int deflateResult = deflate(stream, Z_FINISH);
+    while ((deflateResult == Z_OK) || (deflateResult == Z_BUF_ERROR && stream->avail_out == 0)) {
+        // Should not happen with the bound size, but the old zlib versions
+        // underestimate the gzip wrapper
+        growOutput(&result, stream);
+        deflateResult = deflate(stream, Z_FINISH);
+    }
+    if (deflateResult != Z_STREAM_END) {
+        return QByteArray();
+    }
+    result.resize(static_cast<int>(stream->total_out));
     return result;
 }
 
@@ -176,40 +258,35 @@ QByteArray Utils::unpackGZip(const QByteArray &data)
         return QByteArray();
     }
 
-    z_stream stream;
-    stream.zalloc = nullptr;
-    stream.zfree = nullptr;
-    stream.opaque = nullptr;
-    stream.avail_in = static_cast<uInt>(data.size());
-    stream.next_in = reinterpret_cast<z_const Bytef*>(data.constData());
-
-    int inflateResult = inflateInit2(&stream, MAX_WBITS + 32); // gzip decoding
-    if (inflateResult != Z_OK) {
+    z_stream *stream = s_gzipContext.inflateStream();
+    if (!stream) {
         return QByteArray(); // inflate init failed
     }
+    stream->avail_in = static_cast<uInt>(data.size());
+    stream->next_in = reinterpret_cast<z_const Bytef*>(data.constData());
 
-    char buffer[c_gzipBufferSize];
-    QByteArray result;
-
-    do {
-        stream.avail_out = c_gzipBufferSize;
-        stream.next_out = reinterpret_cast<Bytef*>(buffer);
-        inflateResult = inflate(&stream, Z_NO_FLUSH);
-        switch (inflateResult) {
-        case Z_NEED_DICT:
-        case Z_DATA_ERROR:
-        case Z_MEM_ERROR:
-        case Z_STREAM_ERROR:
-            inflateEnd(&stream);
-            return QByteArray();
-        default:
-            break;
-        }
-        result.append(buffer, static_cast<int>(c_gzipBufferSize - stream.avail_out));
-    } while (stream.avail_out == 0);
+    // The gzip trailer ends with the uncompressed size (modulo 2^32)
+    quint32 sizeHint = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(data.constData() + data.size() - 4));
+    sizeHint = qMin(sizeHint, qMin(c_gzipMaxSizeHint, static_cast<quint32>(data.size()) * c_deflateMaxRatio));
 
-    inflateEnd(&stream);
+    QByteArray result(static_cast<int>(sizeHint), Qt::Uninitialized);
+    stream->avail_out = static_cast<uInt>(result.size());
+    stream->next_out = reinterpret_cast<Bytef*>(result.data());
 
+    forever {
+        const int inflateResult = inflate(stream, Z_NO_FLUSH);
+        if (inflateResult == Z_STREAM_END) {
+            break;
+        }
+        if ((inflateResult != Z_OK) && (inflateResult != Z_BUF_ERROR)) {
+            return QByteArray(); // Z_NEED_DICT, Z_DATA_ERROR, Z_MEM_ERROR or Z_STREAM_ERROR
+        }
+        if (stream->avail_out != 0) {
+            break; // The input is truncated; return the decoded part
+        }
+        growOutput(&result, stream);
+    }
+    result.resize(static_cast<int>(stream->total_out));
     return result;
 }
 
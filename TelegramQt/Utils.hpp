@@ -38,10 +38,13 @@ TELEGRAMQT_INTERNAL_EXPORT QByteArray sha256(const QByteArray &data);
 TELEGRAMQT_INTERNAL_EXPORT quint64 getFingerprints(const QByteArray &data, const BitsOrder64 order);
 TELEGRAMQT_INTERNAL_EXPORT QByteArray binaryNumberModExp(const QByteArray &data, const QByteArray &mod, const QByteArray &exp);
 TELEGRAMQT_INTERNAL_EXPORT QByteArray rsa(const QByteArray &data, const Telegram::RsaKey &key);
-TELEGRAMQT_INTERNAL_EXPORT QByteArray packGZip(const QByteArray &data);
-TELEGRAMQT_INTERNAL_EXPORT QByteArray unpackGZip(const QByteArray &data);
 
 constexpr quint32 c_gzipBufferSize = 1024;
+constexpr int c_gzipDefaultCompressionLevel = 6; // It seems that Telegram uses this compression level
+
+// The zlib streams are reused by the calls from the same thread
+TELEGRAMQT_INTERNAL_EXPORT QByteArray packGZip(const QByteArray &data, int compressionLevel = c_gzipDefaultCompressionLevel);
+TELEGRAMQT_INTERNAL_EXPORT QByteArray unpackGZip(const QByteArray &data);
 
 } // Utils
 
@@ -0,0 +1,344 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+// The fuzz target for the decoding of the top-level RPC result types.
+//
+// Built with libFuzzer (ENABLE_FUZZING) it provides LLVMFuzzerTestOneInput().
+// Otherwise it is a standalone program, which replays the given corpus files
+// or (without arguments) runs a deterministic set of mutations of valid values.
+// The first byte of an input selects the decoded type.
+//
+// A malformed input must not allocate far more memory than it contains, so both
+// builds run under a memory limit: pass -rss_limit_mb and -malloc_limit_mb to
+// libFuzzer (as the CMake test does), while the standalone program limits its
+// address space and decodes a large frame with a forged vector count.
+
+#include "MTProto/DecodeArena.hpp"
+#include "MTProto/Stream_p.hpp"
+#include "MTProto/StreamExtraOperators.hpp"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QDebug>
+
+#include <random>
+
+#ifdef Q_OS_LINUX
+#include <sys/resource.h>
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define TELEGRAMQT_SANITIZER_BUILD
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(memory_sanitizer)
+#define TELEGRAMQT_SANITIZER_BUILD
+#endif
+#endif
+
+using namespace Telegram;
+
+enum class DecodedType : quint8 {
+    Updates,
+    UpdatesDifference,
+    UpdatesChannelDifference,
+    MessagesMessages,
+    MessagesDialogs,
+    MessagesChats,
+    Users,
+    Config,
+    AuthAuthorization,
+    WebPage,
+    TypesCount
+};
+
+template <typename T>
+static void decode(const QByteArray &data)
+{
+    // The arena outlives the value and frees the pointer vector items
+    MTProto::DecodeArena arena;
+    T value;
+    MTProto::Stream stream(data);
+    stream.setArena(&arena);
+    stream >> value;
+}
+
+static void decodeInput(const char *data, int size)
+{
+    if (size < 1) {
+        return;
+    }
+    const QByteArray payload = QByteArray::fromRawData(data + 1, size - 1);
+    const int typesCount = static_cast<int>(DecodedType::TypesCount);
+    switch (static_cast<DecodedType>(static_cast<quint8>(data[0]) % typesCount)) {
+    case DecodedType::Updates:
+        decode<TLUpdates>(payload);
+        break;
+    case DecodedType::UpdatesDifference:
+        decode<TLUpdatesDifference>(payload);
+        break;
+    case DecodedType::UpdatesChannelDifference:
+        decode<TLUpdatesChannelDifference>(payload);
+        break;
+    case DecodedType::MessagesMessages:
+        decode<TLMessagesMessages>(payload);
+        break;
+    case DecodedType::MessagesDialogs:
+        decode<TLMessagesDialogs>(payload);
+        break;
+    case DecodedType::MessagesChats:
+        decode<TLMessagesChats>(payload);
+        break;
+    case DecodedType::Users:
+        decode<TLVector<TLUser>>(payload);
+        break;
+    case DecodedType::Config:
+        decode<TLConfig>(payload);
+        break;
+    case DecodedType::AuthAuthorization:
+        decode<TLAuthAuthorization>(payload);
+        break;
+    case DecodedType::WebPage:
+        decode<TLWebPage>(payload);
+        break;
+    case DecodedType::TypesCount:
+        break;
+    }
+}
+
+#ifdef TELEGRAMQT_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    decodeInput(reinterpret_cast<const char *>(data), static_cast<int>(size));
+    return 0;
+}
+
+#else // TELEGRAMQT_LIBFUZZER
+
+template <typename T>
+static QByteArray encode(DecodedType type, const T &value)
+{
+    QByteArray result;
+    {
+        MTProto::Stream stream(&result, /* write */ true);
+        stream << value;
+    }
+    result.prepend(static_cast<char>(type));
+    return result;
+}
+
+static TLUser getUser(quint32 id)
+{
+    TLUser user;
+    user.tlType = TLValue::User;
+    user.flags = TLUser::FirstName|TLUser::Username|TLUser::AccessHash;
+    user.id = id;
+    user.accessHash = 0x1234567890abcdefull;
+    user.firstName = QStringLiteral("User %1").arg(id);
+    user.username = QStringLiteral("user%1").arg(id);
+    return user;
+}
+
+static TLMessage getMessage(quint32 id)
+{
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.flags = TLMessage::FromId;
+    message.id = id;
+    message.fromId = id;
+    message.toId.tlType = TLValue::PeerUser;
+    message.toId.userId = 1;
+    message.date = 1500000000u + id;
+    message.message = QStringLiteral("Message text %1").arg(id);
+    return message;
+}
+
+static QVector<QByteArray> getSeeds()
+{
+    QVector<QByteArray> seeds;
+
+    TLUpdates updates;
+    updates.tlType = TLValue::Updates;
+    for (quint32 i = 1; i <= 4; ++i) {
+        TLUpdate update;
+        update.tlType = TLValue::UpdateNewMessage;
+        *update.message = getMessage(i);
+        update.pts = i;
+        update.ptsCount = 1;
+        updates.updates.append(update);
+        updates.users.append(getUser(i));
+    }
+    seeds.append(encode(DecodedType::Updates, updates));
+
+    TLMessagesMessages messages;
+    messages.tlType = TLValue::MessagesMessages;
+    for (quint32 i = 1; i <= 4; ++i) {
+        messages.messages.append(getMessage(i));
+        messages.users.append(getUser(i));
+    }
+    seeds.append(encode(DecodedType::MessagesMessages, messages));
+    seeds.append(encode(DecodedType::Users, messages.users));
+
+    TLRichText plainText;
+    plainText.tlType = TLValue::TextPlain;
+    plainText.stringText = QStringLiteral("Plain text");
+    TLPageBlock paragraph;
+    paragraph.tlType = TLValue::PageBlockParagraph;
+    *paragraph.text = plainText;
+    TLPageBlock list;
+    list.tlType = TLValue::PageBlockList;
+    list.richTextItemsVector = { &plainText, &plainText };
+    TLWebPage webPage;
+    webPage.tlType = TLValue::WebPage;
+    webPage.flags = TLWebPage::CachedPage;
+    webPage.url = QStringLiteral("https://example.com");
+    webPage.cachedPage.tlType = TLValue::PageFull;
+    webPage.cachedPage.blocks = { &paragraph, &list };
+    seeds.append(encode(DecodedType::WebPage, webPage));
+
+    seeds.append(encode(DecodedType::UpdatesDifference, TLUpdatesDifference()));
+    seeds.append(encode(DecodedType::UpdatesChannelDifference, TLUpdatesChannelDifference()));
+    seeds.append(encode(DecodedType::MessagesDialogs, TLMessagesDialogs()));
+    seeds.append(encode(DecodedType::MessagesChats, TLMessagesChats()));
+    seeds.append(encode(DecodedType::Config, TLConfig()));
+    seeds.append(encode(DecodedType::AuthAuthorization, TLAuthAuthorization()));
+
+    return seeds;
+}
+
+static QByteArray mutate(QByteArray data, std::mt19937 &random)
+{
+    // Values that usually appear in malformed lengths and counts
+    static const quint32 c_interestingWords[] = {
+        0xffffffffu, 0x7fffffffu, 0x10000000u, 0x00fffffeu, 0xfffffffeu, 0x1cb5c415u, 0u,
+    };
+    const int mutationsCount = static_cast<int>(random() % 4) + 1;
+    for (int i = 0; (i < mutationsCount) && (data.size() > 1); ++i) {
+        const int position = 1 + static_cast<int>(random() % static_cast<quint32>(data.size() - 1));
+        switch (random() % 4) {
+        case 0:
+            data[position] = static_cast<char>(data.at(position) ^ (1 << (random() % 8)));
+            break;
+        case 1:
+            if (position + 4 <= data.size()) {
+                const quint32 word = c_interestingWords[random() % (sizeof(c_interestingWords) / sizeof(quint32))];
+                memcpy(data.data() + position, &word, sizeof(word));
+            }
+            break;
+        case 2:
+            data.truncate(position);
+            break;
+        default:
+            data.insert(position, data.mid(position, static_cast<int>(random() % 16)));
+            break;
+        }
+    }
+    return data;
+}
+
+static void limitMemory()
+{
+#if defined(Q_OS_LINUX) && !defined(TELEGRAMQT_SANITIZER_BUILD)
+    // Far above the needs of the decoding, but below the reservation
+    // of a forged vector count in a big frame
+    const rlim_t c_addressSpaceLimit = 2048ull * 1024 * 1024;
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_AS, &limit) == 0) {
+        limit.rlim_cur = qMin(limit.rlim_max, c_addressSpaceLimit);
+        setrlimit(RLIMIT_AS, &limit);
+    }
+#endif
+}
+
+// A 16 MB frame with a vector count that fits into it; the items would take
+// more than 4 GB if the count were reserved at once
+static QByteArray getForgedVectorFrame()
+{
+    const quint32 declaredCount = 4 * 1024 * 1024 - 4;
+    QByteArray result;
+    {
+        MTProto::Stream stream(&result, /* write */ true);
+        stream << TLValue(TLValue::Updates);
+        stream << TLValue(TLValue::Vector);
+        stream << declaredCount;
+    }
+    result.append(QByteArray(static_cast<int>(declaredCount) * 4, char(0)));
+    result.prepend(static_cast<char>(DecodedType::Updates));
+    return result;
+}
+
+static int replayPath(const QString &path)
+{
+    const QFileInfo info(path);
+    QStringList files;
+    if (info.isDir()) {
+        const QDir dir(path);
+        for (const QString &fileName : dir.entryList(QDir::Files)) {
+            files.append(dir.filePath(fileName));
+        }
+    } else {
+        files.append(path);
+    }
+
+    for (const QString &fileName : files) {
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly)) {
+            qWarning() << "Unable to open" << fileName;
+            return 1;
+        }
+        const QByteArray data = file.readAll();
+        decodeInput(data.constData(), data.size());
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    limitMemory();
+    if (argc > 1) {
+        for (int i = 1; i < argc; ++i) {
+            if (replayPath(QString::fromLocal8Bit(argv[i]))) {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    const QVector<QByteArray> seeds = getSeeds();
+    std::mt19937 random(20190101u);
+    const int iterations = 20000;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (const QByteArray &seed : seeds) {
+        decodeInput(seed.constData(), seed.size());
+    }
+    {
+        const QByteArray frame = getForgedVectorFrame();
+        decodeInput(frame.constData(), frame.size());
+    }
+    for (int i = 0; i < iterations; ++i) {
+        const QByteArray input = mutate(seeds.at(static_cast<int>(random() % static_cast<quint32>(seeds.count()))), random);
+        decodeInput(input.constData(), input.size());
+    }
+    qInfo().nospace() << "Decoded " << iterations << " mutated inputs in " << timer.elapsed() << " ms";
+    return 0;
+}
+
+#endif // TELEGRAMQT_LIBFUZZER
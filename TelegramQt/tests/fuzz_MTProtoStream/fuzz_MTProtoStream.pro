@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = fuzz_MTProtoStream
+SOURCES = fuzz_MTProtoStream.cpp
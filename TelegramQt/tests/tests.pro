@@ -8,6 +8,7 @@ SUBDIRS += tst_UniqueLazyPointer
 SUBDIRS += tst_utils
 SUBDIRS += tst_RpcError
 SUBDIRS += tst_RpcLayer
+SUBDIRS += fuzz_MTProtoStream
 
 OTHER_FILES += \
     CMakeLists.txt
@@ -18,12 +18,45 @@
 #include <QObject>
 
 #include "ApiUtils.hpp"
+#include "CTcpTransport.hpp"
+#include "ConnectionError.hpp"
 #include "../utils/TestTransport.hpp"
 
 #include <QTest>
 #include <QDebug>
 
 #include <QDateTime>
+#include <QtEndian>
+
+class TestTcpTransport : public Telegram::BaseTcpTransport
+{
+public:
+    explicit TestTcpTransport(SessionType sessionType, QObject *parent = nullptr) :
+        BaseTcpTransport(parent)
+    {
+        setSessionType(sessionType);
+    }
+
+    using BaseTcpTransport::framePacket;
+
+    void connectToHost(const QString &, quint16) override { }
+
+    void feed(const QByteArray &data)
+    {
+        char *destination = allocateReadData(data.size());
+        memcpy(destination, data.constData(), static_cast<size_t>(data.size()));
+        readPackets();
+    }
+};
+
+// Make a payload that looks like an encrypted MTProto packet (non-zero auth key id,
+// the size is 24 + 16 * N), so the padded intermediate framing can restore its size
+static QByteArray makeEncryptedPayload(int blocksCount, char fill)
+{
+    QByteArray payload(24 + blocksCount * 16, fill);
+    payload[0] = char(1);
+    return payload;
+}
 
 class tst_CTelegramTransport : public QObject
 {
@@ -34,6 +67,11 @@ public:
 private slots:
     void testNewMessageId();
     void testNewMessageIdExtra();
+    void readFrames_data();
+    void readFrames();
+    void readPaddedErrorPacket();
+    void benchmarkReadFrames_data();
+    void benchmarkReadFrames();
 
 };
 
@@ -102,6 +140,126 @@ void tst_CTelegramTransport::testNewMessageIdExtra()
     }
 }
 
+void tst_CTelegramTransport::readFrames_data()
+{
+    QTest::addColumn<Telegram::BaseTcpTransport::SessionType>("sessionType");
+    QTest::newRow("Abridged") << Telegram::BaseTcpTransport::Abridged;
+    QTest::newRow("Intermediate") << Telegram::BaseTcpTransport::Intermediate;
+    QTest::newRow("Padded intermediate") << Telegram::BaseTcpTransport::PaddedIntermediate;
+}
+
+void tst_CTelegramTransport::readFrames()
+{
+    QFETCH(Telegram::BaseTcpTransport::SessionType, sessionType);
+
+    TestTcpTransport writer(sessionType);
+    QVector<QByteArray> payloads;
+    QByteArray stream;
+    for (int i = 0; i < 64; ++i) {
+        // Mix short (1 byte length) and long (4 bytes length) abridged frames
+        const int blocks = (i % 3 == 2) ? 32 + i : i;
+        const QByteArray payload = makeEncryptedPayload(blocks, char('a' + i % 26));
+        payloads.append(payload);
+        stream.append(writer.framePacket(payload));
+    }
+
+    // Split the data at any possible boundary: inside the length, inside the payload, etc
+    for (const int chunkSize : { 1, 3, 7, 64, 1000, stream.size() }) {
+        TestTcpTransport transport(sessionType);
+        QVector<QByteArray> received;
+        connect(&transport, &Telegram::BaseTransport::packetReceived, [&received](const QByteArray &payload) {
+            received.append(QByteArray(payload.constData(), payload.size()));
+        });
+        for (int offset = 0; offset < stream.size(); offset += chunkSize) {
+            transport.feed(stream.mid(offset, chunkSize));
+        }
+        QCOMPARE(received.count(), payloads.count());
+        for (int i = 0; i < payloads.count(); ++i) {
+            QCOMPARE(received.at(i), payloads.at(i));
+        }
+    }
+}
+
+void tst_CTelegramTransport::readPaddedErrorPacket()
+{
+    using Telegram::BaseTcpTransport;
+    using Telegram::ConnectionError;
+    const QByteArray errorPacket = ConnectionError(ConnectionError::InvalidAuthKey).toByteArray();
+    QCOMPARE(errorPacket.size(), ConnectionError::packetSize());
+
+    // Our own writer never pads the error packet
+    TestTcpTransport writer(BaseTcpTransport::PaddedIntermediate);
+    for (int i = 0; i < 32; ++i) {
+        QCOMPARE(writer.framePacket(errorPacket).size(), 4 + ConnectionError::packetSize());
+    }
+
+    // A peer can pad it anyway; the reader still has to recognize the error
+    for (int padding = 0; padding <= 15; ++padding) {
+        QByteArray frame(4, Qt::Uninitialized);
+        const quint32 length = static_cast<quint32>(errorPacket.size() + padding);
+        qToLittleEndian<quint32>(length, reinterpret_cast<uchar *>(frame.data()));
+        frame.append(errorPacket);
+        frame.append(QByteArray(padding, char(0x5a)));
+        // Follow the error by a regular packet to check the frame boundary
+        const QByteArray payload = makeEncryptedPayload(2, 'x');
+        frame.append(writer.framePacket(payload));
+
+        TestTcpTransport transport(BaseTcpTransport::PaddedIntermediate);
+        QVector<QByteArray> received;
+        connect(&transport, &Telegram::BaseTransport::packetReceived, [&received](const QByteArray &packet) {
+            received.append(QByteArray(packet.constData(), packet.size()));
+        });
+        transport.feed(frame);
+        QCOMPARE(received.count(), 2);
+        QCOMPARE(received.at(0), errorPacket);
+        QCOMPARE(ConnectionError(received.at(0)).code(), ConnectionError::InvalidAuthKey);
+        QCOMPARE(received.at(1), payload);
+    }
+}
+
+void tst_CTelegramTransport::benchmarkReadFrames_data()
+{
+    QTest::addColumn<Telegram::BaseTcpTransport::SessionType>("sessionType");
+    QTest::addColumn<int>("payloadBlocks");
+
+    const QVector<int> blocks = { 0, 4, 64 };
+    for (const int count : blocks) {
+        const QByteArray suffix = " (" + QByteArray::number(24 + count * 16) + " bytes)";
+        QTest::newRow(QByteArray("Abridged" + suffix).constData())
+                << Telegram::BaseTcpTransport::Abridged << count;
+        QTest::newRow(QByteArray("Intermediate" + suffix).constData())
+                << Telegram::BaseTcpTransport::Intermediate << count;
+        QTest::newRow(QByteArray("Padded intermediate" + suffix).constData())
+                << Telegram::BaseTcpTransport::PaddedIntermediate << count;
+    }
+}
+
+void tst_CTelegramTransport::benchmarkReadFrames()
+{
+    QFETCH(Telegram::BaseTcpTransport::SessionType, sessionType);
+    QFETCH(int, payloadBlocks);
+
+    // An update storm: 10k frames delivered by a single socket read
+    constexpr int c_framesCount = 10000;
+    TestTcpTransport writer(sessionType);
+    QByteArray stream;
+    for (int i = 0; i < c_framesCount; ++i) {
+        stream.append(writer.framePacket(makeEncryptedPayload(payloadBlocks, char(i))));
+    }
+
+    TestTcpTransport transport(sessionType);
+    int received = 0;
+    connect(&transport, &Telegram::BaseTransport::packetReceived, [&received](const QByteArray &) {
+        ++received;
+    });
+
+    QBENCHMARK {
+        received = 0;
+        transport.feed(stream);
+    }
+    QCOMPARE(received, c_framesCount);
+}
+
 QTEST_MAIN(tst_CTelegramTransport)
 
 #include "tst_CTelegramTransport.moc"
@@ -17,15 +17,23 @@
 
 #include <QObject>
 
+#include "MTProto/DecodeArena.hpp"
+#include "MTProto/LazyVector.hpp"
+#include "MTProto/SerializedSize.hpp"
 #include "MTProto/Stream_p.hpp"
 #include "MTProto/StreamExtraOperators.hpp"
 
 #include <QBuffer>
+#include <QFile>
 #include <QTest>
 #include <QDebug>
 
 #include <QtEndian>
 
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
 template <typename T>
 int getValueEncodedSize(const T &value)
 {
@@ -218,6 +226,7 @@ private slots:
     void intSerialization();
     void vectorOfIntsSerialization();
     void vectorDeserializationError();
+    void malformedLengthsFailFast();
     void pointerVectorSerialization();
     void pointerVectorDeserialization();
     void tlNumbersSerialization();
@@ -226,6 +235,30 @@ private slots:
     void readError();
     void byteArrays();
     void reqPqData();
+    void messagesMessagesRoundTrip();
+    void benchmarkDecodeMessagesMessages_data();
+    void benchmarkDecodeMessagesMessages();
+    void serializedSizeMatchesStream();
+    void benchmarkEncodeLargePayloads_data();
+    void benchmarkEncodeLargePayloads();
+    void decodeResetsTarget();
+    void benchmarkDecodeLargePayloads_data();
+    void benchmarkDecodeLargePayloads();
+    void decodedUpdatesFootprint();
+    void decodeIntoArena();
+    void redecodePointerVector();
+    void benchmarkDecodeInstantView_data();
+    void benchmarkDecodeInstantView();
+    void skipMatchesRead();
+    void lazyVector();
+    void benchmarkReadMessageIds_data();
+    void benchmarkReadMessageIds();
+    void utf8StringDeserialization();
+    void benchmarkDecodeMessageTexts_data();
+    void benchmarkDecodeMessageTexts();
+    void sharedBytesDeserialization();
+    void benchmarkDecodeFileChunk_data();
+    void benchmarkDecodeFileChunk();
 
 };
 
@@ -688,6 +721,92 @@ void tst_MTProtoStream::vectorDeserializationError()
     }
 }
 
+void tst_MTProtoStream::malformedLengthsFailFast()
+{
+    // The declared lengths exceed the input, so the reads must fail without the allocation
+    {
+        // 0xfe marker with the 3-bytes length of 16 Mb - 1
+        const QByteArray encoded = QByteArray::fromHex("feffffff") + QByteArray(8, 'a');
+        Telegram::MTProto::Stream stream(encoded);
+        QByteArray bytes;
+        stream >> bytes;
+        QVERIFY(stream.error());
+        QVERIFY(bytes.isEmpty());
+    }
+    {
+        const QByteArray encoded = QByteArray::fromHex("feffffff") + QByteArray(8, 'a');
+        Telegram::MTProto::Stream stream(encoded);
+        QString string;
+        stream >> string;
+        QVERIFY(stream.error());
+        QVERIFY(string.isEmpty());
+    }
+
+    QByteArray hugeVector;
+    {
+        Telegram::MTProto::Stream stream(&hugeVector, /* write */ true);
+        stream << TLValue(TLValue::Vector);
+        stream << quint32(0x7fffffff);
+        stream << quint32(1);
+        stream << quint32(2);
+    }
+    {
+        Telegram::MTProto::Stream stream(hugeVector);
+        TLVector<quint32> vector;
+        stream >> vector;
+        QVERIFY(stream.error());
+        QVERIFY(vector.isEmpty());
+    }
+    {
+        Telegram::MTProto::Stream stream(hugeVector);
+        TLVector<TLUpdate> vector;
+        stream >> vector;
+        QVERIFY(stream.error());
+        QVERIFY(vector.isEmpty());
+    }
+    {
+        Telegram::MTProto::Stream stream(hugeVector);
+        TLVector<quint32*> vector;
+        stream >> vector;
+        QVERIFY(stream.error());
+        QVERIFY(vector.isEmpty());
+    }
+    {
+        // The declared count fits into the input, but the items are big in memory:
+        // the read must not reserve them all before the first (broken) item
+        const quint32 declaredCount = 256 * 1024;
+        QByteArray data;
+        {
+            Telegram::MTProto::Stream stream(&data, /* write */ true);
+            stream << TLValue(TLValue::Vector);
+            stream << declaredCount;
+        }
+        data.append(QByteArray(static_cast<int>(declaredCount) * 4, char(0xff)));
+        Telegram::MTProto::Stream stream(data);
+        TLVector<TLUpdate> vector;
+        stream >> vector;
+        QVERIFY(stream.error());
+        QVERIFY(vector.count() <= 1);
+        QVERIFY(vector.capacity() < 1024);
+    }
+    {
+        // Exactly two items fit into the remaining input
+        QByteArray data;
+        {
+            Telegram::MTProto::Stream stream(&data, /* write */ true);
+            stream << TLValue(TLValue::Vector);
+            stream << quint32(2);
+            stream << quint32(1);
+            stream << quint32(2);
+        }
+        Telegram::MTProto::Stream stream(data);
+        TLVector<quint32> vector;
+        stream >> vector;
+        QVERIFY(!stream.error());
+        QCOMPARE(vector, TLVector<quint32>({ 1, 2 }));
+    }
+}
+
 void tst_MTProtoStream::pointerVectorSerialization()
 {
     TLVector<quint32> values = { 1, 2, 3, 4, 5 };
@@ -988,6 +1107,888 @@ void tst_MTProtoStream::reqPqData()
     }
 }
 
+static TLUser getTestUser(quint32 id)
+{
+    TLUser user;
+    user.tlType = TLValue::User;
+    user.flags = TLUser::AccessHash | TLUser::FirstName | TLUser::LastName | TLUser::Username;
+    user.id = id;
+    user.accessHash = 0x1234567890ull * id;
+    user.firstName = QStringLiteral("First name %1").arg(id);
+    user.lastName = QStringLiteral("Last name %1").arg(id);
+    user.username = QStringLiteral("user%1").arg(id);
+    return user;
+}
+
+static TLMessage getTestMessage(int id)
+{
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.flags = TLMessage::FromId;
+    message.id = static_cast<quint32>(id);
+    message.fromId = static_cast<quint32>(id % 10 + 1);
+    message.toId.tlType = TLValue::PeerUser;
+    message.toId.userId = 1;
+    message.date = 1500000000u + static_cast<quint32>(id);
+    message.message = QStringLiteral("Message text number %1, long enough to look like a real one").arg(id);
+    return message;
+}
+
+static TLMessagesMessages getMessagesMessages(int messagesCount)
+{
+    TLMessagesMessages result;
+    result.tlType = TLValue::MessagesMessages;
+    for (quint32 i = 1; i <= 10; ++i) {
+        result.users.append(getTestUser(i));
+    }
+    for (int i = 1; i <= messagesCount; ++i) {
+        result.messages.append(getTestMessage(i));
+    }
+    return result;
+}
+
+static TLMessagesDialogs getMessagesDialogs(int dialogsCount)
+{
+    TLMessagesDialogs result;
+    result.tlType = TLValue::MessagesDialogs;
+    for (int i = 1; i <= dialogsCount; ++i) {
+        TLDialog dialog;
+        dialog.tlType = TLValue::Dialog;
+        dialog.flags = TLDialog::Pts;
+        dialog.peer.tlType = TLValue::PeerUser;
+        dialog.peer.userId = static_cast<quint32>(i);
+        dialog.topMessage = static_cast<quint32>(i);
+        dialog.pts = static_cast<quint32>(i * 2);
+        result.dialogs.append(dialog);
+        result.messages.append(getTestMessage(i));
+        result.users.append(getTestUser(static_cast<quint32>(i)));
+    }
+    return result;
+}
+
+static TLUpdates getUpdates(int updatesCount)
+{
+    TLUpdates result;
+    result.tlType = TLValue::Updates;
+    for (int i = 1; i <= updatesCount; ++i) {
+        TLUpdate update;
+        update.tlType = TLValue::UpdateNewMessage;
+        *update.message = getTestMessage(i);
+        update.pts = static_cast<quint32>(i);
+        update.ptsCount = 1;
+        result.updates.append(update);
+    }
+    for (quint32 i = 1; i <= 10; ++i) {
+        result.users.append(getTestUser(i));
+    }
+    result.date = 1500000000u;
+    return result;
+}
+
+static QByteArray getMessagesMessagesData(int messagesCount)
+{
+    QByteArray data;
+    Telegram::MTProto::Stream stream(&data, /* write */ true);
+    stream << getMessagesMessages(messagesCount);
+    return data;
+}
+
+void tst_MTProtoStream::messagesMessagesRoundTrip()
+{
+    const TLMessagesMessages messages = getMessagesMessages(20);
+    const QByteArray data = getMessagesMessagesData(20);
+
+    // The in-memory backend and the QIODevice one produce the same result
+    QBuffer device;
+    device.open(QBuffer::WriteOnly);
+    Telegram::MTProto::Stream deviceStream(&device);
+    deviceStream << messages;
+    QCOMPARE(device.data(), data);
+
+    Telegram::MTProto::Stream stream(data);
+    TLMessagesMessages result;
+    stream >> result;
+    QVERIFY(!stream.error());
+    QVERIFY(stream.atEnd());
+    QCOMPARE(result.messages.count(), messages.messages.count());
+    QCOMPARE(result.users.count(), messages.users.count());
+    QCOMPARE(result.messages.last().message, messages.messages.last().message);
+    QCOMPARE(result.users.last().username, messages.users.last().username);
+
+    // Truncated data is reported as an error
+    Telegram::MTProto::Stream truncatedStream(data.left(data.size() - 3));
+    truncatedStream >> result;
+    QVERIFY(truncatedStream.error());
+}
+
+void tst_MTProtoStream::benchmarkDecodeMessagesMessages_data()
+{
+    QTest::addColumn<int>("messagesCount");
+    QTest::addColumn<bool>("useDevice");
+
+    const QVector<int> counts = { 1, 100, 1000 };
+    for (const int count : counts) {
+        // The "device" rows reproduce the previous cost (a QBuffer behind the stream)
+        QTest::newRow(QByteArray("device " + QByteArray::number(count)).constData()) << count << true;
+        QTest::newRow(QByteArray("memory " + QByteArray::number(count)).constData()) << count << false;
+    }
+}
+
+void tst_MTProtoStream::benchmarkDecodeMessagesMessages()
+{
+    QFETCH(int, messagesCount);
+    QFETCH(bool, useDevice);
+
+    const QByteArray data = getMessagesMessagesData(messagesCount);
+    if (useDevice) {
+        QBENCHMARK {
+            QBuffer device;
+            device.setData(data);
+            device.open(QBuffer::ReadOnly);
+            Telegram::MTProto::Stream stream(&device);
+            TLMessagesMessages result;
+            stream >> result;
+        }
+    } else {
+        QBENCHMARK {
+            Telegram::MTProto::Stream stream(data);
+            TLMessagesMessages result;
+            stream >> result;
+        }
+    }
+}
+
+void tst_MTProtoStream::serializedSizeMatchesStream()
+{
+    using Telegram::MTProto::serializedSize;
+
+    const QStringList strings = {
+        QString(), QStringLiteral("abc"), QStringLiteral("abcd"),
+        QString(253, QLatin1Char('a')), QString(254, QLatin1Char('a')),
+        QString::fromUtf8("\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80"), // 2, 3 and 4 bytes in UTF-8
+        QString(QChar(0xd800)) + QLatin1Char('x'), // An unpaired surrogate
+    };
+    for (const QString &s : strings) {
+        Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+        stream << s;
+        QCOMPARE(serializedSize(s), stream.getData().size());
+    }
+
+    const TLMessagesDialogs dialogs = getMessagesDialogs(20);
+    const TLUpdates updates = getUpdates(20);
+    TLVector<TLPageBlock*> blocks;
+    blocks.append(new TLPageBlock);
+    blocks.first()->tlType = TLValue::PageBlockTitle;
+    blocks.first()->text->tlType = TLValue::TextPlain;
+    blocks.first()->text->text = QStringLiteral("Title");
+
+    Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+    stream << dialogs;
+    QCOMPARE(serializedSize(dialogs), stream.getData().size());
+    stream << updates;
+    QCOMPARE(serializedSize(dialogs) + serializedSize(updates), stream.getData().size());
+    stream << blocks;
+    QCOMPARE(serializedSize(dialogs) + serializedSize(updates) + serializedSize(blocks), stream.getData().size());
+    qDeleteAll(blocks);
+}
+
+void tst_MTProtoStream::benchmarkEncodeLargePayloads_data()
+{
+    QTest::addColumn<bool>("updates");
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("reserve");
+
+    const QVector<int> counts = { 100, 1000 };
+    for (const int count : counts) {
+        const QByteArray countText = QByteArray::number(count);
+        // The "growing" rows reproduce the previous cost (no size hint for the buffer)
+        QTest::newRow(QByteArray("TLMessagesDialogs growing " + countText).constData()) << false << count << false;
+        QTest::newRow(QByteArray("TLMessagesDialogs exact " + countText).constData()) << false << count << true;
+        QTest::newRow(QByteArray("TLUpdates growing " + countText).constData()) << true << count << false;
+        QTest::newRow(QByteArray("TLUpdates exact " + countText).constData()) << true << count << true;
+    }
+}
+
+void tst_MTProtoStream::benchmarkEncodeLargePayloads()
+{
+    QFETCH(bool, updates);
+    QFETCH(int, count);
+    QFETCH(bool, reserve);
+
+    const TLMessagesDialogs dialogs = updates ? TLMessagesDialogs() : getMessagesDialogs(count);
+    const TLUpdates updatesValue = updates ? getUpdates(count) : TLUpdates();
+
+    QBENCHMARK {
+        quint32 size = 0;
+        if (reserve) {
+            size = static_cast<quint32>(updates ? Telegram::MTProto::serializedSize(updatesValue)
+                                                : Telegram::MTProto::serializedSize(dialogs));
+        }
+        Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly, size);
+        if (updates) {
+            stream << updatesValue;
+        } else {
+            stream << dialogs;
+        }
+        const QByteArray encoded = stream.getData();
+        Q_UNUSED(encoded)
+    }
+}
+
+void tst_MTProtoStream::decodeResetsTarget()
+{
+    TLMessage source = getTestMessage(1);
+    source.flags = 0;
+    source.fromId = 0;
+    source.message = QStringLiteral("Text");
+
+    QByteArray data;
+    {
+        Telegram::MTProto::Stream stream(&data, /* write */ true);
+        stream << source;
+    }
+
+    // The decoded value replaces all fields of the target, including the ones missing in the data
+    TLMessage target = getTestMessage(2);
+    target.entities.append(TLMessageEntity());
+    Telegram::MTProto::Stream stream(data);
+    stream >> target;
+    QVERIFY(!stream.error());
+    QCOMPARE(target.flags, 0u);
+    QCOMPARE(target.fromId, 0u);
+    QCOMPARE(target.id, 1u);
+    QCOMPARE(target.message, source.message);
+    QVERIFY(target.entities.isEmpty());
+
+    TLVector<TLMessage> messages = { getTestMessage(3), getTestMessage(4), getTestMessage(5) };
+    const TLVector<TLMessage> sourceMessages = { source };
+    QByteArray vectorData;
+    {
+        Telegram::MTProto::Stream vectorStream(&vectorData, /* write */ true);
+        vectorStream << sourceMessages;
+    }
+    Telegram::MTProto::Stream vectorStream(vectorData);
+    vectorStream >> messages;
+    QVERIFY(!vectorStream.error());
+    QCOMPARE(messages.count(), 1);
+    QCOMPARE(messages.first().message, source.message);
+    QCOMPARE(messages.first().fromId, 0u);
+}
+
+void tst_MTProtoStream::benchmarkDecodeLargePayloads_data()
+{
+    QTest::addColumn<bool>("updates");
+    QTest::addColumn<int>("count");
+
+    const QVector<int> counts = { 100, 1000 };
+    for (const int count : counts) {
+        const QByteArray countText = QByteArray::number(count);
+        QTest::newRow(QByteArray("TLMessagesDialogs " + countText).constData()) << false << count;
+        QTest::newRow(QByteArray("TLUpdates " + countText).constData()) << true << count;
+    }
+}
+
+void tst_MTProtoStream::benchmarkDecodeLargePayloads()
+{
+    QFETCH(bool, updates);
+    QFETCH(int, count);
+
+    QByteArray data;
+    {
+        Telegram::MTProto::Stream stream(&data, /* write */ true);
+        if (updates) {
+            stream << getUpdates(count);
+        } else {
+            stream << getMessagesDialogs(count);
+        }
+    }
+
+    // Decode into the same target on each iteration, so the previous value has to be replaced
+    TLMessagesDialogs dialogs;
+    TLUpdates updatesValue;
+    QBENCHMARK {
+        Telegram::MTProto::Stream stream(data);
+        if (updates) {
+            stream >> updatesValue;
+        } else {
+            stream >> dialogs;
+        }
+    }
+    QVERIFY(updates ? (updatesValue.updates.count() == count) : (dialogs.messages.count() == count));
+}
+
+static qint64 residentMemorySize()
+{
+#ifdef Q_OS_LINUX
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (!statm.open(QIODevice::ReadOnly)) {
+        return -1;
+    }
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.count() < 2) {
+        return -1;
+    }
+    return fields.at(1).toLongLong() * sysconf(_SC_PAGESIZE);
+#else
+    return -1;
+#endif
+}
+
+void tst_MTProtoStream::decodedUpdatesFootprint()
+{
+    // A getDifference-like batch: a few messages among a lot of small state updates
+    const int count = 10000;
+    TLVector<TLUpdate> updates;
+    updates.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        TLUpdate update;
+        update.userId = static_cast<quint32>(i % 100 + 1);
+        switch (i % 4) {
+        case 0:
+            update.tlType = TLValue::UpdateNewMessage;
+            *update.message = getTestMessage(i + 1);
+            update.pts = static_cast<quint32>(i);
+            update.ptsCount = 1;
+            break;
+        case 1:
+            update.tlType = TLValue::UpdateUserStatus;
+            update.status.tlType = TLValue::UserStatusOnline;
+            update.status.expires = 1500000000u;
+            break;
+        case 2:
+            update.tlType = TLValue::UpdateUserTyping;
+            update.action.tlType = TLValue::SendMessageTypingAction;
+            break;
+        default:
+            update.tlType = TLValue::UpdateReadHistoryInbox;
+            update.peer.tlType = TLValue::PeerUser;
+            update.peer.userId = update.userId;
+            update.maxId = static_cast<quint32>(i);
+            update.pts = static_cast<quint32>(i);
+            update.ptsCount = 1;
+            break;
+        }
+        updates.append(update);
+    }
+
+    QByteArray data;
+    {
+        Telegram::MTProto::Stream stream(&data, /* write */ true);
+        stream << updates;
+    }
+    updates.clear();
+    updates.squeeze();
+
+    const qint64 residentBefore = residentMemorySize();
+    TLVector<TLUpdate> decoded;
+    {
+        Telegram::MTProto::Stream stream(data);
+        stream >> decoded;
+        QVERIFY(!stream.error());
+    }
+    const qint64 residentAfter = residentMemorySize();
+
+    QCOMPARE(decoded.count(), count);
+    for (int i = 0; i < count; ++i) {
+        const TLUpdate &update = decoded.at(i);
+        // Only the message updates carry the message payload
+        QCOMPARE(update.message.isNull(), update.tlType != TLValue::UpdateNewMessage);
+    }
+    QCOMPARE(decoded.first().message->id, 1u);
+    QCOMPARE(decoded.at(1).message->id, 0u);
+
+    qDebug().nospace() << "sizeof(TLUpdate): " << sizeof(TLUpdate)
+                       << ", sizeof(TLMessage): " << sizeof(TLMessage)
+                       << ", encoded: " << data.size() << " bytes"
+                       << ", decoded footprint: "
+                       << ((residentBefore < 0) ? QStringLiteral("n/a") : QString::number(residentAfter - residentBefore) + QStringLiteral(" bytes"));
+}
+
+static TLRichText *getPlainText(const QString &text)
+{
+    TLRichText *result = new TLRichText();
+    result->tlType = TLValue::TextPlain;
+    result->stringText = text;
+    return result;
+}
+
+static TLWebPage getInstantViewWebPage(int blocksCount)
+{
+    TLWebPage result;
+    result.tlType = TLValue::WebPage;
+    result.flags = TLWebPage::CachedPage;
+    result.id = 1;
+    result.url = QStringLiteral("https://example.com/article");
+    result.displayUrl = QStringLiteral("example.com/article");
+    result.cachedPage.tlType = TLValue::PageFull;
+    for (int i = 0; i < blocksCount; ++i) {
+        TLPageBlock *block = new TLPageBlock();
+        if (i % 2) {
+            block->tlType = TLValue::PageBlockList;
+            for (int j = 0; j < 5; ++j) {
+                block->richTextItemsVector.append(getPlainText(QStringLiteral("List item %1.%2").arg(i).arg(j)));
+            }
+        } else {
+            block->tlType = TLValue::PageBlockParagraph;
+            TLRichText &text = *block->text;
+            text.tlType = TLValue::TextConcat;
+            text.texts.append(getPlainText(QStringLiteral("Paragraph number %1 begins with a plain text, ").arg(i)));
+            TLRichText *bold = new TLRichText();
+            bold->tlType = TLValue::TextBold;
+            bold->richText->tlType = TLValue::TextPlain;
+            bold->richText->stringText = QStringLiteral("continues with a bold one");
+            text.texts.append(bold);
+            text.texts.append(getPlainText(QStringLiteral(" and ends with a plain text again.")));
+        }
+        result.cachedPage.blocks.append(block);
+    }
+    return result;
+}
+
+// The heap-allocated graph has to be freed node by node
+static void deleteItems(TLRichText *text)
+{
+    if (text->richText) {
+        deleteItems(&*text->richText);
+    }
+    for (TLRichText *item : text->texts) {
+        deleteItems(item);
+        delete item;
+    }
+    text->texts.clear();
+}
+
+static void deleteItems(TLPage *page)
+{
+    for (TLPageBlock *block : page->blocks) {
+        if (block->text) {
+            deleteItems(&*block->text);
+        }
+        for (TLRichText *item : block->richTextItemsVector) {
+            deleteItems(item);
+            delete item;
+        }
+        delete block;
+    }
+    page->blocks.clear();
+}
+
+void tst_MTProtoStream::decodeIntoArena()
+{
+    TLWebPage source = getInstantViewWebPage(10);
+    QByteArray data;
+    {
+        Telegram::MTProto::Stream stream(&data, /* write */ true);
+        stream << source;
+    }
+    deleteItems(&source.cachedPage);
+
+    Telegram::MTProto::DecodeArena arena;
+    {
+        TLWebPage webPage;
+        Telegram::MTProto::Stream stream(data);
+        stream.setArena(&arena);
+        stream >> webPage;
+        QVERIFY(!stream.error());
+
+        QCOMPARE(webPage.cachedPage.blocks.count(), 10);
+        for (const TLPageBlock *block : webPage.cachedPage.blocks) {
+            QVERIFY(arena.contains(block));
+            for (const TLRichText *item : block->richTextItemsVector) {
+                QVERIFY(arena.contains(item));
+            }
+        }
+        QVERIFY(arena.contains(webPage.cachedPage.blocks.first()->text->texts.first()));
+
+        QByteArray encoded;
+        {
+            Telegram::MTProto::Stream outputStream(&encoded, /* write */ true);
+            outputStream << webPage;
+        }
+        QCOMPARE(encoded, data);
+    }
+    QVERIFY(arena.allocatedSize() > 0);
+    arena.clear();
+}
+
+void tst_MTProtoStream::redecodePointerVector()
+{
+    TLRichText plainText;
+    plainText.tlType = TLValue::TextPlain;
+    plainText.stringText = QStringLiteral("Plain text");
+    const TLVector<TLRichText*> source = { &plainText, &plainText, &plainText };
+    QByteArray data;
+    {
+        Telegram::MTProto::Stream stream(&data, /* write */ true);
+        stream << source;
+    }
+
+    Telegram::MTProto::DecodeArena arena1;
+    Telegram::MTProto::DecodeArena arena2;
+    // Each decode replaces the items of the previous one: the heap items are deleted,
+    // while the arena items are left to their arena (no matter which stream decodes)
+    const QVector<Telegram::MTProto::DecodeArena *> arenas = {
+        &arena1, nullptr, &arena2, &arena1, nullptr, nullptr,
+    };
+    TLVector<TLRichText*> vector;
+    for (Telegram::MTProto::DecodeArena *arena : arenas) {
+        Telegram::MTProto::Stream stream(data);
+        stream.setArena(arena);
+        stream >> vector;
+        QVERIFY(!stream.error());
+        QVERIFY(vector.itemsArena == arena);
+        QCOMPARE(vector.count(), source.count());
+        for (const TLRichText *item : vector) {
+            QCOMPARE(item->stringText, plainText.stringText);
+            QCOMPARE(arena1.contains(item), arena == &arena1);
+            QCOMPARE(arena2.contains(item), arena == &arena2);
+        }
+    }
+    qDeleteAll(vector);
+}
+
+void tst_MTProtoStream::benchmarkDecodeInstantView_data()
+{
+    QTest::addColumn<bool>("useArena");
+    QTest::addColumn<int>("count");
+
+    const QVector<int> counts = { 100, 1000 };
+    for (const int count : counts) {
+        const QByteArray countText = QByteArray::number(count);
+        QTest::newRow(QByteArray("heap " + countText).constData()) << false << count;
+        QTest::newRow(QByteArray("arena " + countText).constData()) << true << count;
+    }
+}
+
+void tst_MTProtoStream::benchmarkDecodeInstantView()
+{
+    QFETCH(bool, useArena);
+    QFETCH(int, count);
+
+    TLWebPage source = getInstantViewWebPage(count);
+    QByteArray data;
+    {
+        Telegram::MTProto::Stream stream(&data, /* write */ true);
+        stream << source;
+    }
+    deleteItems(&source.cachedPage);
+
+    // Each iteration decodes and frees the whole graph
+    Telegram::MTProto::DecodeArena arena;
+    QBENCHMARK {
+        TLWebPage webPage;
+        Telegram::MTProto::Stream stream(data);
+        if (useArena) {
+            stream.setArena(&arena);
+        }
+        stream >> webPage;
+        if (useArena) {
+            arena.clear();
+        } else {
+            deleteItems(&webPage.cachedPage);
+        }
+    }
+}
+
+template <typename T>
+static void compareSkipAndRead(const QByteArray &data)
+{
+    Telegram::MTProto::Stream readStream(data);
+    T value;
+    readStream >> value;
+    Telegram::MTProto::Stream skipStream(data);
+    skipStream.skip<T>();
+    QVERIFY(!skipStream.error());
+    QCOMPARE(skipStream.position(), readStream.position());
+    QVERIFY(skipStream.atEnd());
+
+    Telegram::MTProto::Stream truncatedStream(data.left(data.size() - 3));
+    truncatedStream.skip<T>();
+    QVERIFY(truncatedStream.error());
+}
+
+template <typename T>
+static QByteArray encodeValue(const T &value)
+{
+    QByteArray data;
+    Telegram::MTProto::Stream stream(&data, /* write */ true);
+    stream << value;
+    return data;
+}
+
+void tst_MTProtoStream::skipMatchesRead()
+{
+    TLMessagesMessages messages = getMessagesMessages(20);
+    messages.messages[1].flags |= TLMessage::ReplyToMsgId | TLMessage::Views | TLMessage::Entities;
+    messages.messages[1].replyToMsgId = 1;
+    messages.messages[1].views = 10;
+    TLMessageEntity entity;
+    entity.tlType = TLValue::MessageEntityUrl;
+    entity.length = 5;
+    messages.messages[1].entities.append(entity);
+    messages.messages[2].tlType = TLValue::MessageEmpty;
+    compareSkipAndRead<TLMessagesMessages>(encodeValue(messages));
+    compareSkipAndRead<TLMessagesDialogs>(encodeValue(getMessagesDialogs(20)));
+    compareSkipAndRead<TLUpdates>(encodeValue(getUpdates(20)));
+
+    TLWebPage webPage = getInstantViewWebPage(10);
+    compareSkipAndRead<TLWebPage>(encodeValue(webPage));
+    deleteItems(&webPage.cachedPage);
+}
+
+void tst_MTProtoStream::lazyVector()
+{
+    TLMessagesMessages messages = getMessagesMessages(100);
+    messages.messages[2].tlType = TLValue::MessageEmpty;
+    const QByteArray data = encodeValue(messages);
+
+    Telegram::MTProto::Stream stream(data);
+    TLValue tlType;
+    stream >> tlType;
+    QVERIFY(tlType == TLValue::MessagesMessages);
+    Telegram::MTProto::LazyVector<TLMessage> lazyMessages;
+    stream >> lazyMessages;
+    QVERIFY(!stream.error());
+    QVERIFY(lazyMessages.isValid());
+    QCOMPARE(lazyMessages.count(), messages.messages.count());
+    QVERIFY(lazyMessages.typeAt(0) == TLValue::Message);
+    QVERIFY(lazyMessages.typeAt(2) == TLValue::MessageEmpty);
+    for (int i = 0; i < lazyMessages.count(); ++i) {
+        const TLMessage message = lazyMessages.at(i);
+        QCOMPARE(message.tlType, messages.messages.at(i).tlType);
+        QCOMPARE(message.id, messages.messages.at(i).id);
+        QCOMPARE(message.message, messages.messages.at(i).message);
+        QCOMPARE(lazyMessages.itemData(i), encodeValue(messages.messages.at(i)));
+    }
+    QCOMPARE(lazyMessages.toVector().count(), messages.messages.count());
+
+    stream.skipVector<TLChat>();
+    TLVector<TLUser> users;
+    stream >> users;
+    QVERIFY(!stream.error());
+    QVERIFY(stream.atEnd());
+    QCOMPARE(users.count(), messages.users.count());
+
+    // The view of a reply span (e.g. within an rpc_result) shares the whole data
+    const QByteArray packet = QByteArray(12, 'x') + data + QByteArray(16, 'y');
+    Telegram::MTProto::Stream spanStream(packet, 12 + 4, data.size() - 4);
+    spanStream >> lazyMessages;
+    QVERIFY(!spanStream.error());
+    QCOMPARE(lazyMessages.count(), messages.messages.count());
+    QVERIFY(lazyMessages.typeAt(2) == TLValue::MessageEmpty);
+    QCOMPARE(lazyMessages.at(1).id, messages.messages.at(1).id);
+    QCOMPARE(lazyMessages.itemData(1), encodeValue(messages.messages.at(1)));
+    QVERIFY(lazyMessages.itemData(1).constData() > packet.constData());
+    QVERIFY(lazyMessages.itemData(1).constData() < packet.constData() + packet.size());
+
+    // The invalid data is reported as an error and gives an empty view
+    Telegram::MTProto::Stream truncatedStream(data.mid(4, 200));
+    truncatedStream >> lazyMessages;
+    QVERIFY(truncatedStream.error());
+    QCOMPARE(lazyMessages.count(), 0);
+}
+
+void tst_MTProtoStream::benchmarkReadMessageIds_data()
+{
+    QTest::addColumn<int>("mode");
+
+    QTest::newRow("decode") << 0;
+    QTest::newRow("lazy decode") << 1;
+    QTest::newRow("lazy ids") << 2;
+}
+
+void tst_MTProtoStream::benchmarkReadMessageIds()
+{
+    QFETCH(int, mode);
+
+    // A history reply with 100 messages, where only the message ids are needed
+    const QByteArray data = getMessagesMessagesData(100);
+    quint32 idsSum = 0;
+    QBENCHMARK {
+        idsSum = 0;
+        Telegram::MTProto::Stream stream(data);
+        if (mode == 0) {
+            TLMessagesMessages result;
+            stream >> result;
+            for (const TLMessage &message : result.messages) {
+                idsSum += message.id;
+            }
+        } else {
+            TLValue tlType;
+            stream >> tlType;
+            Telegram::MTProto::LazyVector<TLMessage> messages;
+            stream >> messages;
+            for (int i = 0; i < messages.count(); ++i) {
+                if (mode == 1) {
+                    idsSum += messages.at(i).id;
+                } else {
+                    // Message and MessageService have the flags before the id
+                    Telegram::MTProto::Stream itemStream(messages.itemData(i));
+                    itemStream >> tlType;
+                    if (tlType != TLValue::MessageEmpty) {
+                        itemStream.skip<quint32>();
+                    }
+                    quint32 id = 0;
+                    itemStream >> id;
+                    idsSum += id;
+                }
+            }
+        }
+    }
+    QCOMPARE(idsSum, 100u * 101u / 2u);
+}
+
+void tst_MTProtoStream::utf8StringDeserialization()
+{
+    const QString ascii = QStringLiteral("The quick brown fox jumps over the lazy dog");
+    const QString cyrillic = QString::fromUtf8("\xd0\xa1\xd1\x8a\xd0\xb5\xd1\x88\xd1\x8c \xd0\xb5\xd1\x89\xd1\x91");
+    QVector<QByteArray> inputs = {
+        QByteArray(),
+        QByteArrayLiteral("a"),
+        QByteArrayLiteral("0123456789abcde"),
+        QByteArrayLiteral("0123456789abcdef"),
+        QByteArrayLiteral("0123456789abcdefg"),
+        ascii.toUtf8(),
+        ascii.repeated(10).toUtf8(),
+        cyrillic.toUtf8(),
+        (ascii + cyrillic).toUtf8(), // The non-ASCII tail after a few ASCII chunks
+        (cyrillic + ascii).toUtf8(),
+        QByteArrayLiteral("0123456789abcdef\xff\xfe invalid UTF-8"),
+    };
+
+    for (const QByteArray &input : inputs) {
+        QByteArray data;
+        {
+            Telegram::MTProto::Stream stream(&data, /* write */ true);
+            stream << input;
+            stream << quint32(0xdeadbeef);
+        }
+
+        Telegram::MTProto::Stream stream(data);
+        QString result;
+        quint32 tail = 0;
+        stream >> result;
+        stream >> tail;
+        QVERIFY(!stream.error());
+        QCOMPARE(result, QString::fromUtf8(input));
+        QCOMPARE(tail, 0xdeadbeefu);
+
+        QBuffer device;
+        device.setData(data);
+        device.open(QBuffer::ReadOnly);
+        Telegram::MTProto::Stream deviceStream(&device);
+        QString deviceResult;
+        deviceStream >> deviceResult;
+        QCOMPARE(deviceResult, result);
+
+        if (input.size() > 4) {
+            Telegram::MTProto::Stream truncatedStream(data.left(data.size() - 8));
+            truncatedStream >> result;
+            QVERIFY(truncatedStream.error());
+        }
+    }
+}
+
+void tst_MTProtoStream::benchmarkDecodeMessageTexts_data()
+{
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("ascii") << QStringLiteral("Let's meet at 7pm near the station, I'll bring the documents. See https://example.com/page?id=42");
+    QTest::newRow("cyrillic") << QString::fromUtf8("\xd0\x94\xd0\xb0\xd0\xb2\xd0\xb0\xd0\xb9 \xd0\xb2\xd1\x81\xd1\x82\xd1\x80\xd0\xb5\xd1\x82\xd0\xb8\xd0\xbc\xd1\x81\xd1\x8f \xd0\xb2 7 \xd0\xb2\xd0\xb5\xd1\x87\xd0\xb5\xd1\x80\xd0\xb0 \xd1\x83 \xd1\x81\xd1\x82\xd0\xb0\xd0\xbd\xd1\x86\xd0\xb8\xd0\xb8").repeated(2);
+    QTest::newRow("mixed") << QString::fromUtf8("See you at 7pm \xf0\x9f\x98\x80 https://example.com/page?id=42");
+}
+
+void tst_MTProtoStream::benchmarkDecodeMessageTexts()
+{
+    QFETCH(QString, text);
+
+    // A history reply with 100 messages (and the users), where the texts make most of the payload
+    TLMessagesMessages messages = getMessagesMessages(100);
+    for (TLMessage &message : messages.messages) {
+        message.message = text;
+    }
+    const QByteArray data = encodeValue(messages);
+    QBENCHMARK {
+        Telegram::MTProto::Stream stream(data);
+        TLMessagesMessages result;
+        stream >> result;
+    }
+}
+
+static QByteArray getUploadFileData(int chunkSize)
+{
+    TLUploadFile file;
+    file.tlType = TLValue::UploadFile;
+    file.type.tlType = TLValue::StorageFileJpeg;
+    file.mtime = 1500000000u;
+    file.bytes = QByteArray(chunkSize, 'x');
+    return encodeValue(file);
+}
+
+void tst_MTProtoStream::sharedBytesDeserialization()
+{
+    const QByteArray data = getUploadFileData(512 * 1024);
+    const char *dataBegin = data.constData();
+    const char *dataEnd = dataBegin + data.size();
+
+    TLUploadFile result;
+    {
+        Telegram::MTProto::Stream stream(data);
+        stream.setBytesSharingEnabled(true);
+        stream >> result;
+        QVERIFY(!stream.error());
+        QVERIFY(stream.atEnd());
+    }
+    // The bytes reference the source data, which outlives the stream
+    QCOMPARE(result.bytes.size(), 512 * 1024);
+    QVERIFY(result.bytes.constData() > dataBegin);
+    QVERIFY(result.bytes.constData() + result.bytes.size() <= dataEnd);
+    QCOMPARE(result.bytes, QByteArray(512 * 1024, 'x'));
+
+    // A modification detaches the value and keeps the source intact
+    result.bytes[0] = 'y';
+    QVERIFY(result.bytes.constData() < dataBegin || result.bytes.constData() >= dataEnd);
+    QCOMPARE(data, getUploadFileData(512 * 1024));
+
+    // The sharing is off by default
+    Telegram::MTProto::Stream copyStream(data);
+    copyStream >> result;
+    QVERIFY(result.bytes.constData() < dataBegin || result.bytes.constData() >= dataEnd);
+    QCOMPARE(result.bytes, QByteArray(512 * 1024, 'x'));
+
+    // The device stream has nothing to share and makes a copy
+    QBuffer device;
+    device.setData(data);
+    device.open(QBuffer::ReadOnly);
+    Telegram::MTProto::Stream deviceStream(&device);
+    deviceStream.setBytesSharingEnabled(true);
+    deviceStream >> result;
+    QVERIFY(!deviceStream.error());
+    QCOMPARE(result.bytes, QByteArray(512 * 1024, 'x'));
+}
+
+void tst_MTProtoStream::benchmarkDecodeFileChunk_data()
+{
+    QTest::addColumn<bool>("shareBytes");
+
+    QTest::newRow("copy") << false;
+    QTest::newRow("shared") << true;
+}
+
+void tst_MTProtoStream::benchmarkDecodeFileChunk()
+{
+    QFETCH(bool, shareBytes);
+
+    // The size of an upload.getFile chunk
+    const QByteArray data = getUploadFileData(512 * 1024);
+    QBENCHMARK {
+        Telegram::MTProto::Stream stream(data);
+        stream.setBytesSharingEnabled(shareBytes);
+        TLUploadFile result;
+        stream >> result;
+    }
+}
+
 //QTEST_APPLESS_MAIN(tst_MTProtoStream)
 QTEST_GUILESS_MAIN(tst_MTProtoStream)
 
@@ -17,6 +17,10 @@
 
 #include <QObject>
 
+#include "CAppInformation.hpp"
+#include "ClientRpcLayer.hpp"
+#include "IgnoredMessageNotification.hpp"
+#include "PendingRpcOperation.hpp"
 #include "RandomGenerator.hpp"
 #include "RpcLayer.hpp"
 #include "SendPackageHelper.hpp"
@@ -25,11 +29,79 @@
 #include "../utils/TestTransport.hpp"
 
 #include "MTProto/MessageHeader.hpp"
+#include "MTProto/Stream.hpp"
 
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QElapsedTimer>
 #include <QTest>
 #include <QDebug>
 #include <QSignalSpy>
 
+#include <cstdlib>
+
+// The sanitizers replace the allocator, so the counter is not available with them
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define TELEGRAMQT_SANITIZER_BUILD
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(memory_sanitizer) || __has_feature(thread_sanitizer)
+#define TELEGRAMQT_SANITIZER_BUILD
+#endif
+#endif
+
+#if defined(__GLIBC__) && !defined(TELEGRAMQT_SANITIZER_BUILD)
+#define ALLOCATION_COUNTER_AVAILABLE
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *pointer, size_t size);
+
+static bool s_countAllocations = false;
+static int s_allocations = 0;
+
+extern "C" void *malloc(size_t size)
+{
+    if (s_countAllocations) {
+        ++s_allocations;
+    }
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    if (s_countAllocations) {
+        ++s_allocations;
+    }
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *pointer, size_t size)
+{
+    if (s_countAllocations) {
+        ++s_allocations;
+    }
+    return __libc_realloc(pointer, size);
+}
+
+// Counts the heap allocations (including operator new) made during its lifetime
+class AllocationCounter
+{
+public:
+    AllocationCounter()
+    {
+        s_allocations = 0;
+        s_countAllocations = true;
+    }
+    ~AllocationCounter() { stop(); }
+
+    int stop()
+    {
+        s_countAllocations = false;
+        return s_allocations;
+    }
+};
+#endif // ALLOCATION_COUNTER_AVAILABLE
+
 namespace Telegram {
 
 namespace Test {
@@ -103,23 +175,25 @@ public:
 
     MTProto::Message lastProcessedMessage() const { return m_lastProcessedMessage; }
 
+    // The per-packet crypto of sendPacket(): msg_key, the key derivation and the encryption
+    Crypto::AesKey encryptInPlace(char *data, int size, char *messageKey) const
+    {
+        const CryptoContext context = cryptoContext();
+        getMessageKey(context.authKey, context.outgoingDirection, data, size, messageKey);
+        const Crypto::AesKey key = generateAesKey(context.authKey, messageKey, context.outgoingDirection);
+        Crypto::aesIgeEncrypt(data, size, key);
+        return key;
+    }
+
     bool processMessageHeader(const MTProto::FullMessageHeader &) override { return true; }
     bool processMTProtoMessage(const MTProto::Message &message) override { m_lastProcessedMessage = message; return false; }
 
 protected:
-    Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const final
+    MessageDirection outgoingDirection() const final
     {
-        return m_mode == Mode::Client ? generateClientToServerAesKey(messageKey) : generateServerToClientAesKey(messageKey);
+        return m_mode == Mode::Client ? ClientToServer : ServerToClient;
     }
 
-    Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const final
-    {
-        return m_mode == Mode::Client ? generateServerToClientAesKey(messageKey) : generateClientToServerAesKey(messageKey);
-    }
-
-    QByteArray getEncryptionKeyPart() const override;
-    QByteArray getVerificationKeyPart() const override;
-
     Mode m_mode;
     quint64 m_sessionId = 0;
     Transport *m_transport = nullptr;
@@ -127,22 +201,6 @@ protected:
     MTProto::Message m_lastProcessedMessage;
 };
 
-QByteArray RpcLayer::getEncryptionKeyPart() const
-{
-    if (m_mode == Mode::Client) {
-        return m_sendHelper->getClientKeyPart();
-    }
-    return m_sendHelper->getServerKeyPart();
-}
-
-QByteArray RpcLayer::getVerificationKeyPart() const
-{
-    if (m_mode == Mode::Client) {
-        return m_sendHelper->getServerKeyPart();
-    }
-    return m_sendHelper->getClientKeyPart();
-}
-
 class ClientRpcLayer : public RpcLayer
 {
     Q_OBJECT
@@ -172,11 +230,62 @@ public:
     }
 };
 
+// Unwraps the container, invokeWithLayer and initConnection messages like the server
+class UnwrappingRpcLayer : public RpcLayer
+{
+    Q_OBJECT
+public:
+    UnwrappingRpcLayer() : RpcLayer(Mode::Server) { }
+
+    int queriesCount() const { return m_queriesCount; }
+
+    bool processMTProtoMessage(const MTProto::Message &message) override
+    {
+        switch (message.firstValue()) {
+        case TLValue::MsgContainer:
+            return processMsgContainer(message.skipTLValue());
+        case TLValue::InvokeWithLayer:
+            return processMTProtoMessage(message.skipBytes(8)); // The value and the layer
+        case TLValue::InitConnection:
+        {
+            MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
+            TLValue value;
+            quint32 appId;
+            stream >> value;
+            stream >> appId;
+            // Device, system version, app version, system language, language pack and language code
+            for (int i = 0; i < 6; ++i) {
+                stream.skipByteArray();
+            }
+            if (stream.error()) {
+                return false;
+            }
+            return processMTProtoMessage(message.skipBytes(stream.position()));
+        }
+        default:
+            break;
+        }
+        m_lastProcessedMessage = message;
+        ++m_queriesCount;
+        return true;
+    }
+
+protected:
+    int m_queriesCount = 0;
+};
+
 } // Test
 
 } // Telegram
 
 const QByteArray c_authKey = QByteArrayLiteral("some_auth_key_data_123456789_abcdefghijklmnopqrstuvwxyz");
+const QByteArray c_fullAuthKey = []() {
+    QByteArray key(256, Qt::Uninitialized);
+    for (int i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<char>(i * 13 + 5);
+    }
+    return key;
+}();
 
 class tst_RpcLayer : public QObject
 {
@@ -190,6 +299,28 @@ private slots:
     void sendClientRequest();
     void sendServerReply();
     void processServerReply();
+    void packetCryptoStages();
+    void packetCrypto();
+    void packetCryptoAllocations();
+    void unwrapMessageContainer();
+    void benchmarkUnwrapMessageContainer();
+    void clientMessageContainer();
+    void benchmarkClientSendRpc_data();
+    void benchmarkClientSendRpc();
+    void clientRetransmissionBuffer();
+    void clientResendReleasedMessage();
+    void clientRequestCompression();
+    void benchmarkClientRequestCompression_data();
+    void benchmarkClientRequestCompression();
+    void clientAckScheduling();
+    void clientRestoreIgnoredAcks();
+    void benchmarkClientAckBurst_data();
+    void benchmarkClientAckBurst();
+    void clientRequestPriorities();
+    void clientDeletedQueuedRpc();
+    void clientIgnoredRpcReleasesWindow();
+    void clientSendMessageLatency_data();
+    void clientSendMessageLatency();
 
 private:
     Telegram::DeterministicGenerator *m_generator = nullptr;
@@ -267,9 +398,1085 @@ void tst_RpcLayer::processServerReply()
     rpcLayer.processPacket(c_serverReplyPackage);
 
     Telegram::MTProto::Message m = rpcLayer.lastProcessedMessage();
-    QCOMPARE(m.data, data);
+    QCOMPARE(m.content(), data);
+}
+
+void tst_RpcLayer::packetCryptoStages()
+{
+    Telegram::Test::ServerRpcLayer serverLayer;
+    Telegram::Test::ClientRpcLayer clientLayer;
+    serverLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+    clientLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+
+    Telegram::MTProto::Message message;
+    message.messageId = 0x5b9fb3ff00000001ull;
+    message.sequenceNumber = 1;
+    message.setData(QByteArrayLiteral("abcdefgh"));
+
+    // The stages use only the captured context, not the layers
+    const Telegram::BaseRpcLayer::CryptoContext serverContext = serverLayer.cryptoContext();
+    const Telegram::BaseRpcLayer::CryptoContext clientContext = clientLayer.cryptoContext();
+    QCOMPARE(serverContext.outgoingDirection, clientContext.incomingDirection);
+    serverLayer.sendHelper()->setAuthKey(QByteArray());
+
+    const QByteArray packet = Telegram::BaseRpcLayer::encryptPacket(serverContext, message, 1234ull, 5678ull);
+    QVERIFY(!packet.isEmpty());
+
+    Telegram::MTProto::FullMessageHeader header;
+    Telegram::MTProto::Message decryptedMessage;
+    QVERIFY(Telegram::BaseRpcLayer::decryptPacket(clientContext, packet, &header, &decryptedMessage));
+    QCOMPARE(header.serverSalt, 1234ull);
+    QCOMPARE(header.sessionId, 5678ull);
+    QCOMPARE(decryptedMessage.messageId, message.messageId);
+    QCOMPARE(decryptedMessage.sequenceNumber, message.sequenceNumber);
+    QCOMPARE(decryptedMessage.content(), message.data);
+
+    // The server context can not decrypt its own packet
+    QVERIFY(!Telegram::BaseRpcLayer::decryptPacket(serverContext, packet, &header, &decryptedMessage));
+
+    // A message span takes only its content to the packet
+    const Telegram::MTProto::Message span = message.skipBytes(4);
+    const QByteArray spanPacket = Telegram::BaseRpcLayer::encryptPacket(serverContext, span, 1234ull, 5678ull);
+    QVERIFY(Telegram::BaseRpcLayer::decryptPacket(clientContext, spanPacket, &header, &decryptedMessage));
+    QCOMPARE(header.contentLength, 4u);
+    QCOMPARE(decryptedMessage.content(), QByteArrayLiteral("efgh"));
+}
+
+void tst_RpcLayer::packetCrypto()
+{
+    Telegram::Test::ClientRpcLayer rpcLayer;
+    rpcLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+    const QByteArray plainData = QByteArray(64, 'x');
+
+    QByteArray data = plainData;
+    char messageKey[Telegram::BaseRpcLayer::MessageKeySize];
+    const Telegram::Crypto::AesKey key = rpcLayer.encryptInPlace(data.data(), data.size(), messageKey);
+
+    // Reference: MTProto 2.0 with the client (x = 0) key part authKey[88:120]
+    const QByteArray expectedMessageKey = QCryptographicHash::hash(c_fullAuthKey.mid(88, 32) + plainData,
+                                                                   QCryptographicHash::Sha256).mid(8, 16);
+    QCOMPARE(QByteArray(messageKey, sizeof(messageKey)).toHex(), expectedMessageKey.toHex());
+
+    const QByteArray sha256_a = QCryptographicHash::hash(expectedMessageKey + c_fullAuthKey.mid(0, 36),
+                                                         QCryptographicHash::Sha256);
+    const QByteArray sha256_b = QCryptographicHash::hash(c_fullAuthKey.mid(40, 36) + expectedMessageKey,
+                                                         QCryptographicHash::Sha256);
+    const QByteArray expectedKey = sha256_a.left(8) + sha256_b.mid(8, 16) + sha256_a.mid(24, 8);
+    const QByteArray expectedIv = sha256_b.left(8) + sha256_a.mid(8, 16) + sha256_b.mid(24, 8);
+    QCOMPARE(QByteArray(key.key, sizeof(key.key)).toHex(), expectedKey.toHex());
+    QCOMPARE(QByteArray(key.iv, sizeof(key.iv)).toHex(), expectedIv.toHex());
+
+    QCOMPARE(data, Telegram::Crypto::aesEncrypt(plainData, key));
+}
+
+void tst_RpcLayer::packetCryptoAllocations()
+{
+#ifdef ALLOCATION_COUNTER_AVAILABLE
+    Telegram::Test::ServerRpcLayer serverLayer;
+    Telegram::Test::ClientRpcLayer clientLayer;
+    serverLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+    clientLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+    const Telegram::BaseRpcLayer::CryptoContext serverContext = serverLayer.cryptoContext();
+    const Telegram::BaseRpcLayer::CryptoContext clientContext = clientLayer.cryptoContext();
+
+    Telegram::MTProto::Message message;
+    message.messageId = 0x5b9fb3ff00000001ull;
+    message.sequenceNumber = 1;
+    message.setData(QByteArray(1024, 'x'));
+    Telegram::MTProto::FullMessageHeader header;
+    Telegram::MTProto::Message decryptedMessage;
+
+    // Warm up (e.g. the runtime CPU features detection and the random generator)
+    QByteArray packet = Telegram::BaseRpcLayer::encryptPacket(serverContext, message, 1234ull, 5678ull);
+    QVERIFY(Telegram::BaseRpcLayer::decryptPacket(clientContext, packet, &header, &decryptedMessage));
+
+    // The only allocation of each direction is the packet (or the decrypted data) buffer
+    int allocations = 0;
+    {
+        AllocationCounter counter;
+        packet = Telegram::BaseRpcLayer::encryptPacket(serverContext, message, 1234ull, 5678ull);
+        allocations = counter.stop();
+    }
+    QVERIFY(!packet.isEmpty());
+    QCOMPARE(allocations, 1);
+    bool decrypted = false;
+    {
+        AllocationCounter counter;
+        decrypted = Telegram::BaseRpcLayer::decryptPacket(clientContext, packet, &header, &decryptedMessage);
+        allocations = counter.stop();
+    }
+    QVERIFY(decrypted);
+    QCOMPARE(allocations, 1);
+    QCOMPARE(decryptedMessage.content(), message.data);
+#else
+    QSKIP("The allocation counter is not available on this platform or with the sanitizers");
+#endif
+}
+
+// A container of the queries wrapped in invokeWithLayer(initConnection(...))
+static Telegram::MTProto::Message getWrappedQueriesContainer(int count)
+{
+    using namespace Telegram;
+    MTProto::Stream output(MTProto::Stream::WriteOnly);
+    output << TLValue::MsgContainer;
+    output << quint32(count);
+    for (int i = 0; i < count; ++i) {
+        MTProto::Stream query(MTProto::Stream::WriteOnly);
+        query << TLValue::InvokeWithLayer;
+        query << TLValue::CurrentLayer;
+        query << TLValue::InitConnection;
+        query << quint32(14617); // appId
+        query << QStringLiteral("Desktop");
+        query << QStringLiteral("Linux 4.19");
+        query << QStringLiteral("0.2.0");
+        query << QStringLiteral("en");
+        query << QString(); // langPack
+        query << QStringLiteral("en");
+        query << TLValue::HelpGetConfig;
+
+        MTProto::MessageHeader header;
+        header.messageId = 0x5b9fb3ff00000000ull + static_cast<quint64>(i * 4);
+        header.sequenceNumber = static_cast<quint32>(i * 2 + 1);
+        header.contentLength = static_cast<quint32>(query.getData().size());
+        output << header;
+        output.writeBytes(query.getData());
+    }
+    MTProto::MessageHeader containerHeader;
+    containerHeader.messageId = 0x5b9fb3ff00000000ull + static_cast<quint64>(count * 4);
+    containerHeader.sequenceNumber = static_cast<quint32>(count * 2 + 2);
+    containerHeader.contentLength = static_cast<quint32>(output.getData().size());
+    return MTProto::Message(containerHeader, output.getData());
+}
+
+void tst_RpcLayer::unwrapMessageContainer()
+{
+    const Telegram::MTProto::Message container = getWrappedQueriesContainer(100);
+    Telegram::Test::UnwrappingRpcLayer rpcLayer;
+    QVERIFY(rpcLayer.processMTProtoMessage(container));
+    QCOMPARE(rpcLayer.queriesCount(), 100);
+
+    // The query references the container data
+    const Telegram::MTProto::Message query = rpcLayer.lastProcessedMessage();
+    QVERIFY(query.firstValue() == TLValue::HelpGetConfig);
+    QCOMPARE(query.dataSize, 4);
+    QVERIFY(query.data.constData() == container.data.constData());
+    QCOMPARE(query.dataOffset + query.dataSize, container.data.size());
+
+#ifdef ALLOCATION_COUNTER_AVAILABLE
+    AllocationCounter counter;
+    rpcLayer.processMTProtoMessage(container);
+    QCOMPARE(counter.stop(), 0);
+#endif
+
+    // A truncated container
+    const Telegram::MTProto::Message truncated(container, container.data.left(container.data.size() - 2));
+    QVERIFY(!rpcLayer.processMTProtoMessage(truncated));
+}
+
+void tst_RpcLayer::benchmarkUnwrapMessageContainer()
+{
+    const Telegram::MTProto::Message container = getWrappedQueriesContainer(100);
+    Telegram::Test::UnwrappingRpcLayer rpcLayer;
+    QBENCHMARK {
+        rpcLayer.processMTProtoMessage(container);
+    }
+    QVERIFY(rpcLayer.queriesCount() >= 100);
+}
+
+static QByteArray getConfigRequest()
+{
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << TLValue::HelpGetConfig;
+    return output.getData();
+}
+
+static void setupClientLayer(Telegram::Client::RpcLayer *rpcLayer, Telegram::Test::MTProtoSendHelper *sendHelper)
+{
+    sendHelper->setAuthKey(c_fullAuthKey);
+    sendHelper->setBaseTimestamp(1537207803787ull);
+    rpcLayer->setSendHelper(sendHelper);
+    rpcLayer->setSessionData(123456789ull, 1); // The connection is already initialized
+    rpcLayer->setServerSalt(3720780378715ull);
+}
+
+void tst_RpcLayer::clientMessageContainer()
+{
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setInFlightWindow(0); // All the RPCs go at once
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+
+    // A content related message to acknowledge
+    Telegram::MTProto::Message incomingMessage;
+    incomingMessage.messageId = 0x5b9fb3ff00000001ull;
+    incomingMessage.sequenceNumber = 1;
+    {
+        Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+        output << TLValue::MsgsAck;
+        output << TLVector<quint64>();
+        incomingMessage.setData(output.getData());
+    }
+    QVERIFY(clientLayer.processMTProtoMessage(incomingMessage));
+
+    constexpr int rpcCount = 100;
+    const QByteArray request = getConfigRequest();
+    for (int i = 0; i < rpcCount; ++i) {
+        clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(request, &operationsParent));
+    }
+    QCOMPARE(sentPackagesSpy.count(), 0);
+    clientLayer.flushSendQueue();
+
+    // The RPCs and the ack
+    constexpr int messagesCount = rpcCount + 1;
+    constexpr int maxMessages = Telegram::Client::RpcLayer::ContainerMaxMessages;
+    QCOMPARE(sentPackagesSpy.count(), (messagesCount + maxMessages - 1) / maxMessages);
+
+    // Unwrap the packets like the server
+    Telegram::Test::ServerRpcLayer serverLayer;
+    serverLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+    const Telegram::BaseRpcLayer::CryptoContext serverContext = serverLayer.cryptoContext();
+    Telegram::Test::UnwrappingRpcLayer unwrappingLayer;
+    for (const QList<QVariant> &arguments : sentPackagesSpy) {
+        Telegram::MTProto::FullMessageHeader header;
+        Telegram::MTProto::Message message;
+        QVERIFY(Telegram::BaseRpcLayer::decryptPacket(serverContext, arguments.first().toByteArray(),
+                                                      &header, &message));
+        QCOMPARE(header.sessionId, 123456789ull);
+        QVERIFY(message.firstValue() == TLValue::MsgContainer);
+        // The container is not content related
+        QCOMPARE(message.sequenceNumber % 2, 0u);
+        QVERIFY(unwrappingLayer.processMTProtoMessage(message));
+    }
+    QCOMPARE(unwrappingLayer.queriesCount(), messagesCount);
+    QVERIFY(unwrappingLayer.lastProcessedMessage().firstValue() == TLValue::MsgsAck);
+
+    // Nothing is left to send
+    clientLayer.flushSendQueue();
+    QCOMPARE(sentPackagesSpy.count(), (messagesCount + maxMessages - 1) / maxMessages);
+}
+
+void tst_RpcLayer::benchmarkClientSendRpc_data()
+{
+    QTest::addColumn<bool>("containers");
+    QTest::addColumn<int>("expectedPackets");
+
+    QTest::newRow("packet per rpc") << false << 100;
+    QTest::newRow("containers") << true << 2;
+}
+
+void tst_RpcLayer::benchmarkClientSendRpc()
+{
+    QFETCH(bool, containers);
+    QFETCH(int, expectedPackets);
+
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setMessageContainersEnabled(containers);
+    clientLayer.setInFlightWindow(0); // All the RPCs go at once
+
+    int packets = 0;
+    connect(&transport, &Telegram::Test::Transport::packetSent, [&packets]() { ++packets; });
+
+    const QByteArray request = getConfigRequest();
+    QVector<Telegram::Client::PendingRpcOperation *> operations;
+    for (int i = 0; i < 100; ++i) {
+        operations.append(new Telegram::Client::PendingRpcOperation(request, &operationsParent));
+    }
+
+    QBENCHMARK {
+        packets = 0;
+        for (Telegram::Client::PendingRpcOperation *operation : operations) {
+            clientLayer.sendRpc(operation);
+        }
+        clientLayer.flushSendQueue();
+        clientLayer.onConnectionLost(QVariantHash()); // Drop the sent messages
+    }
+    QCOMPARE(packets, expectedPackets);
+}
+
+static Telegram::MTProto::Message decryptClientPacket(const QByteArray &packet)
+{
+    Telegram::Test::ServerRpcLayer serverLayer;
+    serverLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+    Telegram::MTProto::FullMessageHeader header;
+    Telegram::MTProto::Message message;
+    Telegram::BaseRpcLayer::decryptPacket(serverLayer.cryptoContext(), packet, &header, &message);
+    return message;
+}
+
+static Telegram::MTProto::Message getServerMessage(quint64 messageId, quint32 sequenceNumber,
+                                                   TLValue type, const QVector<quint64> &ids)
+{
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << type;
+    output << TLVector<quint64>(ids);
+    Telegram::MTProto::Message message;
+    message.messageId = messageId;
+    message.sequenceNumber = sequenceNumber;
+    message.setData(output.getData());
+    return message;
+}
+
+void tst_RpcLayer::clientRetransmissionBuffer()
+{
+    using MessageState = Telegram::Client::RpcLayer::MessageState;
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setMessageContainersEnabled(false);
+    clientLayer.setCompressionLevel(0); // Keep the big requests big
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+
+    const QByteArray request = getConfigRequest();
+    QVector<quint64> sentIds;
+    for (int i = 0; i < 3; ++i) {
+        sentIds.append(clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(request, &operationsParent)));
+    }
+    QCOMPARE(clientLayer.retransmissionBufferCount(), 3);
+    QCOMPARE(clientLayer.retransmissionBufferBytes(), request.size() * 3);
+    QVERIFY(clientLayer.messageState(sentIds.at(0)) == MessageState::Sent);
+
+    // The ack releases the body
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+    QVERIFY(clientLayer.processMTProtoMessage(getServerMessage(serverMessageId, 0, TLValue::MsgsAck,
+                                                               { sentIds.at(0) })));
+    QVERIFY(clientLayer.messageState(sentIds.at(0)) == MessageState::Acked);
+    QCOMPARE(clientLayer.retransmissionBufferCount(), 2);
+
+    // The result releases the message
+    {
+        Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+        output << TLValue::RpcResult;
+        output << sentIds.at(1);
+        output << TLValue::BoolTrue;
+        Telegram::MTProto::Message result;
+        serverMessageId += 4;
+        result.messageId = serverMessageId;
+        result.sequenceNumber = 1;
+        result.setData(output.getData());
+        QVERIFY(clientLayer.processMTProtoMessage(result));
+    }
+    QVERIFY(clientLayer.messageState(sentIds.at(1)) == MessageState::Unknown);
+    QCOMPARE(clientLayer.retransmissionBufferCount(), 1);
+    QCOMPARE(clientLayer.retransmissionBufferBytes(), request.size());
+
+    // The server asks to resend the messages: the held one goes again under its id,
+    // the answered one gets its state
+    sentPackagesSpy.clear();
+    serverMessageId += 4;
+    QVERIFY(clientLayer.processMTProtoMessage(getServerMessage(serverMessageId, 2, TLValue::MsgResendReq,
+                                                               { sentIds.at(2), sentIds.at(1) })));
+    QCOMPARE(sentPackagesSpy.count(), 2);
+    {
+        const Telegram::MTProto::Message resentMessage = decryptClientPacket(sentPackagesSpy.at(0).first().toByteArray());
+        QCOMPARE(resentMessage.messageId, sentIds.at(2));
+        QCOMPARE(resentMessage.content(), request);
+    }
+    {
+        const Telegram::MTProto::Message allInfo = decryptClientPacket(sentPackagesSpy.at(1).first().toByteArray());
+        Telegram::MTProto::Stream stream(allInfo.data, allInfo.dataOffset, allInfo.dataSize);
+        TLValue value;
+        TLVector<quint64> ids;
+        QByteArray info;
+        stream >> value;
+        stream >> ids;
+        stream >> info;
+        QVERIFY(value == TLValue::MsgsAllInfo);
+        QCOMPARE(ids.count(), 1);
+        QCOMPARE(ids.first(), sentIds.at(1));
+        QCOMPARE(info.size(), 1);
+    }
+    QVERIFY(clientLayer.messageState(sentIds.at(2)) == MessageState::Sent);
+    QCOMPARE(clientLayer.retransmissionBufferCount(), 1);
+
+    // The server asks about its messages
+    sentPackagesSpy.clear();
+    serverMessageId += 4;
+    QVERIFY(clientLayer.processMTProtoMessage(getServerMessage(serverMessageId, 2, TLValue::MsgsStateReq,
+                                                               { 0x5b9fb3ff00000001ull, serverMessageId + 4 })));
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    {
+        Telegram::Test::ServerRpcLayer serverLayer;
+        serverLayer.sendHelper()->setAuthKey(c_fullAuthKey);
+        Telegram::MTProto::FullMessageHeader header;
+        Telegram::MTProto::Message stateInfo;
+        QVERIFY(Telegram::BaseRpcLayer::decryptPacket(serverLayer.cryptoContext(),
+                                                      sentPackagesSpy.first().first().toByteArray(),
+                                                      &header, &stateInfo));
+        Telegram::MTProto::Stream stream(stateInfo.data, stateInfo.dataOffset, stateInfo.dataSize);
+        TLValue value;
+        quint64 requestId;
+        QByteArray info;
+        stream >> value;
+        stream >> requestId;
+        stream >> info;
+        QVERIFY(value == TLValue::MsgsStateInfo);
+        QCOMPARE(requestId, serverMessageId);
+        QCOMPARE(info, QByteArray::fromHex("0c03")); // Received and acked; not received yet
+    }
+
+    // The bodies of the old messages are released over the limit
+    const QByteArray bigRequest = request + QByteArray(Telegram::Client::RpcLayer::RetransmissionBufferMaxBytes / 4, 'x');
+    for (int i = 0; i < 8; ++i) {
+        clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(bigRequest, &operationsParent));
+    }
+    QVERIFY(clientLayer.retransmissionBufferBytes() <= Telegram::Client::RpcLayer::RetransmissionBufferMaxBytes);
+    QVERIFY(clientLayer.retransmissionBufferCount() < 8);
+}
+
+void tst_RpcLayer::clientResendReleasedMessage()
+{
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    CAppInformation appInfo;
+    appInfo.setAppId(14617);
+    appInfo.setAppHash(QLatin1String("e17ac360fd072f83d5d08db45ce9a121"));
+    appInfo.setAppVersion(QLatin1String("0.1"));
+    appInfo.setDeviceInfo(QLatin1String("pc"));
+    appInfo.setOsInfo(QLatin1String("GNU/Linux"));
+    appInfo.setLanguageCode(QLatin1String("en"));
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setAppInformation(&appInfo);
+    clientLayer.setSessionData(123456789ull, 0); // The first RPC initializes the connection
+    clientLayer.setMessageContainersEnabled(false);
+    clientLayer.setCompressionLevel(0);
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+
+    const QByteArray request = getConfigRequest();
+    const QByteArray bigRequest = request + QByteArray(Telegram::Client::RpcLayer::RetransmissionBufferMaxBytes / 4, 'x');
+    const auto releaseOldBodies = [&]() {
+        for (int i = 0; i < 8; ++i) {
+            clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(bigRequest, &operationsParent));
+        }
+    };
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+    const auto requestResend = [&](quint64 messageId) {
+        sentPackagesSpy.clear();
+        serverMessageId += 4;
+        clientLayer.processMTProtoMessage(getServerMessage(serverMessageId, 2, TLValue::MsgResendReq,
+                                                           { messageId }));
+    };
+
+    Telegram::Client::PendingRpcOperation *initOperation = new Telegram::Client::PendingRpcOperation(request, &operationsParent);
+    quint64 initMessageId = clientLayer.sendRpc(initOperation);
+    connect(initOperation, &Telegram::Client::PendingRpcOperation::resent,
+            [&initMessageId](quint64, quint64 newMessageId) { initMessageId = newMessageId; });
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    const Telegram::MTProto::Message initMessage = decryptClientPacket(sentPackagesSpy.first().first().toByteArray());
+    QVERIFY(initMessage.firstValue() == TLValue::InvokeWithLayer);
+    const quint64 bigMessageId = clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(bigRequest, &operationsParent));
+    releaseOldBodies();
+
+    // The released first message goes again with the initConnection wrapper, even twice
+    for (int i = 0; i < 2; ++i) {
+        const quint64 previousMessageId = initMessageId;
+        requestResend(previousMessageId);
+        QCOMPARE(sentPackagesSpy.count(), 1);
+        QVERIFY(initMessageId != previousMessageId);
+        const Telegram::MTProto::Message resentMessage = decryptClientPacket(sentPackagesSpy.first().first().toByteArray());
+        QVERIFY(resentMessage.firstValue() == TLValue::InvokeWithLayer);
+        QCOMPARE(resentMessage.content(), initMessage.content());
+        releaseOldBodies();
+    }
+
+    // The other released messages go as is
+    requestResend(bigMessageId);
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(decryptClientPacket(sentPackagesSpy.first().first().toByteArray()).content(), bigRequest);
+}
+
+static QByteArray getImportContactsRequest(int count)
+{
+    TLVector<TLInputContact> contacts;
+    contacts.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        TLInputContact contact;
+        contact.tlType = TLValue::InputPhoneContact;
+        contact.clientId = static_cast<quint64>(i);
+        contact.phone = QStringLiteral("+7900%1").arg(1000000 + i);
+        contact.firstName = QStringLiteral("Contact %1").arg(i);
+        contact.lastName = QStringLiteral("Lastname");
+        contacts.append(contact);
+    }
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << TLValue::ContactsImportContacts;
+    output << contacts;
+    return output.getData();
+}
+
+static QByteArray getSaveFilePartRequest(int size)
+{
+    QByteArray bytes(size, Qt::Uninitialized);
+    quint32 state = 0x12345678u; // xorshift32
+    for (char &byte : bytes) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        byte = static_cast<char>(state);
+    }
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << TLValue::UploadSaveFilePart;
+    output << quint64(1); // File id
+    output << quint32(0); // File part
+    output << bytes;
+    return output.getData();
+}
+
+void tst_RpcLayer::clientRequestCompression()
+{
+    using Statistics = Telegram::Client::RpcLayer::RequestCompressionStatistics;
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setMessageContainersEnabled(false);
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+
+    // The small requests go as is
+    clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent));
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray()).content(), getConfigRequest());
+
+    // The contacts are packed and the unpacked content is the original request
+    const QByteArray importRequest = getImportContactsRequest(500);
+    clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(importRequest, &operationsParent));
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    const QByteArray importPacket = sentPackagesSpy.takeFirst().first().toByteArray();
+    QVERIFY(importPacket.size() < importRequest.size() / 2);
+    QCOMPARE(decryptClientPacket(importPacket).content(), importRequest);
+    Statistics statistics = clientLayer.requestCompressionStatistics(TLValue::ContactsImportContacts);
+    QCOMPARE(statistics.packedCount, 1u);
+    QCOMPARE(statistics.rawCount, 0u);
+    QVERIFY(statistics.packedBytes * 2 < statistics.probedBytes);
+
+    // The high-entropy data is not even probed
+    const QByteArray filePartRequest = getSaveFilePartRequest(16 * 1024);
+    clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(filePartRequest, &operationsParent));
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray()).content(), filePartRequest);
+    statistics = clientLayer.requestCompressionStatistics(TLValue::UploadSaveFilePart);
+    QCOMPARE(statistics.packedCount, 0u);
+    QCOMPARE(statistics.rawCount, 1u);
+    QCOMPARE(statistics.probedBytes, 0ull);
+
+    // The packed requests are unpacked from a container as well
+    clientLayer.setMessageContainersEnabled(true);
+    clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent));
+    clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(importRequest, &operationsParent));
+    clientLayer.flushSendQueue();
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    const Telegram::MTProto::Message container = decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray());
+    QVERIFY(container.firstValue() == TLValue::MsgContainer);
+    Telegram::Test::UnwrappingRpcLayer unwrappingLayer;
+    QVERIFY(unwrappingLayer.processMTProtoMessage(container));
+    QCOMPARE(unwrappingLayer.queriesCount(), 2);
+    QCOMPARE(unwrappingLayer.lastProcessedMessage().content(), importRequest);
+    QCOMPARE(clientLayer.requestCompressionStatistics(TLValue::ContactsImportContacts).packedCount, 2u);
+}
+
+void tst_RpcLayer::benchmarkClientRequestCompression_data()
+{
+    QTest::addColumn<int>("compressionLevel");
+
+    QTest::newRow("raw") << 0;
+    QTest::newRow("gzip fastest") << 1;
+    QTest::newRow("gzip default") << 6;
+}
+
+void tst_RpcLayer::benchmarkClientRequestCompression()
+{
+    QFETCH(int, compressionLevel);
+
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setCompressionLevel(compressionLevel);
+
+    int bytesOnWire = 0;
+    connect(&transport, &Telegram::Test::Transport::packetSent, [&bytesOnWire](const QByteArray &packet) {
+        bytesOnWire += packet.size();
+    });
+
+    const QByteArray request = getImportContactsRequest(5000);
+    Telegram::Client::PendingRpcOperation *operation
+            = new Telegram::Client::PendingRpcOperation(request, &operationsParent);
+    QBENCHMARK {
+        bytesOnWire = 0;
+        clientLayer.sendRpc(operation);
+        clientLayer.flushSendQueue();
+        clientLayer.onConnectionLost(QVariantHash()); // Drop the sent message
+    }
+    qDebug().nospace() << "Import of 5000 contacts: " << request.size() << " bytes of the request, "
+                       << bytesOnWire << " bytes on the wire";
+    QVERIFY(bytesOnWire > 0);
+    if (compressionLevel) {
+        QVERIFY(bytesOnWire < request.size() / 2);
+    }
+}
+
+// Any content related message needs the ack
+static void receiveContentRelatedMessages(Telegram::Client::RpcLayer *clientLayer, quint64 *messageId, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        clientLayer->processMTProtoMessage(getServerMessage(*messageId, 1, TLValue::MsgsAck, { }));
+        *messageId += 4;
+    }
+}
+
+static QVector<quint64> getAcknowledgedIds(const Telegram::MTProto::Message &message)
+{
+    Telegram::MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
+    TLValue value;
+    TLVector<quint64> ids;
+    stream >> value;
+    stream >> ids;
+    if (value != TLValue::MsgsAck) {
+        return { };
+    }
+    return ids;
+}
+
+void tst_RpcLayer::clientAckScheduling()
+{
+    using RpcLayer = Telegram::Client::RpcLayer;
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setAckDelay(50);
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+
+    // The acks go with the next RPC
+    receiveContentRelatedMessages(&clientLayer, &serverMessageId, 10);
+    QCOMPARE(clientLayer.pendingAcksCount(), 10);
+    clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent));
+    clientLayer.flushSendQueue();
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(clientLayer.pendingAcksCount(), 0);
+    {
+        const Telegram::MTProto::Message container = decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray());
+        QVERIFY(container.firstValue() == TLValue::MsgContainer);
+        Telegram::Test::UnwrappingRpcLayer unwrappingLayer;
+        QVERIFY(unwrappingLayer.processMTProtoMessage(container));
+        QCOMPARE(unwrappingLayer.queriesCount(), 2);
+        QCOMPARE(getAcknowledgedIds(unwrappingLayer.lastProcessedMessage()).count(), 10);
+    }
+
+    // The acks are sent alone after the delay
+    receiveContentRelatedMessages(&clientLayer, &serverMessageId, 3);
+    QCOMPARE(sentPackagesSpy.count(), 0);
+    QTRY_COMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(getAcknowledgedIds(decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray())).count(), 3);
+    QCOMPARE(clientLayer.pendingAcksCount(), 0);
+
+    // The acks are sent right away on the threshold
+    clientLayer.setAckDelay(60 * 1000);
+    clientLayer.setAckThreshold(5);
+    receiveContentRelatedMessages(&clientLayer, &serverMessageId, 5);
+    QCOMPARE(sentPackagesSpy.count(), 0);
+    QCoreApplication::processEvents();
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(getAcknowledgedIds(decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray())).count(), 5);
+
+    // A msgs_ack never exceeds the limit
+    constexpr int maxAcks = RpcLayer::AckMaxMessages;
+    clientLayer.setAckThreshold(maxAcks * 2);
+    QCOMPARE(clientLayer.ackThreshold(), maxAcks);
+    const int messagesCount = maxAcks + 100;
+    receiveContentRelatedMessages(&clientLayer, &serverMessageId, messagesCount);
+    QCOMPARE(clientLayer.pendingAcksCount(), messagesCount);
+    clientLayer.acknowledgeMessages();
+    QCOMPARE(sentPackagesSpy.count(), 2);
+    QCOMPARE(getAcknowledgedIds(decryptClientPacket(sentPackagesSpy.at(0).first().toByteArray())).count(), maxAcks);
+    QCOMPARE(getAcknowledgedIds(decryptClientPacket(sentPackagesSpy.at(1).first().toByteArray())).count(), 100);
+
+    // The acks of a lost connection are dropped
+    sentPackagesSpy.clear();
+    clientLayer.setAckDelay(50);
+    receiveContentRelatedMessages(&clientLayer, &serverMessageId, 3);
+    clientLayer.onConnectionLost(QVariantHash());
+    QCOMPARE(clientLayer.pendingAcksCount(), 0);
+    QTest::qWait(100);
+    QCOMPARE(sentPackagesSpy.count(), 0);
+}
+
+static Telegram::MTProto::Message getBadServerSaltMessage(quint64 messageId, quint64 badMessageId)
+{
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << TLValue::BadServerSalt;
+    output << badMessageId;
+    output << quint32(0); // Bad message seqno
+    output << quint32(Telegram::MTProto::IgnoredMessageNotification::IncorrectServerSalt);
+    output << quint64(3720780378716ull);
+    Telegram::MTProto::Message message;
+    message.messageId = messageId;
+    message.sequenceNumber = 2;
+    message.setData(output.getData());
+    return message;
+}
+
+void tst_RpcLayer::clientRestoreIgnoredAcks()
+{
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setAckDelay(60 * 1000);
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+
+    // The acks go in the container of the RPC
+    receiveContentRelatedMessages(&clientLayer, &serverMessageId, 5);
+    clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent));
+    clientLayer.flushSendQueue();
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(clientLayer.pendingAcksCount(), 0);
+    const Telegram::MTProto::Message container = decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray());
+    QVERIFY(container.firstValue() == TLValue::MsgContainer);
+
+    // The server ignores the container, so the acks go again with the resent RPC
+    QVERIFY(clientLayer.processMTProtoMessage(getBadServerSaltMessage(serverMessageId, container.messageId)));
+    serverMessageId += 4;
+    QCOMPARE(clientLayer.pendingAcksCount(), 5);
+    clientLayer.flushSendQueue();
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(clientLayer.pendingAcksCount(), 0);
+    {
+        Telegram::Test::UnwrappingRpcLayer unwrappingLayer;
+        QVERIFY(unwrappingLayer.processMTProtoMessage(decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray())));
+        QCOMPARE(unwrappingLayer.queriesCount(), 2);
+        QCOMPARE(getAcknowledgedIds(unwrappingLayer.lastProcessedMessage()).count(), 5);
+    }
+
+    // An ignored msgs_ack sent alone is restored too
+    receiveContentRelatedMessages(&clientLayer, &serverMessageId, 3);
+    clientLayer.acknowledgeMessages();
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    const Telegram::MTProto::Message ackMessage = decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray());
+    QCOMPARE(getAcknowledgedIds(ackMessage).count(), 3);
+    QVERIFY(clientLayer.processMTProtoMessage(getBadServerSaltMessage(serverMessageId, ackMessage.messageId)));
+    QCOMPARE(clientLayer.pendingAcksCount(), 3);
+    clientLayer.acknowledgeMessages();
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(getAcknowledgedIds(decryptClientPacket(sentPackagesSpy.takeFirst().first().toByteArray())).count(), 3);
+}
+
+void tst_RpcLayer::benchmarkClientAckBurst_data()
+{
+    QTest::addColumn<int>("ackThreshold");
+    QTest::addColumn<int>("maxPackets");
+
+    // The updates come one per packet and the event loop runs between them
+    QTest::newRow("ack per packet") << 1 << 1000;
+    QTest::newRow("coalesced") << 64 << 16;
+}
+
+void tst_RpcLayer::benchmarkClientAckBurst()
+{
+    QFETCH(int, ackThreshold);
+    QFETCH(int, maxPackets);
+
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setAckThreshold(ackThreshold);
+    clientLayer.setAckDelay(60 * 1000); // Only the threshold triggers the acks during the burst
+
+    int packets = 0;
+    connect(&transport, &Telegram::Test::Transport::packetSent, [&packets]() { ++packets; });
+
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+    QBENCHMARK {
+        packets = 0;
+        for (int i = 0; i < 1000; ++i) {
+            receiveContentRelatedMessages(&clientLayer, &serverMessageId, 1);
+            QCoreApplication::processEvents();
+        }
+        clientLayer.acknowledgeMessages(); // The rest goes after the delay
+    }
+    qDebug().nospace() << "Sent " << packets << " packets to ack 1000 updates";
+    QCOMPARE(clientLayer.pendingAcksCount(), 0);
+    QVERIFY(packets <= maxPackets);
+}
+
+static QByteArray getMethodRequest(TLValue method)
+{
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << method;
+    return output.getData();
+}
+
+// Answers the oldest sent RPC like a server processing the requests one by one
+static quint64 answerFirstRpc(Telegram::Client::RpcLayer *clientLayer, QList<QList<QVariant>> *sentPackets,
+                              quint64 *serverMessageId)
+{
+    if (sentPackets->isEmpty()) {
+        return 0;
+    }
+    const quint64 requestId = decryptClientPacket(sentPackets->takeFirst().first().toByteArray()).messageId;
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << TLValue::RpcResult;
+    output << requestId;
+    output << TLValue::BoolTrue;
+    Telegram::MTProto::Message result;
+    result.messageId = *serverMessageId;
+    result.sequenceNumber = 1;
+    result.setData(output.getData());
+    *serverMessageId += 4;
+    clientLayer->processMTProtoMessage(result);
+    return requestId;
+}
+
+void tst_RpcLayer::clientRequestPriorities()
+{
+    using Priority = Telegram::Client::PendingRpcOperation::Priority;
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setMessageContainersEnabled(false);
+    clientLayer.setInFlightWindow(8); // Up to 6 normal and 4 bulk RPCs
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+
+    QVERIFY(clientLayer.methodPriority(TLValue::MessagesSendMessage) == Priority::Interactive);
+    QVERIFY(clientLayer.methodPriority(TLValue::HelpGetConfig) == Priority::Normal);
+    QVERIFY(clientLayer.methodPriority(TLValue::MessagesGetHistory) == Priority::Bulk);
+
+    // The bulk RPCs take the half of the window
+    QVector<Telegram::Client::PendingRpcOperation *> bulkOperations;
+    for (int i = 0; i < 10; ++i) {
+        bulkOperations.append(new Telegram::Client::PendingRpcOperation(getMethodRequest(TLValue::MessagesGetHistory),
+                                                                        &operationsParent));
+        const quint64 messageId = clientLayer.sendRpc(bulkOperations.last());
+        QCOMPARE(messageId != 0, i < 4);
+    }
+    QCOMPARE(clientLayer.inFlightCount(), 4);
+    QCOMPARE(clientLayer.queuedRpcCount(), 6);
+
+    // The other RPCs overtake them
+    QVERIFY(clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent)));
+    QVERIFY(clientLayer.sendRpc(new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent)));
+    QCOMPARE(clientLayer.inFlightCount(), 6);
+
+    // The normal RPCs leave the rest of the window to the interactive ones
+    Telegram::Client::PendingRpcOperation *normalOperation
+            = new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent);
+    QCOMPARE(clientLayer.sendRpc(normalOperation), 0ull);
+    Telegram::Client::PendingRpcOperation *interactiveOperation
+            = new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent);
+    interactiveOperation->setPriority(Priority::Interactive);
+    QVERIFY(clientLayer.sendRpc(interactiveOperation));
+    QCOMPARE(clientLayer.inFlightCount(), 7);
+    QCOMPARE(sentPackagesSpy.count(), 7);
+
+    // The answers free the room for the queued normal RPC first
+    answerFirstRpc(&clientLayer, &sentPackagesSpy, &serverMessageId);
+    QVERIFY(bulkOperations.first()->isFinished());
+    QCOMPARE(clientLayer.inFlightCount(), 6);
+    QCOMPARE(clientLayer.queuedRpcCount(), 7);
+    answerFirstRpc(&clientLayer, &sentPackagesSpy, &serverMessageId);
+    QCOMPARE(clientLayer.inFlightCount(), 6);
+    QCOMPARE(clientLayer.queuedRpcCount(), 6);
+    QCOMPARE(sentPackagesSpy.count(), 6);
+
+    // The bulk RPCs go when the window has a spare room
+    while (answerFirstRpc(&clientLayer, &sentPackagesSpy, &serverMessageId)) {
+        QVERIFY(clientLayer.inFlightCount() <= 8);
+    }
+    QCOMPARE(clientLayer.inFlightCount(), 0);
+    QCOMPARE(clientLayer.queuedRpcCount(), 0);
+    QVERIFY(normalOperation->isFinished());
+    QVERIFY(interactiveOperation->isFinished());
+    for (const Telegram::Client::PendingRpcOperation *operation : bulkOperations) {
+        QVERIFY(operation->isSucceeded());
+    }
+
+    // The queued RPCs fail on the connection lost
+    clientLayer.setInFlightWindow(2);
+    Telegram::Client::PendingRpcOperation *queuedOperation = nullptr;
+    for (int i = 0; i < 3; ++i) {
+        queuedOperation = new Telegram::Client::PendingRpcOperation(getConfigRequest(), &operationsParent);
+        clientLayer.sendRpc(queuedOperation);
+    }
+    QCOMPARE(clientLayer.queuedRpcCount(), 1);
+    clientLayer.onConnectionLost(QVariantHash());
+    QVERIFY(queuedOperation->isFinished());
+    QVERIFY(!queuedOperation->isSucceeded());
+    QCOMPARE(clientLayer.queuedRpcCount(), 0);
+}
+
+void tst_RpcLayer::clientDeletedQueuedRpc()
+{
+    using PendingRpcOperation = Telegram::Client::PendingRpcOperation;
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setMessageContainersEnabled(false);
+    clientLayer.setInFlightWindow(2);
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+
+    QVector<PendingRpcOperation *> operations;
+    for (int i = 0; i < 5; ++i) {
+        operations.append(new PendingRpcOperation(getConfigRequest(), &operationsParent));
+        clientLayer.sendRpc(operations.last());
+    }
+    QCOMPARE(sentPackagesSpy.count(), 2);
+    QCOMPARE(clientLayer.queuedRpcCount(), 3);
+
+    // The deleted operations leave the queue
+    delete operations.at(2);
+    delete operations.at(3);
+    QCOMPARE(clientLayer.queuedRpcCount(), 1);
+
+    // The window opens for the alive operation only
+    answerFirstRpc(&clientLayer, &sentPackagesSpy, &serverMessageId);
+    QCOMPARE(sentPackagesSpy.count(), 2);
+    QCOMPARE(clientLayer.inFlightCount(), 2);
+    QCOMPARE(clientLayer.queuedRpcCount(), 0);
+    while (answerFirstRpc(&clientLayer, &sentPackagesSpy, &serverMessageId)) {
+    }
+    QVERIFY(operations.at(4)->isSucceeded());
+    QCOMPARE(clientLayer.inFlightCount(), 0);
+    {
+        // The reply is the span of the rpc_result after the constructor and the request id
+        Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+        output << TLValue::BoolTrue;
+        QCOMPARE(operations.at(4)->replyOffset(), 12);
+        QCOMPARE(operations.at(4)->replyData(), output.getData());
+    }
+
+    // The connection lost skips the deleted operations
+    operations.clear();
+    for (int i = 0; i < 3; ++i) {
+        operations.append(new PendingRpcOperation(getConfigRequest(), &operationsParent));
+        clientLayer.sendRpc(operations.last());
+    }
+    QCOMPARE(clientLayer.queuedRpcCount(), 1);
+    delete operations.last();
+    QCOMPARE(clientLayer.queuedRpcCount(), 0);
+    clientLayer.onConnectionLost(QVariantHash());
+    QVERIFY(operations.first()->isFinished());
+}
+
+void tst_RpcLayer::clientIgnoredRpcReleasesWindow()
+{
+    using PendingRpcOperation = Telegram::Client::PendingRpcOperation;
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setMessageContainersEnabled(false);
+    clientLayer.setInFlightWindow(1);
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+
+    PendingRpcOperation *ignoredOperation = new PendingRpcOperation(getConfigRequest(), &operationsParent);
+    const quint64 ignoredMessageId = clientLayer.sendRpc(ignoredOperation);
+    QVERIFY(ignoredMessageId);
+    PendingRpcOperation *queuedOperation = new PendingRpcOperation(getConfigRequest(), &operationsParent);
+    QCOMPARE(clientLayer.sendRpc(queuedOperation), 0ull);
+    QCOMPARE(sentPackagesSpy.count(), 1);
+    QCOMPARE(clientLayer.queuedRpcCount(), 1);
+
+    // The error is not resolved by a resend, so the operation fails and the next RPC takes its slot
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << TLValue::BadMsgNotification;
+    output << ignoredMessageId;
+    output << quint32(1); // Bad message seqno
+    output << quint32(Telegram::MTProto::IgnoredMessageNotification::MessageIdTooHigh);
+    Telegram::MTProto::Message notification;
+    notification.messageId = 0x5b9fb3ff00000001ull;
+    notification.sequenceNumber = 2;
+    notification.setData(output.getData());
+    QVERIFY(!clientLayer.processMTProtoMessage(notification));
+
+    QVERIFY(ignoredOperation->isFinished());
+    QVERIFY(!ignoredOperation->isSucceeded());
+    QCOMPARE(sentPackagesSpy.count(), 2);
+    QCOMPARE(clientLayer.inFlightCount(), 1);
+    QCOMPARE(clientLayer.queuedRpcCount(), 0);
+    QCOMPARE(clientLayer.retransmissionBufferCount(), 1);
+    QVERIFY(!queuedOperation->isFinished());
+}
+
+void tst_RpcLayer::clientSendMessageLatency_data()
+{
+    QTest::addColumn<int>("inFlightWindow");
+    QTest::addColumn<int>("maxAnswers");
+
+    // The number of the server answers before the sendMessage one
+    QTest::newRow("unlimited") << 0 << 501;
+    QTest::newRow("default window") << int(Telegram::Client::RpcLayer::DefaultInFlightWindow)
+                                    << Telegram::Client::RpcLayer::DefaultInFlightWindow / 2 + 1;
+}
+
+void tst_RpcLayer::clientSendMessageLatency()
+{
+    QFETCH(int, inFlightWindow);
+    QFETCH(int, maxAnswers);
+    constexpr int historyRequests = 500;
+
+    QObject operationsParent;
+    Telegram::Test::Transport transport;
+    Telegram::Test::MTProtoSendHelper sendHelper(&transport);
+    Telegram::Client::RpcLayer clientLayer;
+    setupClientLayer(&clientLayer, &sendHelper);
+    clientLayer.setMessageContainersEnabled(false);
+    clientLayer.setInFlightWindow(inFlightWindow);
+    QSignalSpy sentPackagesSpy(&transport, &Telegram::Test::Transport::packetSent);
+    quint64 serverMessageId = 0x5b9fb3ff00000001ull;
+
+    int historyAnswers = 0;
+    for (int i = 0; i < historyRequests; ++i) {
+        Telegram::Client::PendingRpcOperation *operation
+                = new Telegram::Client::PendingRpcOperation(getMethodRequest(TLValue::MessagesGetHistory),
+                                                            &operationsParent);
+        connect(operation, &Telegram::PendingOperation::finished, [&historyAnswers]() { ++historyAnswers; });
+        clientLayer.sendRpc(operation);
+    }
+    Telegram::Client::PendingRpcOperation *sendMessageOperation
+            = new Telegram::Client::PendingRpcOperation(getMethodRequest(TLValue::MessagesSendMessage),
+                                                        &operationsParent);
+    clientLayer.sendRpc(sendMessageOperation);
+
+    QElapsedTimer timer;
+    timer.start();
+    int answers = 0;
+    while (!sendMessageOperation->isFinished()) {
+        QVERIFY(answerFirstRpc(&clientLayer, &sentPackagesSpy, &serverMessageId));
+        ++answers;
+    }
+    qDebug().nospace() << "sendMessage is answered after " << answers << " answers in " << timer.nsecsElapsed() << " ns";
+    QVERIFY(answers <= maxAnswers);
+
+    // The history requests are done as well
+    while (answerFirstRpc(&clientLayer, &sentPackagesSpy, &serverMessageId)) {
+    }
+    QCOMPARE(historyAnswers, historyRequests);
 }
 
-QTEST_APPLESS_MAIN(tst_RpcLayer)
+QTEST_GUILESS_MAIN(tst_RpcLayer)
 
 #include "tst_RpcLayer.moc"
@@ -30,6 +30,7 @@ private slots:
     void basic();
     void lvalues();
     void rvalues();
+    void constNullAccess();
 };
 
 struct TestClass
@@ -219,6 +220,23 @@ void tst_UniqueLazyPointer::rvalues()
     QCOMPARE(TestClass::destructionCounter, 1);
 }
 
+void tst_UniqueLazyPointer::constNullAccess()
+{
+    const TestClassPtr nullPtr;
+    // Const access must not allocate and reads the default value
+    QCOMPARE(nullPtr->member, 0);
+    QCOMPARE((*nullPtr).member, 0);
+    QVERIFY(nullPtr.isNull());
+
+    TestClassPtr dataPtr;
+    const TestClassPtr &constRef = dataPtr;
+    QCOMPARE(constRef->member, 0);
+    QVERIFY(dataPtr.isNull());
+    dataPtr->member = 3;
+    QCOMPARE(constRef->member, 3);
+    QCOMPARE(nullPtr->member, 0);
+}
+
 QTEST_APPLESS_MAIN(tst_UniqueLazyPointer)
 
 #include "tst_UniqueLazyPointer.moc"
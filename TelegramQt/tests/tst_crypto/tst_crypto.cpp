@@ -17,16 +17,41 @@
 
 #include <QObject>
 #include <QTest>
+#include <QVector>
 
+#include "Crypto/Aes.hpp"
 #include "Crypto/AesCtr.hpp"
 
+#include <openssl/aes.h>
+
 class tst_crypto : public QObject
 {
     Q_OBJECT
 private slots:
     void aesCtrContext();
+    void aesCtrInPlace();
+    void benchmarkAesCtr_data();
+    void benchmarkAesCtr();
+    void aesIge_data();
+    void aesIge();
+    void benchmarkAesIge_data();
+    void benchmarkAesIge();
+    void aesIgeBatch_data();
+    void aesIgeBatch();
+    void aesIgeBatchInvalidBuffer_data();
+    void aesIgeBatchInvalidBuffer();
+    void benchmarkAesIgeBatch_data();
+    void benchmarkAesIgeBatch();
 };
 
+using Telegram::Crypto::AesIgeEngine;
+
+Q_DECLARE_METATYPE(AesIgeEngine)
+
+static const QByteArray c_aesCtrKey = QByteArray::fromHex(QByteArrayLiteral("452114b9fbd4a919a27a256821dd1e72"
+                                                                            "13c562f26f94883c4c7449b74fc8fb96"));
+static const QByteArray c_aesCtrIv = QByteArray::fromHex(QByteArrayLiteral("d4c0727f2043d69fcc94eb639cc9486a"));
+
 void tst_crypto::aesCtrContext()
 {
     const QByteArray key = QByteArray::fromHex(QByteArrayLiteral("452114b9fbd4a919a27a256821dd1e72"
@@ -93,6 +118,329 @@ void tst_crypto::aesCtrContext()
     QCOMPARE(words.toHex(), (decrypted31 + decrypted32).toHex());
 }
 
+void tst_crypto::aesCtrInPlace()
+{
+    Telegram::Crypto::AesCtrContext copyContext;
+    copyContext.setKey(c_aesCtrKey);
+    copyContext.setIVec(c_aesCtrIv);
+    Telegram::Crypto::AesCtrContext inPlaceContext = copyContext;
+
+    // Odd sizes check that the partial block state is carried between calls
+    const QVector<int> sizes = { 1, 15, 16, 17, 64, 1000, 4096 };
+    for (const int size : sizes) {
+        const QByteArray input(size, char(size & 0xff));
+        const QByteArray expected = copyContext.crypt(input);
+        QByteArray data = input;
+        QVERIFY(inPlaceContext.crypt(data.data(), data.size()));
+        QCOMPARE(data.toHex(), expected.toHex());
+        QCOMPARE(inPlaceContext.ivec().toHex(), copyContext.ivec().toHex());
+        QCOMPARE(inPlaceContext.ecount().toHex(), copyContext.ecount().toHex());
+        QCOMPARE(inPlaceContext.num(), copyContext.num());
+    }
+
+    Telegram::Crypto::AesCtrContext noKeyContext;
+    QByteArray data(16, char(0));
+    QVERIFY(!noKeyContext.crypt(data.data(), data.size()));
+}
+
+void tst_crypto::benchmarkAesCtr_data()
+{
+    QTest::addColumn<int>("frameSize");
+    QTest::addColumn<bool>("inPlace");
+
+    const QVector<int> sizes = { 16, 128, 1024, 16 * 1024, 512 * 1024 };
+    for (const int size : sizes) {
+        // The "copy" rows reproduce the previous per-frame cost:
+        // the key schedule expansion and a new output array on each call
+        QTest::newRow(QByteArray("copy " + QByteArray::number(size)).constData()) << size << false;
+        QTest::newRow(QByteArray("in-place " + QByteArray::number(size)).constData()) << size << true;
+    }
+}
+
+void tst_crypto::benchmarkAesCtr()
+{
+    QFETCH(int, frameSize);
+    QFETCH(bool, inPlace);
+
+    Telegram::Crypto::AesCtrContext context;
+    context.setKey(c_aesCtrKey);
+    context.setIVec(c_aesCtrIv);
+    QByteArray frame(frameSize, char(0x5a));
+
+    if (inPlace) {
+        QBENCHMARK {
+            context.crypt(frame.data(), frame.size());
+        }
+    } else {
+        QBENCHMARK {
+            context.setKey(c_aesCtrKey);
+            const QByteArray encrypted = context.crypt(frame);
+            Q_UNUSED(encrypted)
+        }
+    }
+}
+
+static QByteArray getIgePattern(int size)
+{
+    QByteArray result(size, Qt::Uninitialized);
+    for (int i = 0; i < size; ++i) {
+        result[i] = static_cast<char>(i * 7 + (i >> 8));
+    }
+    return result;
+}
+
+// The OpenSSL AES_ige_encrypt() output, which is the reference for the engines
+static QByteArray openSslIgeCrypt(const QByteArray &data, const Telegram::Crypto::AesKey &key, int mode)
+{
+    QByteArray result(data.size(), Qt::Uninitialized);
+    QByteArray initVector(key.iv, Telegram::Crypto::AesKey::IvSize);
+    AES_KEY aesKey;
+    const uchar *keyData = reinterpret_cast<const uchar *>(key.key);
+    if (mode == AES_ENCRYPT) {
+        AES_set_encrypt_key(keyData, Telegram::Crypto::AesKey::KeySize * 8, &aesKey);
+    } else {
+        AES_set_decrypt_key(keyData, Telegram::Crypto::AesKey::KeySize * 8, &aesKey);
+    }
+    AES_ige_encrypt(reinterpret_cast<const uchar *>(data.constData()), reinterpret_cast<uchar *>(result.data()),
+                    static_cast<size_t>(data.size()), &aesKey,
+                    reinterpret_cast<uchar *>(initVector.data()), mode);
+    return result;
+}
+
+static const Telegram::Crypto::AesKey c_aesIgeKey(c_aesCtrKey, c_aesCtrKey.right(16) + c_aesCtrIv);
+
+void tst_crypto::aesIge_data()
+{
+    QTest::addColumn<AesIgeEngine>("engine");
+    QTest::addColumn<int>("size");
+
+    const QVector<int> sizes = { 16, 48, 1024 + 16 };
+    for (const int size : sizes) {
+        QTest::newRow(QByteArray("auto " + QByteArray::number(size)).constData()) << AesIgeEngine::Auto << size;
+        QTest::newRow(QByteArray("portable " + QByteArray::number(size)).constData()) << AesIgeEngine::Portable << size;
+        QTest::newRow(QByteArray("aes-ni " + QByteArray::number(size)).constData()) << AesIgeEngine::AesNi << size;
+    }
+}
+
+void tst_crypto::aesIge()
+{
+    QFETCH(AesIgeEngine, engine);
+    QFETCH(int, size);
+    if (!Telegram::Crypto::isAesIgeEngineSupported(engine)) {
+        QSKIP("The engine is not supported on this CPU");
+    }
+
+    const QByteArray plainData = getIgePattern(size);
+    const QByteArray expectedEncrypted = openSslIgeCrypt(plainData, c_aesIgeKey, AES_ENCRYPT);
+    QCOMPARE(openSslIgeCrypt(expectedEncrypted, c_aesIgeKey, AES_DECRYPT), plainData);
+
+    QByteArray data = plainData;
+    QVERIFY(Telegram::Crypto::aesIgeEncrypt(data.data(), data.size(), c_aesIgeKey, engine));
+    QCOMPARE(data.toHex(), expectedEncrypted.toHex());
+    QVERIFY(Telegram::Crypto::aesIgeDecrypt(data.data(), data.size(), c_aesIgeKey, engine));
+    QCOMPARE(data.toHex(), plainData.toHex());
+
+    // Unpadded data is rejected and left intact
+    QByteArray unpadded = plainData.left(size - 1);
+    QVERIFY(!Telegram::Crypto::aesIgeEncrypt(unpadded.data(), unpadded.size(), c_aesIgeKey, engine));
+    QCOMPARE(unpadded, plainData.left(size - 1));
+}
+
+void tst_crypto::benchmarkAesIge_data()
+{
+    QTest::addColumn<AesIgeEngine>("engine");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<bool>("openSsl");
+
+    const QVector<int> sizes = { 64, 1024, 16 * 1024, 512 * 1024 };
+    for (const int size : sizes) {
+        // The "openssl" rows reproduce the previous per-packet cost:
+        // a copy of the payload and AES_ige_encrypt()
+        QTest::newRow(QByteArray("openssl " + QByteArray::number(size)).constData())
+                << AesIgeEngine::Portable << size << true;
+        QTest::newRow(QByteArray("portable " + QByteArray::number(size)).constData())
+                << AesIgeEngine::Portable << size << false;
+        QTest::newRow(QByteArray("aes-ni " + QByteArray::number(size)).constData())
+                << AesIgeEngine::AesNi << size << false;
+    }
+}
+
+void tst_crypto::benchmarkAesIge()
+{
+    QFETCH(AesIgeEngine, engine);
+    QFETCH(int, size);
+    QFETCH(bool, openSsl);
+    if (!Telegram::Crypto::isAesIgeEngineSupported(engine)) {
+        QSKIP("The engine is not supported on this CPU");
+    }
+
+    QByteArray data = getIgePattern(size);
+    if (openSsl) {
+        QBENCHMARK {
+            const QByteArray encrypted = openSslIgeCrypt(data, c_aesIgeKey, AES_ENCRYPT);
+            Q_UNUSED(encrypted)
+        }
+    } else {
+        QBENCHMARK {
+            Telegram::Crypto::aesIgeEncrypt(data.data(), data.size(), c_aesIgeKey, engine);
+        }
+    }
+}
+
+// The independent packets of an updates fan-out: a key per packet and various sizes
+struct IgePacketSet
+{
+    explicit IgePacketSet(int count, int size)
+    {
+        keys.resize(count);
+        packets.resize(count);
+        for (int i = 0; i < count; ++i) {
+            for (int j = 0; j < Telegram::Crypto::AesKey::KeySize; ++j) {
+                keys[i].key[j] = static_cast<char>(i * 31 + j);
+                keys[i].iv[j] = static_cast<char>(i * 17 + j * 3);
+            }
+            packets[i] = getIgePattern(size + (i % 4) * 16);
+        }
+    }
+
+    QVector<Telegram::Crypto::AesIgeBuffer> buffers()
+    {
+        QVector<Telegram::Crypto::AesIgeBuffer> result(packets.count());
+        for (int i = 0; i < packets.count(); ++i) {
+            result[i].data = packets[i].data();
+            result[i].size = packets.at(i).size();
+            result[i].key = &keys.at(i);
+        }
+        return result;
+    }
+
+    QVector<Telegram::Crypto::AesKey> keys;
+    QVector<QByteArray> packets;
+};
+
+void tst_crypto::aesIgeBatch_data()
+{
+    QTest::addColumn<AesIgeEngine>("engine");
+    QTest::addColumn<int>("count");
+
+    const QVector<int> counts = { 1, 3, 4, 5, 37 };
+    for (const int count : counts) {
+        QTest::newRow(QByteArray("portable " + QByteArray::number(count)).constData()) << AesIgeEngine::Portable << count;
+        QTest::newRow(QByteArray("aes-ni " + QByteArray::number(count)).constData()) << AesIgeEngine::AesNi << count;
+    }
+}
+
+void tst_crypto::aesIgeBatch()
+{
+    QFETCH(AesIgeEngine, engine);
+    QFETCH(int, count);
+    if (!Telegram::Crypto::isAesIgeEngineSupported(engine)) {
+        QSKIP("The engine is not supported on this CPU");
+    }
+
+    IgePacketSet set(count, 48);
+    if (count > 1) {
+        // An empty buffer is skipped
+        set.packets[0].clear();
+    }
+    const QVector<QByteArray> plainPackets = set.packets;
+    QVector<Telegram::Crypto::AesIgeBuffer> buffers = set.buffers();
+    QVERIFY(Telegram::Crypto::aesIgeEncryptBatch(buffers.constData(), buffers.count(), engine));
+    for (int i = 0; i < count; ++i) {
+        QCOMPARE(set.packets.at(i).toHex(), openSslIgeCrypt(plainPackets.at(i), set.keys.at(i), AES_ENCRYPT).toHex());
+    }
+
+    // Unpadded data is rejected and the batch is left intact
+    set.packets = plainPackets;
+    set.packets.last().chop(1);
+    const QVector<QByteArray> unpaddedPackets = set.packets;
+    buffers = set.buffers();
+    QVERIFY(!Telegram::Crypto::aesIgeEncryptBatch(buffers.constData(), buffers.count(), engine));
+    QCOMPARE(set.packets, unpaddedPackets);
+}
+
+void tst_crypto::aesIgeBatchInvalidBuffer_data()
+{
+    aesIgeBatch_data();
+}
+
+void tst_crypto::aesIgeBatchInvalidBuffer()
+{
+    QFETCH(AesIgeEngine, engine);
+    QFETCH(int, count);
+    if (!Telegram::Crypto::isAesIgeEngineSupported(engine)) {
+        QSKIP("The engine is not supported on this CPU");
+    }
+
+    // One bad buffer among good ones: the caller drops only the bad one
+    IgePacketSet set(count, 48);
+    const int invalidIndex = count / 2;
+    set.packets[invalidIndex].chop(1);
+    const QVector<QByteArray> plainPackets = set.packets;
+    const QVector<Telegram::Crypto::AesIgeBuffer> allBuffers = set.buffers();
+    QVector<Telegram::Crypto::AesIgeBuffer> buffers;
+    for (int i = 0; i < count; ++i) {
+        const bool valid = Telegram::Crypto::isAesIgeInputValid(allBuffers.at(i).size, engine);
+        QCOMPARE(valid, i != invalidIndex);
+        if (valid) {
+            buffers.append(allBuffers.at(i));
+        }
+    }
+    QCOMPARE(buffers.count(), count - 1);
+    QVERIFY(Telegram::Crypto::aesIgeEncryptBatch(buffers.constData(), buffers.count(), engine));
+    for (int i = 0; i < count; ++i) {
+        if (i == invalidIndex) {
+            QCOMPARE(set.packets.at(i), plainPackets.at(i));
+        } else {
+            QCOMPARE(set.packets.at(i).toHex(), openSslIgeCrypt(plainPackets.at(i), set.keys.at(i), AES_ENCRYPT).toHex());
+        }
+    }
+}
+
+void tst_crypto::benchmarkAesIgeBatch_data()
+{
+    QTest::addColumn<AesIgeEngine>("engine");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<bool>("batch");
+
+    // 1000 recipients of a single update
+    const QVector<int> sizes = { 128, 256, 1024 };
+    for (const int size : sizes) {
+        QTest::newRow(QByteArray("portable single " + QByteArray::number(size)).constData())
+                << AesIgeEngine::Portable << size << false;
+        QTest::newRow(QByteArray("portable batch " + QByteArray::number(size)).constData())
+                << AesIgeEngine::Portable << size << true;
+        QTest::newRow(QByteArray("aes-ni single " + QByteArray::number(size)).constData())
+                << AesIgeEngine::AesNi << size << false;
+        QTest::newRow(QByteArray("aes-ni batch " + QByteArray::number(size)).constData())
+                << AesIgeEngine::AesNi << size << true;
+    }
+}
+
+void tst_crypto::benchmarkAesIgeBatch()
+{
+    QFETCH(AesIgeEngine, engine);
+    QFETCH(int, size);
+    QFETCH(bool, batch);
+    if (!Telegram::Crypto::isAesIgeEngineSupported(engine)) {
+        QSKIP("The engine is not supported on this CPU");
+    }
+
+    IgePacketSet set(1000, size);
+    const QVector<Telegram::Crypto::AesIgeBuffer> buffers = set.buffers();
+    if (batch) {
+        QBENCHMARK {
+            Telegram::Crypto::aesIgeEncryptBatch(buffers.constData(), buffers.count(), engine);
+        }
+    } else {
+        QBENCHMARK {
+            for (const Telegram::Crypto::AesIgeBuffer &buffer : buffers) {
+                Telegram::Crypto::aesIgeEncrypt(buffer.data, buffer.size, *buffer.key, engine);
+            }
+        }
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_crypto)
 
 #include "tst_crypto.moc"
@@ -50,6 +50,9 @@ private slots:
     void testGzipUnpack();
     void testGzipOnDifferentDataSizes_data();
     void testGzipOnDifferentDataSizes();
+    void testGzipCompressionLevels();
+    void benchmarkGzipRoundTrip_data();
+    void benchmarkGzipRoundTrip();
 };
 
 void tst_utils::initTestCase()
@@ -314,6 +317,53 @@ void tst_utils::testGzipOnDifferentDataSizes()
     QCOMPARE(unpacked.size(), dataSizeInt);
 }
 
+void tst_utils::testGzipCompressionLevels()
+{
+    QByteArray data;
+    while (data.size() < 64 * 1024) {
+        data.append(c_gzipUnpackedData);
+    }
+
+    // The reused stream must not leak the previous level or data to the next package
+    const QByteArray fastest = Utils::packGZip(data, 1);
+    const QByteArray best = Utils::packGZip(data, 9);
+    QVERIFY(!fastest.isEmpty());
+    QVERIFY(best.size() <= fastest.size());
+    QCOMPARE(Utils::unpackGZip(fastest), data);
+    QCOMPARE(Utils::unpackGZip(best), data);
+    QCOMPARE(Utils::packGZip(data, 1), fastest);
+    QCOMPARE(Utils::packGZip(c_gzipUnpackedData).toHex(), c_gzipPackedData.toHex());
+
+    // A package with the truncated trailer
+    QVERIFY(Utils::unpackGZip(best.left(best.size() / 2)).size() < data.size());
+}
+
+void tst_utils::benchmarkGzipRoundTrip_data()
+{
+    QTest::addColumn<int>("dataSize");
+    QTest::newRow("4 Kb") << 4 * 1024;
+    QTest::newRow("64 Kb") << 64 * 1024;
+    QTest::newRow("1 Mb") << 1024 * 1024;
+}
+
+void tst_utils::benchmarkGzipRoundTrip()
+{
+    QFETCH(int, dataSize);
+
+    // Repeated TL data compresses like the real RPC results
+    QByteArray data;
+    while (data.size() < dataSize) {
+        data.append(c_gzipUnpackedData);
+    }
+    data.truncate(dataSize);
+
+    QByteArray unpacked;
+    QBENCHMARK {
+        unpacked = Utils::unpackGZip(Utils::packGZip(data));
+    }
+    QCOMPARE(unpacked.size(), dataSize);
+}
+
 QTEST_APPLESS_MAIN(tst_utils)
 
 #include "tst_utils.moc"
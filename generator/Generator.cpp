@@ -631,7 +631,9 @@ QStringList Generator::generateTLTypeMembers(const TLType &type)
             if (member.dependOnFlag() && (member.type() == tlTrueType)) {
                 continue; // No extra data behind the flag
             }
-            if (member.accessByPointer()) {
+            if (member.isBoxed()) {
+                membersCode.append(QStringLiteral("TLPtr<%1> %2;").arg(member.type(), member.getAlias()));
+            } else if (member.accessByPointer()) {
                 if (member.isVector()) {
                     membersCode.append(QStringLiteral("%1<%2*> %3;").arg(tlVectorType, member.bareType(), member.getAlias()));
                 } else {
@@ -666,7 +668,7 @@ QString Generator::streamReadImplementationEnd(const QString &argName)
 {
     QString code;
     code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
-    code.append(QString("%1%2 = result;\n\n%1return *this;\n}\n\n").arg(spacing, argName));
+    code.append(QString("%1%2 = std::move(result);\n\n%1return *this;\n}\n\n").arg(spacing, argName));
     return code;
 }
 
@@ -679,7 +681,8 @@ QString Generator::streamReadPerTypeImplementation(const TypedEntity *type, cons
                 continue;
             }
             code.append(doubleSpacing + QString("if (result.%1 & %2::%3) {\n").arg(member.flagMember, type->name, member.flagName()));
-            code.append(doubleSpacing + spacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
+            const QString dereference = (member.accessByPointer() && !member.isVector()) ? QStringLiteral("*") : QString();
+            code.append(doubleSpacing + spacing + QString("*this >> %1result.%2;\n").arg(dereference, member.getAlias()));
             code.append(doubleSpacing + QLatin1Literal("}\n"));
         } else {
             if (member.accessByPointer() && !member.isVector()) {
@@ -790,7 +793,8 @@ QString Generator::streamWritePerTypeImplementationBase(const TypedEntity *type,
                 continue;
             }
             code.append(doubleSpacing + QString("if (%1.%2 & %3::%4) {\n").arg(argName, member.flagMember, type->name, member.flagName()));
-            code.append(doubleSpacing + spacing + streamGetter + QString(" << %1.%2;\n").arg(argName, member.getAlias()));
+            const QString dereference = (member.accessByPointer() && !member.isVector()) ? QStringLiteral("*") : QString();
+            code.append(doubleSpacing + spacing + streamGetter + QString(" << %1%2.%3;\n").arg(dereference, argName, member.getAlias()));
             code.append(doubleSpacing + QLatin1Literal("}\n"));
         } else {
             if (member.accessByPointer() && !member.isVector()) {
@@ -804,6 +808,126 @@ QString Generator::streamWritePerTypeImplementationBase(const TypedEntity *type,
     return code;
 }
 
+QString Generator::serializedSizeImplementationHead(const TypedEntity *type)
+{
+    const QString argName = type->variableName();
+    const QString typeName = type->name;
+    QString code;
+    code.append(QString("int serializedSize(const %1 &%2)\n{\n").arg(typeName, argName));
+    code.append(QString("%1int size = serializedSize(%2.tlType);\n%1switch (%2.tlType) {\n").arg(spacing, argName));
+    return code;
+}
+
+QString Generator::serializedSizeImplementationEnd(const QString &argName)
+{
+    Q_UNUSED(argName)
+    QString code;
+    code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(spacing + QStringLiteral("return size;\n}\n\n"));
+    return code;
+}
+
+QString Generator::serializedSizePerTypeImplementation(const TypedEntity *type, const TLSubType &subType)
+{
+    // Mirrors streamWritePerTypeImplementationBase()
+    const QString argName = type->variableName();
+    QString code;
+    foreach (const TLParam &member, subType.members) {
+        if (member.dependOnFlag()) {
+            if (member.type() == tlTrueType) {
+                continue;
+            }
+            code.append(doubleSpacing + QString("if (%1.%2 & %3::%4) {\n").arg(argName, member.flagMember, type->name, member.flagName()));
+            const QString dereference = (member.accessByPointer() && !member.isVector()) ? QStringLiteral("*") : QString();
+            code.append(doubleSpacing + spacing + QString("size += serializedSize(%1%2.%3);\n").arg(dereference, argName, member.getAlias()));
+            code.append(doubleSpacing + QLatin1Literal("}\n"));
+        } else {
+            if (member.accessByPointer() && !member.isVector()) {
+                code.append(doubleSpacing + QString("size += serializedSize(*%1.%2);\n").arg(argName, member.getAlias()));
+            } else {
+                code.append(doubleSpacing + QString("size += serializedSize(%1.%2);\n").arg(argName, member.getAlias()));
+            }
+        }
+    }
+    code.append(QString("%1break;\n").arg(doubleSpacing));
+    return code;
+}
+
+QStringList Generator::skipFlagMembers(const TLSubType &subType)
+{
+    // The flags members which control the presence of some (non-"true") members
+    QStringList flagMembers;
+    foreach (const TLParam &member, subType.members) {
+        if (member.dependOnFlag() && (member.type() != tlTrueType) && !flagMembers.contains(member.flagMember)) {
+            flagMembers.append(member.flagMember);
+        }
+    }
+    return flagMembers;
+}
+
+QString Generator::skipImplementationHead(const TypedEntity *type)
+{
+    const TLType *tlType = static_cast<const TLType *>(type);
+    QStringList flagMembers;
+    foreach (const TLSubType &subType, tlType->subTypes) {
+        foreach (const QString &flagMember, skipFlagMembers(subType)) {
+            if (!flagMembers.contains(flagMember)) {
+                flagMembers.append(flagMember);
+            }
+        }
+    }
+    QString code;
+    code.append(QString("template <>\n%1 &%1::skip<%2>()\n{\n").arg(streamClassName, type->name));
+    code.append(QString("%1%2 tlType;\n").arg(spacing, tlValueName));
+    foreach (const QString &flagMember, flagMembers) {
+        code.append(QString("%1quint32 %2 = 0;\n").arg(spacing, flagMember));
+    }
+    code.append(QString("\n%1*this >> tlType;\n\n%1switch (tlType) {\n").arg(spacing));
+    return code;
+}
+
+QString Generator::skipImplementationEnd(const QString &argName)
+{
+    Q_UNUSED(argName)
+    QString code;
+    code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(spacing + QStringLiteral("return *this;\n}\n\n"));
+    return code;
+}
+
+QString Generator::skipPerTypeImplementation(const TypedEntity *type, const TLSubType &subType)
+{
+    // Mirrors streamReadPerTypeImplementation(), but reads only the flags
+    const QStringList flagMembers = skipFlagMembers(subType);
+    QString code;
+    foreach (const TLParam &member, subType.members) {
+        QString memberCode;
+        if (member.isVector()) {
+            QString itemType = member.bareType();
+            if (itemType.endsWith(QLatin1Char('*'))) {
+                itemType.chop(1);
+            }
+            memberCode = QString("skipVector<%1>();\n").arg(itemType);
+        } else {
+            memberCode = QString("skip<%1>();\n").arg(member.type());
+        }
+        if (member.dependOnFlag()) {
+            if (member.type() == tlTrueType) {
+                continue;
+            }
+            code.append(doubleSpacing + QString("if (%1 & %2::%3) {\n").arg(member.flagMember, type->name, member.flagName()));
+            code.append(doubleSpacing + spacing + memberCode);
+            code.append(doubleSpacing + QLatin1Literal("}\n"));
+        } else if (flagMembers.contains(member.getAlias())) {
+            code.append(doubleSpacing + QString("*this >> %1;\n").arg(member.getAlias()));
+        } else {
+            code.append(doubleSpacing + memberCode);
+        }
+    }
+    code.append(QString("%1break;\n").arg(doubleSpacing));
+    return code;
+}
+
 QString Generator::generateStreamOperatorDefinition(const TLType *type, std::function<QString (const TypedEntity *type)> head,
                                                     std::function<QString (const TypedEntity *, const TLSubType &)> generateSubtypeCode,
                                                     std::function<QString (const QString &)> end)
@@ -922,6 +1046,31 @@ QString Generator::streamWriteFreeOperatorDefinition(const TLType *type)
     return generateStreamOperatorDefinition(type, streamWriteFreeImplementationHead, streamWritePerTypeFreeImplementation, streamWriteFreeImplementationEnd);
 }
 
+QString Generator::serializedSizeDeclaration(const TLType *type)
+{
+    // int serializedSize(const TLAccountDaysTTL &accountDaysTTLValue);
+    QString result;
+    QTextStream stream(&result);
+    stream << c_internalExportMacro << " int serializedSize(const " << type->name << " &" << type->variableName() << ");" << endl;
+    return result;
+}
+
+QString Generator::serializedSizeDefinition(const TLType *type)
+{
+    return generateStreamOperatorDefinition(type, serializedSizeImplementationHead, serializedSizePerTypeImplementation, serializedSizeImplementationEnd);
+}
+
+QString Generator::skipDeclaration(const TLType *type)
+{
+    // template <> Stream &Stream::skip<TLAccountDaysTTL>();
+    return QString("template <> %1 &%1::skip<%2>();\n").arg(streamClassName, type->name);
+}
+
+QString Generator::skipDefinition(const TLType *type)
+{
+    return generateStreamOperatorDefinition(type, skipImplementationHead, skipPerTypeImplementation, skipImplementationEnd);
+}
+
 QString Generator::streamWriteVectorTemplate(const QString &type)
 {
     return QString(QLatin1String("template %1 &%1::operator<<(const TLVector<%2> &v);")).arg(streamClassName).arg(type);
@@ -1008,7 +1157,8 @@ QString Generator::debugOperatorPerTypeImplementation(const TypedEntity *type, c
                 continue;
             }
             code += doubleSpacing + QString("if (type.%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit);
-            code += doubleSpacing + spacing + QString("d << spacer.innerSpaces() << \"%1: \" << %2 <<\"\\n\";\n").arg(member.getAlias(), typeDebugStatement);
+            const QString dereference = (member.accessByPointer() && !member.isVector()) ? QStringLiteral("*") : QString();
+            code += doubleSpacing + spacing + QString("d << spacer.innerSpaces() << \"%1: \" << %2%3 <<\"\\n\";\n").arg(member.getAlias(), dereference, typeDebugStatement);
             code += doubleSpacing + QLatin1Literal("}\n");
         } else if (member.accessByPointer() && !member.isVector()) {
             code += doubleSpacing + QString("d << spacer.innerSpaces() << \"%1: \" << *%2 <<\"\\n\";\n").arg(member.getAlias(), typeDebugStatement);
@@ -1756,7 +1906,8 @@ void Generator::getUsedAndVectorTypes(QStringList &usedTypes, QStringList &vecto
 }
 
 Generator::Generator() :
-    m_addSpecSources(false)
+    m_addSpecSources(false),
+    m_boxedMemberThreshold(0)
 {
 }
 
@@ -1894,10 +2045,116 @@ bool Generator::loadFromText(const QByteArray &data)
     return true;
 }
 
+int Generator::estimateTypeSize(const QString &typeName, const QHash<QString, const TLType *> &types, QHash<QString, int> *cache)
+{
+    // The estimation assumes a 64-bit target; QString, QByteArray, vectors and pointers are d-pointers
+    static const QHash<QString, int> nativeSizes = {
+        { QStringLiteral("bool"), 1 },
+        { QStringLiteral("quint32"), 4 },
+        { QStringLiteral("quint64"), 8 },
+        { QStringLiteral("double"), 8 },
+        { QStringLiteral("QString"), 8 },
+        { QStringLiteral("QByteArray"), 8 },
+        { tlValueName, 4 },
+        { tlPrefix + QLatin1String("Number128"), 16 },
+        { tlPrefix + QLatin1String("Number256"), 32 },
+    };
+    static const int pointerSize = 8;
+
+    if (nativeSizes.contains(typeName)) {
+        return nativeSizes.value(typeName);
+    }
+    if (cache->contains(typeName)) {
+        return cache->value(typeName);
+    }
+    const TLType *type = types.value(typeName);
+    if (!type) {
+        return pointerSize;
+    }
+    cache->insert(typeName, pointerSize); // Guard against the recursion
+
+    int size = nativeSizes.value(tlValueName);
+    QStringList addedMembers;
+    for (const TLSubType &subType : type->subTypes) {
+        for (const TLParam &member : subType.members) {
+            if (addedMembers.contains(member.getAlias())) {
+                continue;
+            }
+            addedMembers.append(member.getAlias());
+            if (member.dependOnFlag() && (member.type() == tlTrueType)) {
+                continue;
+            }
+            if (member.accessByPointer() || member.isVector()) {
+                size += pointerSize;
+            } else {
+                size += estimateTypeSize(member.type(), types, cache);
+            }
+        }
+    }
+    cache->insert(typeName, size);
+    return size;
+}
+
+void Generator::boxMembers(QList<TLType> *types, int threshold)
+{
+    QHash<QString, const TLType *> typesHash;
+    for (const TLType &type : *types) {
+        typesHash.insert(type.name, &type);
+    }
+
+    QHash<QString, int> sizeCache;
+    QHash<QString, QStringList> boxedAliases; // type name to the aliases of the members to box
+    for (const TLType &type : *types) {
+        if (type.subTypes.count() < 2) {
+            continue;
+        }
+        QHash<QString, int> aliasUsage;
+        QHash<QString, const TLParam *> aliasMembers;
+        for (const TLSubType &subType : type.subTypes) {
+            for (const TLParam &member : subType.members) {
+                ++aliasUsage[member.getAlias()];
+                aliasMembers.insert(member.getAlias(), &member);
+            }
+        }
+        for (const QString &alias : aliasUsage.keys()) {
+            if (aliasUsage.value(alias) == type.subTypes.count()) {
+                continue; // The member is a part of the shared header
+            }
+            const TLParam *member = aliasMembers.value(alias);
+            if (member->isVector() || member->accessByPointer() || !typesHash.contains(member->type())) {
+                continue;
+            }
+            const int size = estimateTypeSize(member->type(), typesHash, &sizeCache);
+            if (size >= threshold) {
+                qCDebug(c_loggingTypes) << "Box member" << type.name << alias << member->type() << "of size" << size;
+                boxedAliases[type.name].append(alias);
+            }
+        }
+    }
+
+    for (TLType &type : *types) {
+        const QStringList aliases = boxedAliases.value(type.name);
+        if (aliases.isEmpty()) {
+            continue;
+        }
+        for (TLSubType &subType : type.subTypes) {
+            for (TLParam &member : subType.members) {
+                if (aliases.contains(member.getAlias())) {
+                    member.setAccessByPointer(true);
+                    member.setBoxed(true);
+                }
+            }
+        }
+    }
+}
+
 bool Generator::resolveTypes()
 {
     QMap<QString, TLType> unresolved;
     m_solvedTypes = solveTypes(m_types, &unresolved);
+    if (m_boxedMemberThreshold > 0) {
+        boxMembers(&m_solvedTypes, m_boxedMemberThreshold);
+    }
 
     if (!unresolved.isEmpty()) {
         qDebug() << "Unresolved:" << unresolved.count() << unresolved;
@@ -1914,6 +2171,10 @@ void Generator::generate()
     codeStreamWriteDeclarations.clear();
     codeStreamWriteDefinitions.clear();
     codeStreamWriteTemplateInstancing.clear();
+    codeSerializedSizeDeclarations.clear();
+    codeSerializedSizeDefinitions.clear();
+    codeSkipDeclarations.clear();
+    codeSkipDefinitions.clear();
     codeRpcProcessDeclarations.clear();
     codeRpcProcessDefinitions.clear();
     codeRpcProcessSwitchCases.clear();
@@ -2039,6 +2300,12 @@ void Generator::generate()
             codeStreamExtraWriteDefinitions .append(streamWriteFreeOperatorDefinition(&type));
         }
 
+        codeSerializedSizeDeclarations.append(serializedSizeDeclaration(&type));
+        codeSerializedSizeDefinitions.append(serializedSizeDefinition(&type));
+
+        codeSkipDeclarations.append(skipDeclaration(&type));
+        codeSkipDefinitions.append(skipDefinition(&type));
+
         codeDebugWriteDeclarations.append(generateDebugWriteOperatorDeclaration(&type));
         codeDebugWriteDefinitions .append(generateDebugWriteOperatorDefinition(&type));
     }
@@ -2328,6 +2595,11 @@ void Generator::setAddSpecSources(bool addSources)
     m_addSpecSources = addSources;
 }
 
+void Generator::setBoxedMemberThreshold(int threshold)
+{
+    m_boxedMemberThreshold = threshold;
+}
+
 QStringList Generator::getWords(const QString &input)
 {
     if (input.isEmpty()) {
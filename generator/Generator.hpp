@@ -89,6 +89,9 @@ struct TLParam {
     bool accessByPointer() const { return m_accessByPointer; }
     void setAccessByPointer(bool accessByPointer) { m_accessByPointer = accessByPointer; }
 
+    bool isBoxed() const { return m_boxed; }
+    void setBoxed(bool boxed) { m_boxed = boxed; }
+
     QString getAlias() const { return !m_alias.isEmpty() ? m_alias : m_name; }
     void setAlias(const QString &newAlias) { m_alias = newAlias; }
 
@@ -104,6 +107,7 @@ protected:
     QString m_flagName;
     bool m_isVector = false;
     bool m_accessByPointer = false;
+    bool m_boxed = false;
 };
 
 struct TLSubType : public Predicate {
@@ -207,6 +211,7 @@ public:
     QVector<QStringList> groups() const { return m_groups; }
 
     void setAddSpecSources(bool addSources);
+    void setBoxedMemberThreshold(int threshold);
 
     static QStringList getWords(const QString &input);
     static QString removeWord(QString input, QString word);
@@ -231,6 +236,15 @@ public:
     static QString streamWritePerTypeFreeImplementation(const TypedEntity *type, const TLSubType &subType);
     static QString streamWritePerTypeImplementationBase(const TypedEntity *type, const TLSubType &subType, const QString &streamGetter);
 
+    static QString serializedSizeImplementationHead(const TypedEntity *type);
+    static QString serializedSizeImplementationEnd(const QString &argName);
+    static QString serializedSizePerTypeImplementation(const TypedEntity *type, const TLSubType &subType);
+
+    static QStringList skipFlagMembers(const TLSubType &subType);
+    static QString skipImplementationHead(const TypedEntity *type);
+    static QString skipImplementationEnd(const QString &argName);
+    static QString skipPerTypeImplementation(const TypedEntity *type, const TLSubType &subType);
+
     static QString generateStreamOperatorDefinition(const TLType *type,
                                                     std::function<QString(const TypedEntity *type)> head,
                                                     std::function<QString(const TypedEntity *type, const TLSubType &subType)> generateSubtypeCode,
@@ -253,6 +267,10 @@ public:
     static QString streamWriteFreeOperatorDefinition(const TLType *type);
     static QString streamWriteVectorTemplate(const QString &type);
     static QString streamWriteFreeVectorTemplate(const QString &type);
+    static QString serializedSizeDeclaration(const TLType *type);
+    static QString serializedSizeDefinition(const TLType *type);
+    static QString skipDeclaration(const TLType *type);
+    static QString skipDefinition(const TLType *type);
 
     QStringList generateRpcReplyTemplates(const QString &groupName) const;
 
@@ -286,6 +304,8 @@ public:
     static QStringList reorderLinesAsExist(QStringList newLines, QStringList existLines);
 
     static QList<TLType> solveTypes(QMap<QString, TLType> types, QMap<QString, TLType> *unresolved = nullptr);
+    static void boxMembers(QList<TLType> *types, int threshold);
+    static int estimateTypeSize(const QString &typeName, const QHash<QString, const TLType *> &types, QHash<QString, int> *cache);
 
     void getUsedAndVectorTypes(QStringList &usedTypes, QStringList &vectors) const;
 
@@ -299,6 +319,10 @@ public:
     QString codeStreamExtraReadDeclarations;
     QString codeStreamExtraWriteDeclarations;
     QString codeStreamExtraWriteDefinitions;
+    QString codeSerializedSizeDeclarations;
+    QString codeSerializedSizeDefinitions;
+    QString codeSkipDeclarations;
+    QString codeSkipDefinitions;
     QString codeConnectionDeclarations;
     QString codeConnectionDefinitions;
     QString codeRpcProcessDeclarations;
@@ -318,6 +342,7 @@ private:
     QMap<QString, TLMethod> m_functions;
     QVector<QStringList> m_groups;
     bool m_addSpecSources;
+    int m_boxedMemberThreshold;
     QStringList m_functionGroups;
 };
 
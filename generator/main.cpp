@@ -48,6 +48,7 @@ enum SchemaFormat {
 static bool s_dryRun = false;
 static bool s_dump = true;
 static bool s_addSpecSources = false;
+static int s_boxedMemberThreshold = 128; // Estimated bytes; 0 keeps the flat layout
 
 static const QByteArray c_textLayerMarker = QByteArrayLiteral("// LAYER ");
 
@@ -518,6 +519,7 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
 
     Generator generator;
     generator.setAddSpecSources(s_addSpecSources);
+    generator.setBoxedMemberThreshold(s_boxedMemberThreshold);
 
     bool success = true;
 
@@ -585,6 +587,17 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
         fileTelegramStreamSource.replace("vector write templates instancing", generator.codeStreamWriteTemplateInstancing);
         fileTelegramStreamExtraOperatorsHeader.replace("write operators", generator.codeStreamExtraWriteDeclarations);
         fileTelegramStreamExtraOperatorsSource.replace("write operators implementation", generator.codeStreamExtraWriteDefinitions);
+
+        OutputFile fileTelegramStreamSkipSource("MTProto/StreamSkip.cpp");
+        fileTelegramStreamHeader.replace("skip specializations", generator.codeSkipDeclarations);
+        fileTelegramStreamSkipSource.replace("skip specializations implementation", generator.codeSkipDefinitions);
+    }
+
+    {
+        OutputFile fileSerializedSizeHeader("MTProto/SerializedSize.hpp");
+        OutputFile fileSerializedSizeSource("MTProto/SerializedSize.cpp");
+        fileSerializedSizeHeader.replace("serialized size functions", generator.codeSerializedSizeDeclarations);
+        fileSerializedSizeSource.replace("serialized size functions implementation", generator.codeSerializedSizeDefinitions);
     }
 
     {
@@ -782,6 +795,11 @@ int main(int argc, char *argv[])
     QCommandLineOption addSpecSourcesOption(QStringLiteral("add-spec-sources"));
     parser.addOption(addSpecSourcesOption);
 
+    QCommandLineOption boxedMemberThresholdOption(QStringLiteral("boxed-member-threshold"));
+    boxedMemberThresholdOption.setValueName(QStringLiteral("bytes"));
+    boxedMemberThresholdOption.setDescription(QStringLiteral("Store constructor-specific members of at least this size by pointer (0 for the flat layout)"));
+    parser.addOption(boxedMemberThresholdOption);
+
     QCommandLineOption fetchTextOption(QStringLiteral("fetch-text"));
     fetchTextOption.setValueName(QStringLiteral("url"));
     parser.addOption(fetchTextOption);
@@ -810,6 +828,9 @@ int main(int argc, char *argv[])
     s_dryRun = parser.isSet(dryRunOption);
     s_dump = parser.isSet(dumpOption);
     s_addSpecSources = parser.isSet(addSpecSourcesOption);
+    if (parser.isSet(boxedMemberThresholdOption)) {
+        s_boxedMemberThreshold = parser.value(boxedMemberThresholdOption).toInt();
+    }
     s_inputDir = parser.value(inputDirOption);
     if (s_inputDir.isEmpty()) {
         s_inputDir = QStringLiteral("./");
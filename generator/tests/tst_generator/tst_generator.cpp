@@ -102,6 +102,9 @@ private slots:
     void predicateForCrc_data();
     void predicateForCrc();
     void checkStreamReadOperator();
+    void checkSerializedSize();
+    void checkSkip();
+    void boxedTypeMembers();
 };
 
 tst_Generator::tst_Generator(QObject *parent) :
@@ -397,7 +400,7 @@ void tst_Generator::checkStreamReadOperator()
             "        break;\n"
             "    }\n"
             "\n"
-            "    postAddressValue = result;\n"
+            "    postAddressValue = std::move(result);\n"
             "\n"
             "    return *this;\n"
             "}\n"
@@ -428,7 +431,7 @@ void tst_Generator::checkStreamReadOperator()
             "        break;\n"
             "    }\n"
             "\n"
-            "    paymentRequestedInfoValue = result;\n"
+            "    paymentRequestedInfoValue = std::move(result);\n"
             "\n"
             "    return *this;\n"
             "}\n"
@@ -449,6 +452,232 @@ void tst_Generator::checkStreamReadOperator()
     QCOMPARE(generator.codeStreamReadDefinitions.toLatin1(), definitionsCode);
 }
 
+void tst_Generator::checkSerializedSize()
+{
+    QByteArray sources =
+            "\n"
+            "postAddress#1e8caaeb"
+            " street_line1:string"
+            " street_line2:string"
+            " city:string state:string"
+            " country_iso2:string"
+            " post_code:string = PostAddress;"
+            "\n"
+            "paymentRequestedInfo#909c3f94 flags:#"
+            " name:flags.0?string"
+            " phone:flags.1?string"
+            " email:flags.2?string"
+            " shipping_address:flags.3?PostAddress"
+            " = PaymentRequestedInfo;";
+
+    QByteArray declarationsCode =
+            "TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPostAddress &postAddressValue);\n"
+            "TELEGRAMQT_INTERNAL_EXPORT int serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue);\n";
+
+    QByteArray definitionsCode =
+            "int serializedSize(const TLPostAddress &postAddressValue)\n"
+            "{\n"
+            "    int size = serializedSize(postAddressValue.tlType);\n"
+            "    switch (postAddressValue.tlType) {\n"
+            "    case TLValue::PostAddress:\n"
+            "        size += serializedSize(postAddressValue.streetLine1);\n"
+            "        size += serializedSize(postAddressValue.streetLine2);\n"
+            "        size += serializedSize(postAddressValue.city);\n"
+            "        size += serializedSize(postAddressValue.state);\n"
+            "        size += serializedSize(postAddressValue.countryIso2);\n"
+            "        size += serializedSize(postAddressValue.postCode);\n"
+            "        break;\n"
+            "    default:\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return size;\n"
+            "}\n"
+            "\n"
+            "int serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue)\n"
+            "{\n"
+            "    int size = serializedSize(paymentRequestedInfoValue.tlType);\n"
+            "    switch (paymentRequestedInfoValue.tlType) {\n"
+            "    case TLValue::PaymentRequestedInfo:\n"
+            "        size += serializedSize(paymentRequestedInfoValue.flags);\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Name) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.name);\n"
+            "        }\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Phone) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.phone);\n"
+            "        }\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Email) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.email);\n"
+            "        }\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::ShippingAddress) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.shippingAddress);\n"
+            "        }\n"
+            "        break;\n"
+            "    default:\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return size;\n"
+            "}\n"
+            "\n";
+
+    const QByteArray textData = c_typesSection + sources;
+
+    Generator generator;
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+    generator.generate();
+
+    QCOMPARE(generator.codeSerializedSizeDeclarations.toLatin1(), declarationsCode);
+    QCOMPARE(generator.codeSerializedSizeDefinitions.toLatin1(), definitionsCode);
+}
+
+void tst_Generator::checkSkip()
+{
+    QByteArray sources =
+            "\n"
+            "postAddress#1e8caaeb"
+            " street_line1:string"
+            " street_line2:string"
+            " city:string state:string"
+            " country_iso2:string"
+            " post_code:string = PostAddress;"
+            "\n"
+            "paymentRequestedInfo#909c3f94 flags:#"
+            " name:flags.0?string"
+            " phone:flags.1?string"
+            " email:flags.2?string"
+            " shipping_address:flags.3?PostAddress"
+            " = PaymentRequestedInfo;";
+
+    QByteArray declarationsCode =
+            "template <> Stream &Stream::skip<TLPostAddress>();\n"
+            "template <> Stream &Stream::skip<TLPaymentRequestedInfo>();\n";
+
+    QByteArray definitionsCode =
+            "template <>\n"
+            "Stream &Stream::skip<TLPostAddress>()\n"
+            "{\n"
+            "    TLValue tlType;\n"
+            "\n"
+            "    *this >> tlType;\n"
+            "\n"
+            "    switch (tlType) {\n"
+            "    case TLValue::PostAddress:\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        break;\n"
+            "    default:\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return *this;\n"
+            "}\n"
+            "\n"
+            "template <>\n"
+            "Stream &Stream::skip<TLPaymentRequestedInfo>()\n"
+            "{\n"
+            "    TLValue tlType;\n"
+            "    quint32 flags = 0;\n"
+            "\n"
+            "    *this >> tlType;\n"
+            "\n"
+            "    switch (tlType) {\n"
+            "    case TLValue::PaymentRequestedInfo:\n"
+            "        *this >> flags;\n"
+            "        if (flags & TLPaymentRequestedInfo::Name) {\n"
+            "            skip<QString>();\n"
+            "        }\n"
+            "        if (flags & TLPaymentRequestedInfo::Phone) {\n"
+            "            skip<QString>();\n"
+            "        }\n"
+            "        if (flags & TLPaymentRequestedInfo::Email) {\n"
+            "            skip<QString>();\n"
+            "        }\n"
+            "        if (flags & TLPaymentRequestedInfo::ShippingAddress) {\n"
+            "            skip<TLPostAddress>();\n"
+            "        }\n"
+            "        break;\n"
+            "    default:\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return *this;\n"
+            "}\n"
+            "\n";
+
+    const QByteArray textData = c_typesSection + sources;
+
+    Generator generator;
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+    generator.generate();
+
+    QCOMPARE(generator.codeSkipDeclarations.toLatin1(), declarationsCode);
+    QCOMPARE(generator.codeSkipDefinitions.toLatin1(), definitionsCode);
+}
+
+void tst_Generator::boxedTypeMembers()
+{
+    QByteArray sources =
+            "\n"
+            "postAddress#1e8caaeb"
+            " street_line1:string"
+            " street_line2:string"
+            " city:string state:string"
+            " country_iso2:string"
+            " post_code:string = PostAddress;"
+            "\n"
+            "paymentRequestedInfo#909c3f94 flags:#"
+            " name:flags.0?string"
+            " phone:flags.1?string"
+            " email:flags.2?string"
+            " shipping_address:flags.3?PostAddress"
+            " = PaymentRequestedInfo;"
+            "\n"
+            "messageActionEmpty = MessageAction;"
+            "\n"
+            "messageActionPaymentSentMe flags:# currency:string info:flags.0?PaymentRequestedInfo = MessageAction;"
+            "\n"
+            "messageActionPaymentSent currency:string = MessageAction;";
+
+    const QByteArray textData = c_typesSection + sources;
+
+    {
+        // The flat layout is the default
+        Generator generator;
+        QVERIFY(generator.loadFromText(textData));
+        QVERIFY(generator.resolveTypes());
+        const QStringList structMembers = Generator::generateTLTypeMembers(getSolvedType(generator, QStringLiteral("MessageAction")));
+        QVERIFY(structMembers.contains(QStringLiteral("TLPaymentRequestedInfo info;")));
+    }
+
+    Generator generator;
+    generator.setBoxedMemberThreshold(64);
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+
+    const QStringList actionMembers = Generator::generateTLTypeMembers(getSolvedType(generator, QStringLiteral("MessageAction")));
+    QVERIFY(actionMembers.contains(QStringLiteral("TLPtr<TLPaymentRequestedInfo> info;")));
+    QVERIFY(actionMembers.contains(QStringLiteral("QString currency;")));
+
+    // Single-constructor types keep all the members inline
+    const QStringList infoMembers = Generator::generateTLTypeMembers(getSolvedType(generator, QStringLiteral("PaymentRequestedInfo")));
+    QVERIFY(infoMembers.contains(QStringLiteral("TLPostAddress shippingAddress;")));
+
+    generator.generate();
+    QVERIFY(generator.codeStreamReadDefinitions.contains(QStringLiteral(
+                "        if (result.flags & TLMessageAction::Info) {\n"
+                "            *this >> *result.info;\n"
+                "        }\n")));
+    QVERIFY(generator.codeSerializedSizeDefinitions.contains(QStringLiteral(
+                "            size += serializedSize(*messageActionValue.info);\n")));
+}
+
 QTEST_APPLESS_MAIN(tst_Generator)
 
 #include "tst_generator.moc"
@@ -4,6 +4,7 @@
 #include "RawStream.hpp"
 
 #include <QHostAddress>
+#include <QLocalSocket>
 #include <QLoggingCategory>
 #include <QMetaMethod>
 #include <QTcpSocket>
@@ -21,6 +22,13 @@ TcpTransport::TcpTransport(QTcpSocket *socket, QObject *parent) :
     setState(m_socket->state());
 }
 
+TcpTransport::TcpTransport(QLocalSocket *socket, QObject *parent) :
+    BaseTcpTransport(parent)
+{
+    setLocalSocket(socket);
+    onLocalSocketStateChanged(m_localSocket->state());
+}
+
 TcpTransport::~TcpTransport()
 {
     qCDebug(c_loggingServerTcpTransport) << this << __func__;
@@ -34,11 +42,11 @@ void TcpTransport::connectToHost(const QString &, quint16)
 bool TcpTransport::startObfuscatedSession()
 {
     qCDebug(c_loggingServerTcpTransport()) << Q_FUNC_INFO;
-    if (m_socket->bytesAvailable() < 64) {
+    if (m_device->bytesAvailable() < 64) {
         qCWarning(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Invalid package size";
         return false;
     }
-    QByteArray plainData = m_socket->read(56);
+    QByteArray plainData = m_device->read(56);
     RawStream raw(plainData);
 
     quint32 firstByte;
@@ -55,8 +63,8 @@ bool TcpTransport::startObfuscatedSession()
 
     // The client sends its encryption key in plain text
     setCryptoKeysSourceData(encryptionSourceData, DirectIsReadReversedIsWrite);
-    QByteArray content1 = plainData + m_socket->read(8);
-    m_readAesContext->crypt(content1);
+    QByteArray content1 = plainData + m_device->read(8);
+    m_readAesContext->crypt(content1.data(), content1.size());
     return true;
 }
 
@@ -66,12 +74,19 @@ void TcpTransport::readEvent()
         return;
     }
     char sessionSign;
-    m_socket->getChar(&sessionSign);
+    m_device->getChar(&sessionSign);
     if (sessionSign == char(0xef)) {
         setSessionType(Abridged);
     } else {
-        m_socket->ungetChar(sessionSign);
-        if (startObfuscatedSession()) {
+        m_device->ungetChar(sessionSign);
+        const QByteArray header = m_device->peek(4);
+        if (header == QByteArray(4, char(0xee))) {
+            m_device->read(4);
+            setSessionType(Intermediate);
+        } else if (header == QByteArray(4, char(0xdd))) {
+            m_device->read(4);
+            setSessionType(PaddedIntermediate);
+        } else if (startObfuscatedSession()) {
             setSessionType(Obfuscated);
         } else {
             qCCritical(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Invalid data";
@@ -3,6 +3,7 @@
 
 #include "CTcpTransport.hpp"
 
+QT_FORWARD_DECLARE_CLASS(QLocalSocket)
 QT_FORWARD_DECLARE_CLASS(QTcpSocket)
 
 namespace Telegram {
@@ -14,6 +15,7 @@ class TcpTransport : public BaseTcpTransport
     Q_OBJECT
 public:
     explicit TcpTransport(QTcpSocket *socket, QObject *parent = nullptr);
+    explicit TcpTransport(QLocalSocket *socket, QObject *parent = nullptr);
     ~TcpTransport() override;
 
     void connectToHost(const QString &ipAddress, quint16 port) override;
@@ -0,0 +1,73 @@
+#include "CryptoWorkerQueue.hpp"
+
+#include <QRunnable>
+#include <QThreadPool>
+
+namespace Telegram {
+
+namespace Server {
+
+class CryptoWorkerQueue::Runnable : public QRunnable
+{
+public:
+    Runnable(CryptoWorkerQueue *queue, const Function &work) :
+        m_queue(queue),
+        m_work(work)
+    {
+    }
+
+    void run() override
+    {
+        m_work();
+        QMetaObject::invokeMethod(m_queue, "onJobFinished", Qt::QueuedConnection);
+        // The queue can be destroyed right after the release
+        m_queue->m_jobDone.release();
+    }
+
+protected:
+    CryptoWorkerQueue *m_queue;
+    Function m_work;
+};
+
+CryptoWorkerQueue::CryptoWorkerQueue(QThreadPool *pool, QObject *parent) :
+    QObject(parent),
+    m_pool(pool)
+{
+}
+
+CryptoWorkerQueue::~CryptoWorkerQueue()
+{
+    // The pending jobs are dropped, but the running one refers to the queue
+    if (m_jobIsRunning) {
+        m_jobDone.acquire();
+    }
+}
+
+void CryptoWorkerQueue::enqueue(const Function &work, const Function &finish)
+{
+    m_jobs.enqueue(Job { work, finish });
+    startNextJob();
+}
+
+void CryptoWorkerQueue::onJobFinished()
+{
+    m_jobDone.acquire();
+    m_jobIsRunning = false;
+    const Job job = m_jobs.dequeue();
+    // Start the next work before the finish, so the pool thread works in parallel
+    startNextJob();
+    job.finish();
+}
+
+void CryptoWorkerQueue::startNextJob()
+{
+    if (m_jobIsRunning || m_jobs.isEmpty()) {
+        return;
+    }
+    m_jobIsRunning = true;
+    m_pool->start(new Runnable(this, m_jobs.head().work));
+}
+
+} // Server namespace
+
+} // Telegram namespace
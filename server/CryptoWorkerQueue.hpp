@@ -0,0 +1,52 @@
+#ifndef TELEGRAM_SERVER_CRYPTO_WORKER_QUEUE_HPP
+#define TELEGRAM_SERVER_CRYPTO_WORKER_QUEUE_HPP
+
+#include <QObject>
+#include <QQueue>
+#include <QSemaphore>
+
+#include <functional>
+
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
+
+namespace Telegram {
+
+namespace Server {
+
+// Runs the packets crypto and compression of a connection in a shared thread pool.
+// The jobs of a queue run one at a time in the enqueue order, so the packets order is kept.
+// The work part of a job runs in a pool thread and must use only the captured data;
+// the finish part runs afterwards in the queue thread.
+class CryptoWorkerQueue : public QObject
+{
+    Q_OBJECT
+public:
+    using Function = std::function<void()>;
+
+    explicit CryptoWorkerQueue(QThreadPool *pool, QObject *parent = nullptr);
+    ~CryptoWorkerQueue() override;
+
+    void enqueue(const Function &work, const Function &finish);
+
+protected:
+    Q_INVOKABLE void onJobFinished();
+    void startNextJob();
+
+    struct Job {
+        Function work;
+        Function finish;
+    };
+
+    class Runnable;
+
+    QThreadPool *m_pool = nullptr;
+    QQueue<Job> m_jobs;
+    QSemaphore m_jobDone;
+    bool m_jobIsRunning = false;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_CRYPTO_WORKER_QUEUE_HPP
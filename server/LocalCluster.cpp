@@ -47,6 +47,16 @@ void LocalCluster::setServerPrivateRsaKey(const Telegram::RsaKey &key)
     m_key = key;
 }
 
+void LocalCluster::setCryptoThreadCount(int count)
+{
+    m_cryptoThreadCount = count;
+}
+
+void LocalCluster::setOutgoingPacketBatching(bool enabled)
+{
+    m_outgoingPacketBatching = enabled;
+}
+
 bool LocalCluster::start()
 {
     if (m_serverConfiguration.dcOptions.isEmpty()) {
@@ -86,6 +96,8 @@ bool LocalCluster::start()
         server->setServerConfiguration(m_serverConfiguration);
         server->setDcOption(dc);
         server->setServerPrivateRsaKey(m_key);
+        server->setCryptoThreadCount(m_cryptoThreadCount);
+        server->setOutgoingPacketBatching(m_outgoingPacketBatching);
         server->setMessageService(m_messageService);
         server->setAuthorizationProvider(m_authProvider);
         m_serverInstances.append(server);
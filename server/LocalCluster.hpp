@@ -59,6 +59,12 @@ public:
     RsaKey serverRsaKey() const { return m_key; }
     void setServerPrivateRsaKey(const Telegram::RsaKey &key);
 
+    int cryptoThreadCount() const { return m_cryptoThreadCount; }
+    void setCryptoThreadCount(int count);
+
+    bool outgoingPacketBatching() const { return m_outgoingPacketBatching; }
+    void setOutgoingPacketBatching(bool enabled);
+
     bool start();
     void stop();
 
@@ -78,6 +84,8 @@ protected:
     RsaKey m_key;
     MessageService *m_messageService = nullptr;
     Authorization::Provider *m_authProvider = nullptr;
+    int m_cryptoThreadCount = 0;
+    bool m_outgoingPacketBatching = false;
 };
 
 } // Server namespace
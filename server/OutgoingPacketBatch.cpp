@@ -0,0 +1,93 @@
+#include "OutgoingPacketBatch.hpp"
+
+#include "Crypto/Aes.hpp"
+#include "Debug_p.hpp"
+#include "SendPackageHelper.hpp"
+#include "ServerRpcLayer.hpp"
+
+#include <QLoggingCategory>
+
+Q_LOGGING_CATEGORY(lcOutgoingBatch, "telegram.server.outgoing.batch", QtWarningMsg)
+
+namespace Telegram {
+
+namespace Server {
+
+OutgoingPacketBatch::OutgoingPacketBatch(QObject *parent) :
+    QObject(parent)
+{
+}
+
+void OutgoingPacketBatch::addPacket(RpcLayer *layer, const MTProto::Message &message)
+{
+    PendingPacket packet;
+    packet.layer = layer;
+    packet.context = layer->cryptoContext();
+    packet.message = message;
+    packet.serverSalt = layer->serverSalt();
+    packet.sessionId = layer->sessionId();
+    m_packets.append(packet);
+
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+        QMetaObject::invokeMethod(this, "flush", Qt::QueuedConnection);
+    }
+}
+
+void OutgoingPacketBatch::flush()
+{
+    m_flushScheduled = false;
+    if (m_packets.isEmpty()) {
+        return;
+    }
+    const QVector<PendingPacket> packets = m_packets;
+    m_packets.clear();
+
+    // The first stage builds the packets (msg_key SHA-256 and the key derivation),
+    // the second one encrypts all of them at once.
+    QVector<QByteArray> data(packets.count());
+    QVector<Crypto::AesKey> keys(packets.count());
+    QVector<Crypto::AesIgeBuffer> buffers;
+    buffers.reserve(packets.count());
+    for (int i = 0; i < packets.count(); ++i) {
+        const PendingPacket &packet = packets.at(i);
+        if (!packet.layer) {
+            continue;
+        }
+        data[i] = BaseRpcLayer::preparePacket(packet.context, packet.message,
+                                              packet.serverSalt, packet.sessionId, &keys[i]);
+        if (data.at(i).isEmpty()) {
+            continue;
+        }
+        const int encryptedSize = data.at(i).size() - BaseRpcLayer::EncryptedDataOffset;
+        if (!Crypto::isAesIgeInputValid(encryptedSize)) {
+            // Drop only this packet; the rest of the batch is still valid
+            qCWarning(lcOutgoingBatch) << CALL_INFO << "Drop an invalid packet of message"
+                                       << packet.message.messageId;
+            data[i].clear();
+            continue;
+        }
+        Crypto::AesIgeBuffer buffer;
+        buffer.data = data[i].data() + BaseRpcLayer::EncryptedDataOffset;
+        buffer.size = encryptedSize;
+        buffer.key = &keys.at(i);
+        buffers.append(buffer);
+    }
+    qCDebug(lcOutgoingBatch) << CALL_INFO << "Encrypt" << buffers.count() << "packets";
+    if (!Crypto::aesIgeEncryptBatch(buffers.constData(), buffers.count())) {
+        qCWarning(lcOutgoingBatch) << CALL_INFO << "Unable to encrypt the packets";
+        return;
+    }
+
+    for (int i = 0; i < packets.count(); ++i) {
+        const PendingPacket &packet = packets.at(i);
+        if (!packet.layer || data.at(i).isEmpty()) {
+            continue;
+        }
+        packet.layer->m_sendHelper->sendPacket(data.at(i));
+    }
+}
+
+} // Server namespace
+
+} // Telegram namespace
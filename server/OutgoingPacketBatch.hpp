@@ -0,0 +1,48 @@
+#ifndef TELEGRAM_SERVER_OUTGOING_PACKET_BATCH_HPP
+#define TELEGRAM_SERVER_OUTGOING_PACKET_BATCH_HPP
+
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+
+#include "RpcLayer.hpp"
+#include "MTProto/MessageHeader.hpp"
+
+namespace Telegram {
+
+namespace Server {
+
+class RpcLayer;
+
+// Collects the outgoing packets of all connections during one event loop iteration
+// and encrypts them together. The batch keeps the packets order of each connection.
+class OutgoingPacketBatch : public QObject
+{
+    Q_OBJECT
+public:
+    explicit OutgoingPacketBatch(QObject *parent = nullptr);
+
+    void addPacket(RpcLayer *layer, const MTProto::Message &message);
+    int pendingPacketsCount() const { return m_packets.count(); }
+
+public slots:
+    void flush();
+
+protected:
+    struct PendingPacket {
+        QPointer<RpcLayer> layer;
+        BaseRpcLayer::CryptoContext context;
+        MTProto::Message message;
+        quint64 serverSalt = 0;
+        quint64 sessionId = 0;
+    };
+
+    QVector<PendingPacket> m_packets;
+    bool m_flushScheduled = false;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_OUTGOING_PACKET_BATCH_HPP
@@ -2053,14 +2053,14 @@ void MessagesRpcOperation::submitMessageData(MessageData *messageData, quint64 r
     newMessageUpdate.pts = selfNotification->pts;
     newMessageUpdate.ptsCount = 1;
 
-    Utils::setupTLMessage(&newMessageUpdate.message, messageData, selfNotification->messageId, fromUser);
+    Utils::setupTLMessage(&*newMessageUpdate.message, messageData, selfNotification->messageId, fromUser);
 
     const Peer targetPeer = messageData->toPeer();
 
     QSet<Peer> interestingPeers;
     interestingPeers.insert(targetPeer);
-    if ((fromUser->toPeer() != targetPeer) && newMessageUpdate.message.fromId) {
-        interestingPeers.insert(Peer::fromUserId(newMessageUpdate.message.fromId));
+    if ((fromUser->toPeer() != targetPeer) && newMessageUpdate.message->fromId) {
+        interestingPeers.insert(Peer::fromUserId(newMessageUpdate.message->fromId));
     }
 
     // Bake updates
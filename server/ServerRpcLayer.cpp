@@ -1,11 +1,14 @@
 #include "ServerRpcLayer.hpp"
 
+#include "CryptoWorkerQueue.hpp"
 #include "Debug_p.hpp"
 #include "FunctionStreamOperators.hpp"
 #include "IgnoredMessageNotification.hpp"
 #include "MTProto/MessageHeader.hpp"
+#include "MTProto/SerializedSize.hpp"
 #include "MTProto/Stream.hpp"
 #include "MTProto/StreamExtraOperators.hpp"
+#include "OutgoingPacketBatch.hpp"
 #include "RemoteClientConnectionHelper.hpp"
 #include "RpcError.hpp"
 #include "RpcOperationFactory.hpp"
@@ -22,6 +25,7 @@
 #endif
 
 #include <QLoggingCategory>
+#include <QSharedPointer>
 
 Q_LOGGING_CATEGORY(c_serverRpcLayerCategory, "telegram.server.rpclayer", QtWarningMsg)
 Q_LOGGING_CATEGORY(c_serverRpcDumpPackageCategory, "telegram.server.rpclayer.dump", QtWarningMsg)
@@ -72,6 +76,48 @@ RpcLayer::RpcLayer(QObject *parent) :
 {
 }
 
+RpcLayer::~RpcLayer()
+{
+    // Wait for the running job before the rest of the connection is destroyed
+    delete m_cryptoQueue;
+}
+
+void RpcLayer::setCryptoThreadPool(QThreadPool *pool)
+{
+    delete m_cryptoQueue;
+    m_cryptoQueue = pool ? new CryptoWorkerQueue(pool, this) : nullptr;
+}
+
+void RpcLayer::setOutgoingPacketBatch(OutgoingPacketBatch *batch)
+{
+    m_outgoingBatch = batch;
+}
+
+bool RpcLayer::processPacket(const QByteArray &package)
+{
+    if (!m_cryptoQueue) {
+        return BaseRpcLayer::processPacket(package);
+    }
+
+    struct DecryptedPacket {
+        MTProto::FullMessageHeader header;
+        MTProto::Message message;
+        bool isValid = false;
+    };
+    const QSharedPointer<DecryptedPacket> result = QSharedPointer<DecryptedPacket>::create();
+    const CryptoContext context = cryptoContext();
+    // The transport payload is valid only during the call, so copy it for the worker
+    const QByteArray packet(package.constData(), package.size());
+    m_cryptoQueue->enqueue([context, packet, result]() {
+        result->isValid = decryptPacket(context, packet, &result->header, &result->message);
+    }, [this, result]() {
+        if (!result->isValid || !processDecryptedMessage(result->header, result->message)) {
+            qCWarning(c_serverRpcLayerCategory) << CALL_INFO << "Unable to process RPC packet";
+        }
+    });
+    return true;
+}
+
 LocalServerApi *RpcLayer::api()
 {
     return m_api;
@@ -139,7 +185,7 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
     case TLValue::Ping:
     case TLValue::PingDelayDisconnect:
     {
-        MTProto::Stream stream(message.data);
+        MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
         MTProto::Functions::TLPing ping;
         stream >> ping;
 
@@ -156,7 +202,7 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
         break;
     }
 
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     RpcProcessingContext context(stream, message.messageId);
 
     context.inputStream() >> requestValue;
@@ -194,7 +240,7 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
 
 bool RpcLayer::processMessageAck(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     TLVector<quint64> idsVector;
     stream >> idsVector;
     qCDebug(c_serverRpcLayerCategory) << "processMessageAck():" << idsVector;
@@ -222,14 +268,14 @@ void RpcLayer::sendUpdates(const TLUpdates &updates)
     qCDebug(c_serverRpcLayerCategory) << updates;
 #endif
 
-    MTProto::Stream stream(MTProto::Stream::WriteOnly);
+    MTProto::Stream stream(MTProto::Stream::WriteOnly, MTProto::serializedSize(updates));
     stream << updates;
     sendRpcMessage(stream.getData());
 }
 
 bool RpcLayer::processInitConnection(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     quint32 appId;
     QString deviceInfo;
     QString osInfo;
@@ -263,21 +309,17 @@ bool RpcLayer::processInitConnection(const MTProto::Message &message)
     session()->languageCode = languageCode;
     session()->deviceInfo = deviceInfo;
     session()->osInfo = osInfo;
-    MTProto::Message innerMessage = message;
-    innerMessage.data = stream.readAll();
-    return processMTProtoMessage(innerMessage);
+    return processMTProtoMessage(message.skipBytes(stream.position()));
 }
 
 bool RpcLayer::processInvokeWithLayer(const MTProto::Message &message)
 {
-    MTProto::Stream stream(message.data);
+    MTProto::Stream stream(message.data, message.dataOffset, message.dataSize);
     quint32 layer = 0;
     stream >> layer;
     qCDebug(c_serverRpcLayerCategory) << Q_FUNC_INFO << "InvokeWithLayer" << layer;
     StackValue<quint32> layerValue(&m_invokeWithLayer, layer);
-    MTProto::Message innerMessage = message;
-    innerMessage.data = stream.readAll();
-    return processMTProtoMessage(innerMessage);
+    return processMTProtoMessage(message.skipBytes(stream.position()));
 }
 
 void RpcLayer::sendIgnoredMessageNotification(quint32 errorCode, const MTProto::FullMessageHeader &header)
@@ -312,26 +354,90 @@ quint64 RpcLayer::sendRpcReply(const QByteArray &reply, quint64 messageId)
     qCDebug(c_serverRpcDumpPackageCategory) << "Server: Answer for message" << messageId;
     qCDebug(c_serverRpcDumpPackageCategory).noquote() << "Server: RPC Reply bytes:" << reply.size() << reply.toHex();
 #endif
-    RawStream output(RawStream::WriteOnly);
-    output << TLValue::RpcResult;
-    output << messageId;
-    if (reply.size() > 128) { // Telegram spec says it should be 255, but we need to lower the limit to pack DcConfig
-        const QByteArray innerData = Utils::packGZip(reply);
+    qCDebug(c_serverRpcDumpPackageCategory) << Q_FUNC_INFO << TLValue::firstFromArray(reply) << "for message id" << messageId;
+    if (!m_cryptoQueue) {
+        return sendPacket(getRpcResultData(reply, messageId, m_compressionLevel), SendMode::ServerReply, MessageType::ContentRelatedMessage);
+    }
+
+    // The reply id is needed right away, while the compression goes to the worker
+    MTProto::Message message;
+    if (!prepareMessage(&message, SendMode::ServerReply, MessageType::ContentRelatedMessage)) {
+        return 0;
+    }
+    const int compressionLevel = m_compressionLevel;
+    enqueueSendPacket(message, [reply, messageId, compressionLevel]() {
+        return getRpcResultData(reply, messageId, compressionLevel);
+    });
+    return message.messageId;
+}
+
+QByteArray RpcLayer::getRpcResultData(const QByteArray &reply, quint64 messageId, int compressionLevel)
+{
+    QByteArray packedReply;
+    // Telegram spec says it should be 255, but we need to lower the limit to pack DcConfig
+    if ((compressionLevel > 0) && (reply.size() > 128)) {
+        const QByteArray innerData = Utils::packGZip(reply, compressionLevel);
         if (innerData.size() + 8 < reply.size()) {
-            MTProto::Stream innerStream(RawStream::WriteOnly);
-            innerStream << TLValue::GzipPacked;
-            innerStream << innerData;
-            output.writeBytes(innerStream.getData());
+            packedReply = innerData;
             qCDebug(c_serverRpcDumpPackageCategory) << gzipPackMessage() << messageId << TLValue::firstFromArray(reply).toString();
         } else {
             qCDebug(c_serverRpcDumpPackageCategory) << "Server: It makes no sense to gzip the answer for message" << messageId;
-            output.writeBytes(reply);
         }
+    }
+
+    // The result is written once into a buffer of the exact size
+    int resultSize = MTProto::serializedSize(TLValue(TLValue::RpcResult)) + MTProto::serializedSize(messageId);
+    if (packedReply.isEmpty()) {
+        resultSize += reply.size();
     } else {
+        resultSize += MTProto::serializedSize(TLValue(TLValue::GzipPacked)) + MTProto::serializedSize(packedReply);
+    }
+    MTProto::Stream output(RawStream::WriteOnly, static_cast<quint32>(resultSize));
+    output << TLValue::RpcResult;
+    output << messageId;
+    if (packedReply.isEmpty()) {
         output.writeBytes(reply);
+    } else {
+        output << TLValue::GzipPacked;
+        output << packedReply;
     }
-    qCDebug(c_serverRpcDumpPackageCategory) << Q_FUNC_INFO << TLValue::firstFromArray(reply) << "for message id" << messageId;
-    return sendPacket(output.getData(), SendMode::ServerReply, MessageType::ContentRelatedMessage);
+    return output.getData();
+}
+
+bool RpcLayer::sendPacket(const MTProto::Message &message)
+{
+    if (m_cryptoQueue) {
+        enqueueSendPacket(message, nullptr);
+        return true;
+    }
+    if (m_outgoingBatch) {
+        m_outgoingBatch->addPacket(this, message);
+        return true;
+    }
+    return BaseRpcLayer::sendPacket(message);
+}
+
+void RpcLayer::enqueueSendPacket(const MTProto::Message &message, const std::function<QByteArray()> &getData)
+{
+    const CryptoContext context = cryptoContext();
+    const quint64 salt = serverSalt();
+    const quint64 session = sessionId();
+    const QSharedPointer<QByteArray> packet = QSharedPointer<QByteArray>::create();
+    m_cryptoQueue->enqueue([context, message, getData, salt, session, packet]() {
+        if (getData) {
+            MTProto::Message preparedMessage = message;
+            preparedMessage.setData(getData());
+            *packet = encryptPacket(context, preparedMessage, salt, session);
+        } else {
+            *packet = encryptPacket(context, message, salt, session);
+        }
+    }, [this, packet]() {
+        if (packet->isEmpty()) {
+            qCWarning(c_serverRpcLayerCategory) << CALL_INFO << "Unable to encrypt the packet";
+            return;
+        }
+        m_sendHelper->sendPacket(*packet);
+    });
 }
 
 bool RpcLayer::sendRpcMessage(const QByteArray &message)
@@ -413,16 +519,6 @@ bool RpcLayer::processMessageHeader(const MTProto::FullMessageHeader &header)
     return true;
 }
 
-QByteArray RpcLayer::getEncryptionKeyPart() const
-{
-    return m_sendHelper->getServerKeyPart();
-}
-
-QByteArray RpcLayer::getVerificationKeyPart() const
-{
-    return m_sendHelper->getClientKeyPart();
-}
-
 MTProtoSendHelper *RpcLayer::getHelper() const
 {
     return static_cast<MTProtoSendHelper *>(m_sendHelper);
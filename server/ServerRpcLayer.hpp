@@ -7,6 +7,10 @@
 #include <QStack>
 #include <QVector>
 
+#include <functional>
+
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
+
 class CTelegramStream;
 class RpcProcessingContext;
 
@@ -18,7 +22,9 @@ class RpcError;
 
 namespace Server {
 
+class CryptoWorkerQueue;
 class MTProtoSendHelper;
+class OutgoingPacketBatch;
 class RpcOperation;
 class RpcOperationFactory;
 
@@ -31,6 +37,7 @@ class RpcLayer : public BaseRpcLayer
     Q_OBJECT
 public:
     explicit RpcLayer(QObject *parent = nullptr);
+    ~RpcLayer() override;
 
     LocalServerApi *api();
     void setServerApi(LocalServerApi *api);
@@ -45,6 +52,12 @@ public:
 
     void setRpcFactories(const QVector<RpcOperationFactory*> &rpcFactories);
 
+    // Moves the packets crypto and compression to the pool threads (if the pool is not null)
+    void setCryptoThreadPool(QThreadPool *pool);
+    // Encrypts the outgoing packets in the batch (if the crypto is not moved to a pool)
+    void setOutgoingPacketBatch(OutgoingPacketBatch *batch);
+
+    bool processPacket(const QByteArray &package) override;
     bool processMTProtoMessage(const MTProto::Message &message) override;
     bool processMessageAck(const MTProto::Message &message);
 
@@ -66,20 +79,25 @@ public:
 
 protected:
     bool processMessageHeader(const MTProto::FullMessageHeader &header) override;
-    Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const final { return generateClientToServerAesKey(messageKey); }
-    Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const final { return generateServerToClientAesKey(messageKey); }
+    MessageDirection outgoingDirection() const final { return ServerToClient; }
 
-    QByteArray getEncryptionKeyPart() const final;
-    QByteArray getVerificationKeyPart() const final;
+    bool sendPacket(const MTProto::Message &message) override;
+    using BaseRpcLayer::sendPacket;
+    void enqueueSendPacket(const MTProto::Message &message, const std::function<QByteArray()> &getData);
+    static QByteArray getRpcResultData(const QByteArray &reply, quint64 messageId, int compressionLevel);
 
     MTProtoSendHelper *getHelper() const;
 
     Session *m_session = nullptr;
     LocalServerApi *m_api = nullptr;
+    CryptoWorkerQueue *m_cryptoQueue = nullptr;
+    OutgoingPacketBatch *m_outgoingBatch = nullptr;
     QStack<quint32> m_invokeWithLayer;
 
     QVector<RpcOperationFactory*> m_operationFactories;
     QHash<quint64, RpcOperation *> m_operationsToConfirm; // messageId to operation
+
+    friend class OutgoingPacketBatch;
 };
 
 } // Server namespace
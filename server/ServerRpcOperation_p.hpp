@@ -1,6 +1,7 @@
 #include "ServerRpcOperation.hpp"
 
 #include "ServerRpcLayer.hpp"
+#include "MTProto/SerializedSize.hpp"
 #include "MTProto/Stream.hpp"
 
 #ifdef DEVELOPER_BUILD
@@ -14,7 +15,7 @@ namespace Server {
 template<typename TLType>
 bool RpcOperation::sendRpcReply(const TLType &reply)
 {
-    MTProto::Stream output(MTProto::Stream::WriteOnly);
+    MTProto::Stream output(MTProto::Stream::WriteOnly, MTProto::serializedSize(reply));
     output << reply;
 #ifdef DEVELOPER_BUILD
     qDebug() << this << reply;
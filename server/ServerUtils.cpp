@@ -21,8 +21,8 @@ void getInterestingPeers(QSet<Peer> *peers, const TLVector<TLMessage> &messages)
             Telegram::Peer messagePeer = Peer::fromUserId(message.fromId);
             peers->insert(messagePeer);
         }
-        if (message.media.userId) {
-            Telegram::Peer messagePeer = Peer::fromUserId(message.media.userId);
+        if (message.media->userId) {
+            Telegram::Peer messagePeer = Peer::fromUserId(message.media->userId);
             peers->insert(messagePeer);
         }
     }
@@ -170,7 +170,7 @@ bool setupTLMessage(TLMessage *output, const MessageData *messageData, quint32 m
     output->toId = Telegram::Utils::toTLPeer(messageData->toPeer());
 
     if (messageData->media().isValid()) {
-        setupTLMessageMedia(&output->media, &messageData->media());
+        setupTLMessageMedia(&*output->media, &messageData->media());
         flags |= TLMessage::Media;
     }
 
@@ -4,8 +4,10 @@
 #include "AuthService.hpp"
 #include "CServerTcpTransport.hpp"
 #include "Debug_p.hpp"
+#include "LoopbackTransport.hpp"
 #include "MediaService.hpp"
 #include "MessageService.hpp"
+#include "OutgoingPacketBatch.hpp"
 #include "RandomGenerator.hpp"
 #include "RemoteClientConnection.hpp"
 #include "RemoteServerConnection.hpp"
@@ -34,9 +36,12 @@
 #include "UsersOperationFactory.hpp"
 // End of generated RPC Operation Factory includes
 
+#include <QLocalServer>
+#include <QLocalSocket>
 #include <QLoggingCategory>
 #include <QTcpServer>
 #include <QTcpSocket>
+#include <QThreadPool>
 
 Q_LOGGING_CATEGORY(loggingCategoryServer, "telegram.server.main", QtInfoMsg)
 Q_LOGGING_CATEGORY(loggingCategoryServerApi, "telegram.server.api", QtWarningMsg)
@@ -46,6 +51,7 @@ Q_LOGGING_CATEGORY(lcServerCrossUpdates, "telegram.server.cross.updates", QtInfo
 namespace Telegram {
 
 static constexpr int ExportedAuthorizationKeySize = 128;
+static constexpr int c_localSocketProbeTimeout = 1000; // ms
 
 namespace Server {
 
@@ -100,13 +106,80 @@ void Server::setServerPrivateRsaKey(const Telegram::RsaKey &key)
     m_key = key;
 }
 
+int Server::cryptoThreadCount() const
+{
+    return m_cryptoThreadPool ? m_cryptoThreadPool->maxThreadCount() : 0;
+}
+
+void Server::setCryptoThreadCount(int count)
+{
+    if (count <= 0) {
+        // The pool is kept for the existing connections
+        m_cryptoThreadPool = nullptr;
+        return;
+    }
+    if (!m_cryptoThreadPool) {
+        m_cryptoThreadPool = new QThreadPool(this);
+    }
+    m_cryptoThreadPool->setMaxThreadCount(count);
+}
+
+void Server::setOutgoingPacketBatching(bool enabled)
+{
+    if (enabled == outgoingPacketBatching()) {
+        return;
+    }
+    if (enabled) {
+        m_outgoingPacketBatch = new OutgoingPacketBatch(this);
+    } else {
+        // The batch is kept for the existing connections
+        m_outgoingPacketBatch = nullptr;
+    }
+}
+
 bool Server::start()
 {
     if (!m_dcOption.id) {
         qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to start server: Invalid (null) DC id.";
         return false;
     }
-    if (!m_serverSocket->listen(QHostAddress(m_dcOption.address), m_dcOption.port)) {
+    if (LoopbackTransport::isLoopbackAddress(m_dcOption.address)) {
+        if (!m_loopbackServer) {
+            m_loopbackServer = new LoopbackServer(this);
+            connect(m_loopbackServer, &LoopbackServer::newConnection, this, &Server::onNewLoopbackConnection);
+        }
+        if (!m_loopbackServer->listen(m_dcOption.address, m_dcOption.port)) {
+            qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to listen loopback address "
+                                                                  << m_dcOption.address << ":" << m_dcOption.port;
+            return false;
+        }
+    } else if (TcpTransport::isLocalSocketAddress(m_dcOption.address)) {
+        if (!m_localServer) {
+            m_localServer = new QLocalServer(this);
+            connect(m_localServer, &QLocalServer::newConnection, this, &Server::onNewLocalSocketConnection);
+        }
+        const QString serverName = TcpTransport::getLocalSocketServerName(m_dcOption.address);
+        bool listening = m_localServer->listen(serverName);
+        if (!listening && (m_localServer->serverError() == QAbstractSocket::AddressInUseError)) {
+            // The socket file exists. Remove it only if it is a stale file left by
+            // a previous (crashed) instance; a live server must keep its socket.
+            QLocalSocket probe;
+            probe.connectToServer(serverName);
+            if (probe.waitForConnected(c_localSocketProbeTimeout)) {
+                probe.disconnectFromServer();
+            } else {
+                qCWarning(loggingCategoryServer).noquote().nospace() << "Remove stale local socket " << serverName;
+                QLocalServer::removeServer(serverName);
+                listening = m_localServer->listen(serverName);
+            }
+        }
+        if (!listening) {
+            qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to listen local socket "
+                                                                  << serverName
+                                                                  << " (" << m_localServer->serverError() << ")";
+            return false;
+        }
+    } else if (!m_serverSocket->listen(QHostAddress(m_dcOption.address), m_dcOption.port)) {
         qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to listen port " << m_dcOption.port
                                                               << " ("  << m_serverSocket->serverError() << ")";
         return false;
@@ -124,6 +197,12 @@ void Server::stop()
     if (m_serverSocket) {
         m_serverSocket->close();
     }
+    if (m_loopbackServer) {
+        m_loopbackServer->close();
+    }
+    if (m_localServer) {
+        m_localServer->close();
+    }
 
     // Connections removed from the set on disconnected.
     // Copy connections to a variable to iterate over a constant container instead of
@@ -181,6 +260,34 @@ void Server::onNewConnection()
     }
     TcpTransport *transport = new TcpTransport(socket, this);
     socket->setParent(transport);
+    addClientConnection(transport);
+}
+
+void Server::onNewLoopbackConnection()
+{
+    LoopbackTransport *transport = m_loopbackServer->nextPendingConnection();
+    if (!transport) {
+        qCDebug(loggingCategoryServer) << "expected pending loopback connection does not exist";
+        return;
+    }
+    transport->setParent(this);
+    addClientConnection(transport);
+}
+
+void Server::onNewLocalSocketConnection()
+{
+    QLocalSocket *socket = m_localServer->nextPendingConnection();
+    if (!socket) {
+        qCDebug(loggingCategoryServer) << "expected pending local connection does not exist";
+        return;
+    }
+    TcpTransport *transport = new TcpTransport(socket, this);
+    socket->setParent(transport);
+    addClientConnection(transport);
+}
+
+void Server::addClientConnection(BaseTransport *transport)
+{
     RemoteClientConnection *client = new RemoteClientConnection(this);
     const QString address = transport->remoteAddress();
     qCInfo(loggingCategoryServer) << CALL_INFO << client;
@@ -190,6 +297,8 @@ void Server::onNewConnection()
     client->setTransport(transport);
     client->setServerApi(this);
     client->setRpcFactories(m_rpcOperationFactories);
+    client->rpcLayer()->setCryptoThreadPool(m_cryptoThreadPool);
+    client->rpcLayer()->setOutgoingPacketBatch(m_outgoingPacketBatch);
 
     m_activeConnections.insert(client);
 }
@@ -768,13 +877,13 @@ void Server::queueUpdates(const QVector<UpdateNotification> &notifications)
                 qCWarning(lcServerUpdates) << CALL_INFO << "no message";
                 continue;
             }
-            Utils::setupTLMessage(&update.message, messageData, notification.messageId, recipient);
+            Utils::setupTLMessage(&*update.message, messageData, notification.messageId, recipient);
             update.pts = notification.pts;
             update.ptsCount = 1;
 
             interestingPeers.insert(messageData->toPeer());
-            if (update.message.fromId) {
-                interestingPeers.insert(Peer::fromUserId(update.message.fromId));
+            if (update.message->fromId) {
+                interestingPeers.insert(Peer::fromUserId(update.message->fromId));
             }
 
             updates.seq = 0; // ??
@@ -784,7 +893,7 @@ void Server::queueUpdates(const QVector<UpdateNotification> &notifications)
         case UpdateNotification::Type::MessageAction:
         {
             updates.tlType = TLValue::UpdateShort;
-            TLUpdate &update = updates.update;
+            TLUpdate &update = *updates.update;
             update.tlType = TLValue::UpdateUserTyping;
             update.userId = notification.fromId;
             // Note: action depends on Layer. Process this to support different layers.
@@ -810,7 +919,7 @@ void Server::queueUpdates(const QVector<UpdateNotification> &notifications)
         case UpdateNotification::Type::UpdateName:
         {
             updates.tlType = TLValue::UpdateShort;
-            TLUpdate &update = updates.update;
+            TLUpdate &update = *updates.update;
             update.tlType = TLValue::UpdateUserName;
             update.userId = notification.fromId;
 
@@ -832,7 +941,7 @@ void Server::queueUpdates(const QVector<UpdateNotification> &notifications)
         case UpdateNotification::Type::UpdateUserStatus:
         {
             updates.tlType = TLValue::UpdateShort;
-            TLUpdate &update = updates.update;
+            TLUpdate &update = *updates.update;
             update.tlType = TLValue::UpdateUserStatus;
             update.userId = notification.fromId;
 
@@ -12,12 +12,17 @@
 #include <QSet>
 #include <QVector>
 
+QT_FORWARD_DECLARE_CLASS(QLocalServer)
 QT_FORWARD_DECLARE_CLASS(QTcpServer)
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
 QT_FORWARD_DECLARE_CLASS(QTcpSocket)
 QT_FORWARD_DECLARE_CLASS(QTimer)
 
 namespace Telegram {
 
+class BaseTransport;
+class LoopbackServer;
+
 namespace Server {
 
 namespace Authorization {
@@ -28,6 +33,7 @@ class Provider;
 
 class LocalUser;
 class MediaService;
+class OutgoingPacketBatch;
 class Session;
 class RemoteClientConnection;
 class RemoteServerConnection;
@@ -45,6 +51,15 @@ public:
 
     void setServerPrivateRsaKey(const Telegram::RsaKey &key);
 
+    // The number of threads for the packets crypto and compression of the new connections.
+    // 0 (the default) keeps the work in the server thread.
+    int cryptoThreadCount() const;
+    void setCryptoThreadCount(int count);
+
+    // Encrypt the outgoing packets of one event loop iteration together (e.g. an updates fan-out)
+    bool outgoingPacketBatching() const { return m_outgoingPacketBatch; }
+    void setOutgoingPacketBatching(bool enabled);
+
     bool start();
     void stop();
     void loadData();
@@ -122,9 +137,12 @@ public slots:
 
 protected slots:
     void onNewConnection();
+    void onNewLoopbackConnection();
+    void onNewLocalSocketConnection();
 
 protected:
     Session *addSession(quint64 sessionId);
+    void addClientConnection(BaseTransport *transport);
 
     void onClientConnectionStatusChanged();
     void onUserSessionStatusChanged(LocalUser *user, Session *session);
@@ -140,6 +158,10 @@ protected:
 
 private:
     QTcpServer *m_serverSocket;
+    LoopbackServer *m_loopbackServer = nullptr;
+    QLocalServer *m_localServer = nullptr;
+    QThreadPool *m_cryptoThreadPool = nullptr;
+    OutgoingPacketBatch *m_outgoingPacketBatch = nullptr;
     DcOption m_dcOption;
     Telegram::RsaKey m_key;
 
@@ -3,6 +3,7 @@ SOURCES += $$PWD/DefaultAuthorizationProvider.cpp
 SOURCES += $$PWD/LocalCluster.cpp
 SOURCES += $$PWD/MediaService.cpp
 SOURCES += $$PWD/MessageService.cpp
+SOURCES += $$PWD/OutgoingPacketBatch.cpp
 SOURCES += $$PWD/ServerDhLayer.cpp
 SOURCES += $$PWD/ServerMessageData.cpp
 SOURCES += $$PWD/ServerRpcLayer.cpp
@@ -15,6 +16,7 @@ SOURCES += $$PWD/TelegramServer.cpp
 SOURCES += $$PWD/TelegramServerConfig.cpp
 SOURCES += $$PWD/TelegramServerUser.cpp
 SOURCES += $$PWD/CServerTcpTransport.cpp
+SOURCES += $$PWD/CryptoWorkerQueue.cpp
 SOURCES += $$PWD/RemoteClientConnection.cpp
 SOURCES += $$PWD/RemoteClientConnectionHelper.cpp
 SOURCES += $$PWD/RemoteServerConnection.cpp
@@ -26,6 +28,7 @@ HEADERS += $$PWD/IMediaService.hpp
 HEADERS += $$PWD/LocalCluster.hpp
 HEADERS += $$PWD/MediaService.hpp
 HEADERS += $$PWD/MessageService.hpp
+HEADERS += $$PWD/OutgoingPacketBatch.hpp
 HEADERS += $$PWD/ServerApi.hpp
 HEADERS += $$PWD/ServerDhLayer.hpp
 HEADERS += $$PWD/ServerNamespace.hpp
@@ -41,6 +44,7 @@ HEADERS += $$PWD/TelegramServer.hpp
 HEADERS += $$PWD/TelegramServerConfig.hpp
 HEADERS += $$PWD/TelegramServerUser.hpp
 HEADERS += $$PWD/CServerTcpTransport.hpp
+HEADERS += $$PWD/CryptoWorkerQueue.hpp
 HEADERS += $$PWD/RemoteClientConnection.hpp
 HEADERS += $$PWD/RemoteClientConnectionHelper.hpp
 HEADERS += $$PWD/RemoteServerConnection.hpp
@@ -23,14 +23,19 @@
 
 #include "AccountStorage.hpp"
 #include "Client.hpp"
+#include "Client_p.hpp"
+#include "ClientConnection.hpp"
+#include "ClientRpcLayer.hpp"
 #include "ClientSettings.hpp"
 #include "ConnectionApi.hpp"
 #include "DataStorage.hpp"
 #include "Utils.hpp"
 #include "TelegramNamespace.hpp"
 #include "CAppInformation.hpp"
+#include "SendPackageHelper.hpp"
 
 #include "Operations/ClientAuthOperation.hpp"
+#include "RpcLayers/ClientRpcHelpLayer.hpp"
 
 #include "ContactsApi.hpp"
 #include "CTcpTransport.hpp"
@@ -44,11 +49,18 @@
 #include "ServerRpcLayer.hpp"
 #include "Session.hpp"
 #include "LocalCluster.hpp"
+#include "OutgoingPacketBatch.hpp"
 
+#include <QDateTime>
 #include <QTest>
 #include <QSignalSpy>
 #include <QDebug>
 #include <QRegularExpression>
+#include <QFile>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
 
 #include "keys_data.hpp"
 #include "TestAuthProvider.hpp"
@@ -105,6 +117,16 @@ static const Telegram::DcConfiguration c_customDcConfiguration = []() {
     return configuration;
 }();
 
+static Telegram::DcConfiguration mkDcConfiguration(const QString &addressPrefix)
+{
+    Telegram::DcConfiguration configuration;
+    configuration.dcOptions = {
+        Telegram::DcOption(addressPrefix + QStringLiteral("dc1"), 11441, 1),
+        Telegram::DcOption(addressPrefix + QStringLiteral("dc2"), 11441, 2),
+    };
+    return configuration;
+}
+
 class tst_ConnectionApi : public QObject
 {
     Q_OBJECT
@@ -116,9 +138,16 @@ private slots:
     void cleanupTestCase();
     void testClientConnection_data();
     void testClientConnection();
+    void alternativeTransport_data();
+    void alternativeTransport();
     void registrationAuthError();
     void reconnect();
     void reconnectNow();
+    void retransmissionBufferSoak();
+    void acknowledgeUpdatesBurst_data();
+    void acknowledgeUpdatesBurst();
+    void benchmarkUpdatesFanOut_data();
+    void benchmarkUpdatesFanOut();
 };
 
 tst_ConnectionApi::tst_ConnectionApi(QObject *parent) :
@@ -183,6 +212,18 @@ void tst_ConnectionApi::testClientConnection_data()
             << opt
             << c_dontWaitForPhoneRequest;
 
+    QTest::newRow("Intermediate")
+            << Client::Settings::SessionType::Intermediate
+            << userOnDc1
+            << opt
+            << c_dontWaitForPhoneRequest;
+
+    QTest::newRow("Padded intermediate")
+            << Client::Settings::SessionType::PaddedIntermediate
+            << userOnDc1
+            << opt
+            << c_dontWaitForPhoneRequest;
+
     QTest::newRow("Abridged with migration")
             << Client::Settings::SessionType::Abridged
             << userOnDc2
@@ -333,6 +374,78 @@ void tst_ConnectionApi::testClientConnection()
     QVERIFY(client.contactsApi()->selfUserId());
 }
 
+void tst_ConnectionApi::alternativeTransport_data()
+{
+    QTest::addColumn<QString>("addressPrefix");
+    QTest::addColumn<int>("cryptoThreadCount");
+    QTest::addColumn<bool>("outgoingPacketBatching");
+
+    QTest::newRow("Loopback")
+            << QStringLiteral("loopback:")
+            << 0 << false;
+    QTest::newRow("Local socket")
+            << QStringLiteral("unix:telegram-qt-tst_ConnectionApi-")
+            << 0 << false;
+    QTest::newRow("Loopback (crypto workers)")
+            << QStringLiteral("loopback:")
+            << 2 << false;
+    QTest::newRow("Local socket (crypto workers)")
+            << QStringLiteral("unix:telegram-qt-tst_ConnectionApi-")
+            << 2 << false;
+    QTest::newRow("Loopback (outgoing batch)")
+            << QStringLiteral("loopback:")
+            << 0 << true;
+}
+
+void tst_ConnectionApi::alternativeTransport()
+{
+    QFETCH(QString, addressPrefix);
+    QFETCH(int, cryptoThreadCount);
+    QFETCH(bool, outgoingPacketBatching);
+    const DcConfiguration dcConfiguration = mkDcConfiguration(addressPrefix);
+    const UserData userData = mkUserData(1, 1);
+    const DcOption clientDcOption = dcConfiguration.dcOptions.first();
+
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(dcConfiguration);
+    cluster.setCryptoThreadCount(cryptoThreadCount);
+    cluster.setOutgoingPacketBatching(outgoingPacketBatching);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user = tryAddUser(&cluster, userData);
+    QVERIFY(user);
+
+    Client::Client client;
+    Test::setupClientHelper(&client, userData, publicKey, clientDcOption);
+    Client::ConnectionApi *connectionApi = client.connectionApi();
+
+    Client::AuthOperation *signInOperation = connectionApi->startAuthentication();
+    {
+        QSignalSpy serverAuthCodeSpy(&authProvider, &Test::AuthProvider::codeSent);
+        QSignalSpy authCodeSpy(signInOperation, &Client::AuthOperation::authCodeRequired);
+        signInOperation->setPhoneNumber(userData.phoneNumber);
+        TRY_VERIFY(!authCodeSpy.isEmpty());
+        QCOMPARE(serverAuthCodeSpy.count(), 1);
+        const QString authCode = serverAuthCodeSpy.takeFirst().at(1).toString();
+        signInOperation->submitAuthCode(authCode);
+    }
+    TRY_VERIFY2(signInOperation->isSucceeded(), "Unexpected sign in fail");
+    TRY_COMPARE(connectionApi->status(), Telegram::Client::ConnectionApi::StatusReady);
+    QCOMPARE(client.accountStorage()->dcInfo().id, userData.dcId);
+
+    connectionApi->disconnectFromServer();
+    TRY_COMPARE(connectionApi->status(), Telegram::Client::ConnectionApi::StatusDisconnected);
+    cluster.stop();
+}
+
 void tst_ConnectionApi::registrationAuthError()
 {
     const DcOption clientDcOption = c_localDcOptions.first();
@@ -613,6 +726,291 @@ void tst_ConnectionApi::reconnectNow()
     }
 }
 
+// The resident set size of the process or 0 if unknown
+static qint64 getResidentMemory()
+{
+#ifdef Q_OS_LINUX
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (!statm.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    const QList<QByteArray> values = statm.readAll().split(' ');
+    if (values.count() < 2) {
+        return 0;
+    }
+    return values.at(1).toLongLong() * sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+void tst_ConnectionApi::retransmissionBufferSoak()
+{
+    // Set TELEGRAMQT_SOAK_RPC_COUNT=1000000 for the full soak run
+    int rpcCount = qEnvironmentVariableIntValue("TELEGRAMQT_SOAK_RPC_COUNT");
+    if (rpcCount <= 0) {
+        rpcCount = 1000;
+    }
+    const int batchSize = qMin(rpcCount, 100);
+    constexpr int maxBufferBytes = Client::RpcLayer::RetransmissionBufferMaxBytes;
+    // The bound is far above the allocator noise and far below the growth of a leak in the long run
+    constexpr qint64 allowedMemoryGrowth = 32 * 1024 * 1024;
+
+    const DcConfiguration dcConfiguration = c_localDcConfiguration;
+    const UserData userData = mkUserData(1, 1);
+    const DcOption clientDcOption = dcConfiguration.dcOptions.first();
+
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(dcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user = tryAddUser(&cluster, userData);
+    QVERIFY(user);
+
+    Client::Client client;
+    Test::setupClientHelper(&client, userData, publicKey, clientDcOption);
+    Client::ConnectionApi *connectionApi = client.connectionApi();
+
+    Client::AuthOperation *signInOperation = connectionApi->startAuthentication();
+    {
+        QSignalSpy serverAuthCodeSpy(&authProvider, &Test::AuthProvider::codeSent);
+        QSignalSpy authCodeSpy(signInOperation, &Client::AuthOperation::authCodeRequired);
+        signInOperation->setPhoneNumber(userData.phoneNumber);
+        TRY_VERIFY(!authCodeSpy.isEmpty());
+        QCOMPARE(serverAuthCodeSpy.count(), 1);
+        const QString authCode = serverAuthCodeSpy.takeFirst().at(1).toString();
+        signInOperation->submitAuthCode(authCode);
+    }
+    TRY_VERIFY2(signInOperation->isSucceeded(), "Unexpected sign in fail");
+    TRY_COMPARE(connectionApi->status(), Telegram::Client::ConnectionApi::StatusReady);
+
+    Client::Backend *backend = Client::ClientPrivate::get(&client);
+    Client::RpcLayer *rpcLayer = backend->getDefaultConnection()->rpcLayer();
+
+    qint64 baselineMemory = 0;
+    for (int sent = 0; sent < rpcCount; sent += batchSize) {
+        int finished = 0;
+        for (int i = 0; i < batchSize; ++i) {
+            PendingOperation *operation = backend->helpLayer()->getNearestDc();
+            connect(operation, &PendingOperation::finished, this, [&finished, operation]() {
+                ++finished;
+                operation->deleteLater();
+            });
+        }
+        QVERIFY(rpcLayer->retransmissionBufferBytes() <= maxBufferBytes);
+        TRY_COMPARE(finished, batchSize);
+        QVERIFY(rpcLayer->retransmissionBufferBytes() <= maxBufferBytes);
+        // The buffer drains as the answers arrive
+        TRY_COMPARE(rpcLayer->retransmissionBufferCount(), 0);
+
+        // The first batches fill the allocator pools and the caches
+        if (sent == batchSize * 2) {
+            baselineMemory = getResidentMemory();
+        } else if (baselineMemory) {
+            const qint64 memoryGrowth = getResidentMemory() - baselineMemory;
+            QVERIFY2(memoryGrowth < allowedMemoryGrowth,
+                     qPrintable(QStringLiteral("The memory grows by %1 bytes after %2 RPCs")
+                                .arg(memoryGrowth).arg(sent + batchSize)));
+        }
+    }
+    QCOMPARE(rpcLayer->retransmissionBufferBytes(), 0);
+
+    connectionApi->disconnectFromServer();
+    TRY_COMPARE(connectionApi->status(), Telegram::Client::ConnectionApi::StatusDisconnected);
+    cluster.stop();
+}
+
+void tst_ConnectionApi::acknowledgeUpdatesBurst_data()
+{
+    QTest::addColumn<int>("ackThreshold");
+    QTest::addColumn<int>("maxPackets");
+
+    // The limits leave a room for the packets unrelated to the acks
+    constexpr int maxThreshold = Client::RpcLayer::AckMaxMessages;
+    QTest::newRow("ack per packet") << 1 << 1010;
+    QTest::newRow("coalesced") << 64 << 32;
+    QTest::newRow("delay only") << maxThreshold << 64;
+}
+
+void tst_ConnectionApi::acknowledgeUpdatesBurst()
+{
+    QFETCH(int, ackThreshold);
+    QFETCH(int, maxPackets);
+    constexpr int updatesCount = 1000;
+
+    const DcConfiguration dcConfiguration = c_localDcConfiguration;
+    const UserData userData = mkUserData(1, 1);
+    const DcOption clientDcOption = dcConfiguration.dcOptions.first();
+
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(dcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user = tryAddUser(&cluster, userData);
+    QVERIFY(user);
+
+    Client::Client client;
+    Test::setupClientHelper(&client, userData, publicKey, clientDcOption);
+    Client::ConnectionApi *connectionApi = client.connectionApi();
+
+    Client::AuthOperation *signInOperation = connectionApi->startAuthentication();
+    {
+        QSignalSpy serverAuthCodeSpy(&authProvider, &Test::AuthProvider::codeSent);
+        QSignalSpy authCodeSpy(signInOperation, &Client::AuthOperation::authCodeRequired);
+        signInOperation->setPhoneNumber(userData.phoneNumber);
+        TRY_VERIFY(!authCodeSpy.isEmpty());
+        QCOMPARE(serverAuthCodeSpy.count(), 1);
+        const QString authCode = serverAuthCodeSpy.takeFirst().at(1).toString();
+        signInOperation->submitAuthCode(authCode);
+    }
+    TRY_VERIFY2(signInOperation->isSucceeded(), "Unexpected sign in fail");
+    TRY_COMPARE(connectionApi->status(), Telegram::Client::ConnectionApi::StatusReady);
+
+    Client::Backend *backend = Client::ClientPrivate::get(&client);
+    Client::Connection *connection = backend->getDefaultConnection();
+    Client::RpcLayer *rpcLayer = connection->rpcLayer();
+    rpcLayer->setAckThreshold(ackThreshold);
+    TRY_COMPARE(rpcLayer->pendingAcksCount(), 0);
+
+    QVector<Server::Session *> sessions = user->activeSessions();
+    QCOMPARE(sessions.count(), 1);
+    Server::RpcLayer *serverRpcLayer = sessions.first()->getConnection()->rpcLayer();
+
+    QSignalSpy receivedPacketsSpy(connection->transport(), &BaseTransport::packetReceived);
+    QSignalSpy sentPacketsSpy(connection->transport(), &BaseTransport::packetSent);
+
+    // A burst of the status updates, each goes in a separate content related packet
+    TLUpdates updates;
+    updates.tlType = TLValue::UpdateShort;
+    updates.update->tlType = TLValue::UpdateUserStatus;
+    updates.update->userId = user->id();
+    updates.update->status.tlType = TLValue::UserStatusOnline;
+    updates.update->status.expires = static_cast<quint32>(QDateTime::currentSecsSinceEpoch()) + 60;
+    for (int i = 0; i < updatesCount; ++i) {
+        serverRpcLayer->sendUpdates(updates);
+    }
+
+    TRY_VERIFY(receivedPacketsSpy.count() >= updatesCount);
+    TRY_COMPARE(rpcLayer->pendingAcksCount(), 0);
+    qDebug().nospace() << "Sent " << sentPacketsSpy.count() << " packets to ack " << updatesCount << " updates";
+    QVERIFY(sentPacketsSpy.count() <= maxPackets);
+
+    connectionApi->disconnectFromServer();
+    TRY_COMPARE(connectionApi->status(), Telegram::Client::ConnectionApi::StatusDisconnected);
+    cluster.stop();
+}
+
+// The connection of a fan-out recipient; the packets go nowhere
+class FanOutSendHelper : public BaseMTProtoSendHelper
+{
+public:
+    quint64 newMessageId(SendMode mode) override
+    {
+        Q_UNUSED(mode)
+        m_lastMessageId += 4;
+        return m_lastMessageId | 3; // Server initiative
+    }
+
+    void sendPacket(const QByteArray &package) override
+    {
+        ++sentPackets;
+        sentBytes += package.size();
+    }
+
+    int sentPackets = 0;
+    qint64 sentBytes = 0;
+};
+
+void tst_ConnectionApi::benchmarkUpdatesFanOut_data()
+{
+    QTest::addColumn<int>("messageLength");
+    QTest::addColumn<bool>("batching");
+
+    // The lengths give about 128 B, 256 B and 1 KB packets
+    const QVector<int> messageLengths = { 40, 168, 936 };
+    for (const int messageLength : messageLengths) {
+        QTest::newRow(QByteArray("direct " + QByteArray::number(messageLength)).constData())
+                << messageLength << false;
+        QTest::newRow(QByteArray("batch " + QByteArray::number(messageLength)).constData())
+                << messageLength << true;
+    }
+}
+
+void tst_ConnectionApi::benchmarkUpdatesFanOut()
+{
+    QFETCH(int, messageLength);
+    QFETCH(bool, batching);
+    // 1000 recipients of a single update, e.g. a message in a big group
+    constexpr int recipientsCount = 1000;
+
+    QByteArray authKey(256, Qt::Uninitialized);
+    Server::OutgoingPacketBatch batch;
+    QVector<Server::Session *> sessions;
+    QVector<FanOutSendHelper *> sendHelpers;
+    QVector<Server::RpcLayer *> rpcLayers;
+    for (int i = 0; i < recipientsCount; ++i) {
+        for (int j = 0; j < authKey.size(); ++j) {
+            authKey[j] = static_cast<char>(i * 31 + j * 7);
+        }
+        Server::Session *session = new Server::Session(static_cast<quint64>(i + 1));
+        session->generateInitialServerSalt();
+        FanOutSendHelper *sendHelper = new FanOutSendHelper();
+        sendHelper->setAuthKey(authKey);
+        Server::RpcLayer *rpcLayer = new Server::RpcLayer();
+        rpcLayer->setSession(session);
+        rpcLayer->setSendHelper(sendHelper);
+        if (batching) {
+            rpcLayer->setOutgoingPacketBatch(&batch);
+        }
+        sessions.append(session);
+        sendHelpers.append(sendHelper);
+        rpcLayers.append(rpcLayer);
+    }
+
+    TLUpdates updates;
+    updates.tlType = TLValue::UpdateShortMessage;
+    updates.id = 1;
+    updates.userId = 1;
+    updates.message = QString(messageLength, QLatin1Char('x'));
+    updates.pts = 1;
+    updates.ptsCount = 1;
+    updates.date = static_cast<quint32>(QDateTime::currentSecsSinceEpoch());
+
+    // The fan-out and the flush of the packets it produced
+    QBENCHMARK {
+        for (Server::RpcLayer *rpcLayer : rpcLayers) {
+            rpcLayer->sendUpdates(updates);
+        }
+        if (batching) {
+            batch.flush();
+        }
+    }
+    QCOMPARE(batch.pendingPacketsCount(), 0);
+    const FanOutSendHelper *lastSendHelper = sendHelpers.last();
+    QVERIFY(lastSendHelper->sentPackets > 0);
+    qDebug().nospace() << "Packets of " << lastSendHelper->sentBytes / lastSendHelper->sentPackets << " bytes";
+
+    qDeleteAll(rpcLayers);
+    qDeleteAll(sendHelpers);
+    qDeleteAll(sessions);
+}
+
 QTEST_GUILESS_MAIN(tst_ConnectionApi)
 
 #include "tst_ConnectionApi.moc"
@@ -21,6 +21,9 @@
 #include "AccountStorage.hpp"
 #include "CAppInformation.hpp"
 #include "Client.hpp"
+#include "Client_p.hpp"
+#include "ClientConnection.hpp"
+#include "ClientRpcLayer.hpp"
 #include "ClientSettings.hpp"
 #include "ConnectionApi.hpp"
 #include "ContactList.hpp"
@@ -41,6 +44,7 @@
 #include "TelegramServer.hpp"
 #include "TelegramServerUser.hpp"
 
+#include <QElapsedTimer>
 #include <QTest>
 #include <QSignalSpy>
 #include <QDebug>
@@ -100,6 +104,8 @@ private slots:
     void getHistory();
     void syncPeerDialogs();
     void messageAction();
+    void sendMessageLatency_data();
+    void sendMessageLatency();
 };
 
 tst_MessagesApi::tst_MessagesApi(QObject *parent) :
@@ -1386,6 +1392,74 @@ void tst_MessagesApi::messageAction()
     }
 }
 
+void tst_MessagesApi::sendMessageLatency_data()
+{
+    QTest::addColumn<int>("inFlightWindow");
+
+    QTest::newRow("unlimited") << 0;
+    QTest::newRow("default window") << int(Client::RpcLayer::DefaultInFlightWindow);
+}
+
+void tst_MessagesApi::sendMessageLatency()
+{
+    QFETCH(int, inFlightWindow);
+    constexpr int historyRequests = 500;
+
+    const UserData userData = c_user1;
+    const DcOption clientDcOption = c_localDcOptions.first();
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY(publicKey.isValid() && privateKey.isPrivate()); // Sanity check
+
+    // Prepare server
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_localDcConfiguration);
+    QVERIFY(cluster.start());
+
+    Server::LocalUser *user = tryAddUser(&cluster, userData);
+    QVERIFY(user);
+
+    // Prepare client
+    Client::Client client;
+    client.messagingApi()->setSyncMode(Client::MessagingApi::ManualSync);
+    Test::setupClientHelper(&client, userData, publicKey, clientDcOption);
+    signInHelper(&client, userData, &authProvider);
+    TRY_VERIFY2(client.isSignedIn(), "Unexpected sign in fail");
+
+    Client::Backend *backend = Client::ClientPrivate::get(&client);
+    Client::RpcLayer *rpcLayer = backend->getDefaultConnection()->rpcLayer();
+    rpcLayer->setInFlightWindow(inFlightWindow);
+
+    // The history sync queues up the requests
+    const Peer selfPeer = user->toPeer();
+    int historyFinished = 0;
+    for (int i = 0; i < historyRequests; ++i) {
+        Client::PendingMessages *historyOperation
+                = client.messagingApi()->getHistory(selfPeer, Client::MessageFetchOptions::useLimit(20));
+        connect(historyOperation, &PendingOperation::finished, this, [&historyFinished]() { ++historyFinished; });
+    }
+
+    QSignalSpy messageSentSpy(client.messagingApi(), &Client::MessagingApi::messageSent);
+    QElapsedTimer timer;
+    timer.start();
+    client.messagingApi()->sendMessage(selfPeer, QStringLiteral("Interactive message"));
+    TRY_COMPARE(messageSentSpy.count(), 1);
+    const qint64 latency = timer.elapsed();
+    const int historyFinishedBeforeMessage = historyFinished;
+    qDebug().nospace() << "sendMessage took " << latency << " ms with "
+                       << historyFinishedBeforeMessage << " of " << historyRequests << " history requests done";
+    if (inFlightWindow) {
+        // The message overtakes the queued history requests
+        QVERIFY(historyFinishedBeforeMessage <= inFlightWindow);
+    }
+
+    TRY_COMPARE(historyFinished, historyRequests);
+    QCOMPARE(rpcLayer->queuedRpcCount(), 0);
+}
+
 QTEST_GUILESS_MAIN(tst_MessagesApi)
 
 #include "tst_MessagesApi.moc"